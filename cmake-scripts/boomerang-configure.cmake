@@ -18,6 +18,7 @@ option(BUILD_SHARED_LIBS                "Build shared or static libraries." ON)
 option(BOOMERANG_BUILD_GUI              "Build the GUI. Requires Qt5Widgets." ON)
 option(BOOMERANG_BUILD_CLI              "Build the command line interface." ON)
 option(BOOMERANG_BUILD_UNIT_TESTS       "Build the unit tests. Requires Qt5Test." OFF)
+option(BOOMERANG_BUILD_BENCHMARKS       "Build the microbenchmarks. Requires Google Benchmark." OFF)
 
 if (BOOMERANG_BUILD_CLI)
     option(BOOMERANG_BUILD_REGRESSION_TESTS "Build the regression tests. Requires Python 3." OFF)
@@ -27,6 +28,10 @@ if ("${CMAKE_CXX_COMPILER_ID}" MATCHES "GNU")
     option(BOOMERANG_ENABLE_COVERAGE "Build with coverage compiler flags enabled." OFF)
 endif ("${CMAKE_CXX_COMPILER_ID}" MATCHES "GNU")
 
+if (NOT MSVC)
+    option(BOOMERANG_ENABLE_TSAN "Build with ThreadSanitizer enabled." OFF)
+endif (NOT MSVC)
+
 option(BOOMERANG_INSTALL_SAMPLES "Install sample binaries." OFF)
 
 
@@ -29,3 +29,13 @@ if (BOOMERANG_BUILD_REGRESSION_TESTS)
         "${CMAKE_SOURCE_DIR}/tests/regression-tests/expected-outputs"
     )
 endif (BOOMERANG_BUILD_REGRESSION_TESTS)
+
+
+if (BOOMERANG_BUILD_BENCHMARKS)
+    find_package(benchmark REQUIRED)
+    if (benchmark_FOUND)
+        mark_as_advanced(benchmark_DIR)
+    endif (benchmark_FOUND)
+
+    add_subdirectory(${CMAKE_SOURCE_DIR}/tests/benchmarks)
+endif (BOOMERANG_BUILD_BENCHMARKS)
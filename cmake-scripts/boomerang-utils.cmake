@@ -134,6 +134,22 @@ function(BOOMERANG_ADD_TEST)
 endfunction(BOOMERANG_ADD_TEST)
 
 
+#
+# Usage: BOOMERANG_ADD_BENCHMARK(NAME <name> SOURCES <souce files> [ LIBRARIES <additional libs> ])
+#
+function(BOOMERANG_ADD_BENCHMARK)
+	cmake_parse_arguments(BENCH "" "NAME" "SOURCES;LIBRARIES" ${ARGN})
+
+	get_filename_component(exename "${BENCH_NAME}" NAME)
+
+	add_executable(${exename} ${BENCH_SOURCES})
+
+	target_link_libraries(${exename}
+		boomerang-bench-utils
+		${BENCH_LIBRARIES})
+endfunction(BOOMERANG_ADD_BENCHMARK)
+
+
 include(CheckCXXCompilerFlag)
 include(CheckCCompilerFlag)
 
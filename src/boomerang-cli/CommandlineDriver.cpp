@@ -12,12 +12,20 @@
 #include "boomerang/core/Settings.h"
 #include "boomerang/db/Prog.h"
 #include "boomerang/util/CFGDotWriter.h"
+#include "boomerang/util/log/FileLogSink.h"
 #include "boomerang/util/log/Log.h"
 
 #include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QEventLoop>
+#include <QProcess>
 #include <QTextStream>
+#include <QTimer>
 
+#include <algorithm>
+#include <functional>
 #include <iostream>
+#include <map>
 
 
 Q_DECLARE_METATYPE(Address)
@@ -27,9 +35,7 @@ CommandlineDriver::CommandlineDriver(QObject *_parent)
     : QObject(_parent)
     , m_project(new Project())
     , m_debugger(new MiniDebugger())
-    , m_kill_timer(this)
 {
-    this->connect(&m_kill_timer, &QTimer::timeout, this, &CommandlineDriver::onCompilationTimeout);
     m_project->addWatcher(m_debugger.get());
 }
 
@@ -43,6 +49,7 @@ static void help()
     std::cout <<
 "Usage:\n"
 "  boomerang-cli [ switches ] [ -- ] program\n"
+"  boomerang-cli [ switches ] --batch <list_file>\n"
 "  boomerang-cli -i [ command_file ]\n"
 "  boomerang-cli ( -h | --help | --version )\n"
 "\n"
@@ -56,10 +63,22 @@ static void help()
 "  -e <addr>        : Decode or decompile the procedure beginning at addr, and callees\n"
 "  -E <addr>        : Equivalent to -nc -e <addr>\n"
 "  -ic              : Decode through type 0 Indirect Calls\n"
-"  -S <min>         : Stop decompilation after specified number of minutes\n"
+"  -S <min>         : Stop decompilation after specified number of minutes. Procedures\n"
+"                     that are not finished by then are emitted partially analysed\n"
+"  --proc-time-limit <sec>  : Stop analysing a procedure after <sec> seconds\n"
+"  --proc-pass-limit <num>  : Stop analysing a procedure after <num> passes\n"
+"  --pre-decode     : Linearly sweep all code sections in parallel before decoding\n"
+"                     (only supported for some machines)\n"
 "  -t               : Trace (print address of) every instruction decoded\n"
 "  -a               : Assume ABI compliance\n"
 "\n"
+"Batch mode\n"
+"  --batch <file>   : Decompile every program listed in <file> (one path per line,\n"
+"                     '-' reads the list from stdin). The output for each program is\n"
+"                     written to its own subdirectory of the output path, together\n"
+"                     with a summary in batch-summary.txt\n"
+"  -j <num>         : Decompile <num> programs of the batch concurrently\n"
+"\n"
 "Output\n"
 "  --version        : Print version information and exit\n"
 "  -h, --help       : Show this help and exit\n"
@@ -70,10 +89,13 @@ static void help()
 "  -gc              : Generate a call graph to callgraph.dot\n"
 "  -gs              : Generate a symbol file (symbols.h)\n"
 "  -iw              : Write indirect call report to output/indirect.txt\n"
+"  --metrics <file> : Periodically append progress and throughput metrics to <file>\n"
+"                     as JSON lines ('-' writes them to stderr)\n"
 "\n"
 "Misc.\n"
 "  -i [<file>]      : Interactive mode; execute commands from <file>, if present\n"
 "  -P <path>        : Path to Boomerang files, defaults to the path to the Boomerang executable\n"
+"  --no-ssl-cache   : Do not cache parsed SSL files on disk\n"
 "  -X               : activate eXperimental code; errors likely\n"
 "  --               : No effect (used for testing)\n"
 "\n"
@@ -97,6 +119,7 @@ static void help()
 "  -nP              : No promotion of signatures (other than main/WinMain/DriverMain)\n"
 "  -nr              : Do not remove unneeded labels\n"
 "  -nR              : Do not remove unused return values\n"
+"  --no-pruned-ssa  : Place phi functions also where the variable is dead\n"
 "  -nT              : No Type Analysis\n"
 "  -l <depth>       : Limit multi-propagations to expressions with depth <depth>\n"
 "  -p <num>         : Only do <num> propagations\n";
@@ -113,6 +136,7 @@ static void usage()
     std::cout <<
 "Usage:\n"
 "  boomerang-cli [ switches ] [ -- ] program\n"
+"  boomerang-cli [ switches ] --batch <list_file>\n"
 "  boomerang-cli -i [ command_file ]\n"
 "  boomerang-cli ( -h | --help | --version )\n";
     // clang-format on
@@ -136,6 +160,9 @@ int CommandlineDriver::applyCommandline(const QStringList &args)
     for (int i = 1; i < args.size(); ++i) {
         QString arg = args[i];
 
+        const int argStart    = i;
+        bool forwardToWorkers = true;
+
         if (arg[0] != '-') {
             if (i == args.size() - 1) {
                 break;
@@ -223,6 +250,66 @@ int CommandlineDriver::applyCommandline(const QStringList &args)
                 m_project->getSettings()->stopBeforeDecompile = true;
                 break;
             }
+            else if (arg == "--pre-decode") {
+                m_project->getSettings()->preDecode = true;
+                break;
+            }
+            else if (arg == "--no-pruned-ssa") {
+                m_project->getSettings()->prunedSSA = false;
+                break;
+            }
+            else if (arg == "--batch") {
+                if (++i == args.size()) {
+                    usage();
+                    return 1;
+                }
+
+                m_batchListFile  = args[i];
+                forwardToWorkers = false;
+                break;
+            }
+            else if (arg == "--proc-time-limit" || arg == "--proc-pass-limit") {
+                if (++i == args.size()) {
+                    usage();
+                    return 1;
+                }
+
+                const int limit = std::max(0, args[i].toInt());
+                if (arg == "--proc-time-limit") {
+                    m_project->getSettings()->procTimeLimit = limit;
+                }
+                else {
+                    m_project->getSettings()->procPassLimit = limit;
+                }
+                break;
+            }
+            else if (arg == "--metrics") {
+                if (++i == args.size()) {
+                    usage();
+                    return 1;
+                }
+
+                if (!m_metrics) {
+                    m_metrics.reset(new MetricsWatcher());
+                    m_project->addWatcher(m_metrics.get());
+                }
+
+                if (!m_metrics->setOutputFile(args[i])) {
+                    std::cerr << "Cannot open metrics file '" << qPrintable(args[i]) << "'"
+                              << std::endl;
+                    return 1;
+                }
+                break;
+            }
+            else if (arg == "--no-ssl-cache") {
+                m_project->getSettings()->setSSLCacheDirectory("");
+                break;
+            }
+            else if (arg == "--batch-worker") {
+                // internal switch used by batch mode to start worker processes
+                m_batchWorker = true;
+                break;
+            }
             break;
 
         case 'i':
@@ -342,20 +429,44 @@ int CommandlineDriver::applyCommandline(const QStringList &args)
             m_project->getSettings()->propMaxDepth = args[i].toInt();
             break;
 
-        case 'S': minsToStopAfter = args[++i].toInt(); break;
+        case 'S':
+            if (++i == args.size()) {
+                usage();
+                return 1;
+            }
+
+            minsToStopAfter = std::max(0, args[i].toInt());
+            m_project->getSettings()->decompileTimeLimit = 60 * minsToStopAfter;
+            break;
+
+        case 'j':
+            if (++i == args.size()) {
+                usage();
+                return 1;
+            }
+
+            m_numBatchJobs   = std::max(1, args[i].toInt());
+            forwardToWorkers = false;
+            break;
 
         default: help();
         }
+
+        if (forwardToWorkers) {
+            m_workerArgs += args.mid(argStart, i - argStart + 1);
+        }
     }
 
     if (interactiveMode) {
         return interactiveMain();
     }
 
+    if (!m_batchListFile.isEmpty() || m_batchWorker) {
+        return 0;
+    }
+
     if (minsToStopAfter > 0) {
         LOG_MSG("Stopping decompile after %1 minutes", minsToStopAfter);
-        m_kill_timer.setSingleShot(true);
-        m_kill_timer.start(1000 * 60 * minsToStopAfter);
     }
 
     m_pathToBinary = args.last();
@@ -398,6 +509,13 @@ int CommandlineDriver::interactiveMain()
 
 int CommandlineDriver::decompile()
 {
+    if (m_batchWorker) {
+        return runBatchWorker();
+    }
+    else if (!m_batchListFile.isEmpty()) {
+        return decompileBatch();
+    }
+
     Log::getOrCreateLog().addDefaultLogSinks(
         m_project->getSettings()->getOutputDirectory().absolutePath());
     m_project->loadPlugins();
@@ -409,13 +527,6 @@ int CommandlineDriver::decompile()
 }
 
 
-void CommandlineDriver::onCompilationTimeout()
-{
-    LOG_WARN("Compilation timed out, Boomerang will now exit");
-    exit(1);
-}
-
-
 bool CommandlineDriver::loadAndDecode(const QString &fname, const QString &pname)
 {
     assert(m_project);
@@ -469,3 +580,339 @@ int CommandlineDriver::decompile(const QString &fname, const QString &pname)
     LOG_MSG("Completed in %1 hours %2 minutes %3 seconds.", hours, mins, secs);
     return 0;
 }
+
+
+int CommandlineDriver::decompileBatch()
+{
+    std::vector<BatchEntry> entries;
+    if (!readBatchList(m_batchListFile, entries)) {
+        return 1;
+    }
+
+    const QDir outputDir = m_project->getSettings()->getOutputDirectory();
+    if (!QDir().mkpath(outputDir.absolutePath())) {
+        std::cerr << "Cannot create output directory '" << qPrintable(outputDir.absolutePath())
+                  << "'" << std::endl;
+        return 1;
+    }
+
+    assignBatchOutputDirectories(entries, outputDir);
+
+    QElapsedTimer timer;
+    timer.start();
+
+    std::vector<BatchResult> results(entries.size());
+    for (std::size_t i = 0; i < entries.size(); ++i) {
+        results[i].path = entries[i].path;
+    }
+
+    if (m_numBatchJobs > 1 && entries.size() > 1) {
+        decompileBatchWithWorkers(entries, results);
+    }
+    else {
+        m_project->loadPlugins();
+
+        for (std::size_t i = 0; i < entries.size(); ++i) {
+            results[i] = decompileBatchEntry(entries[i]);
+            std::cout << "[" << (i + 1) << "/" << entries.size() << "] "
+                      << qPrintable(results[i].status) << " " << qPrintable(results[i].path)
+                      << std::endl;
+        }
+    }
+
+    writeBatchSummary(results, outputDir);
+
+    const std::size_t numOk = std::count_if(
+        results.begin(), results.end(), [](const BatchResult &res) { return res.status == "ok"; });
+
+    std::cout << "Decompiled " << numOk << " of " << results.size() << " programs in "
+              << timer.elapsed() / 1000.0 << " seconds. Summary written to '"
+              << qPrintable(outputDir.absoluteFilePath("batch-summary.txt")) << "'" << std::endl;
+
+    return numOk == results.size() ? 0 : 1;
+}
+
+
+void CommandlineDriver::decompileBatchWithWorkers(const std::vector<BatchEntry> &entries,
+                                                  std::vector<BatchResult> &results)
+{
+    const std::size_t numWorkers = std::min<std::size_t>(m_numBatchJobs, entries.size());
+
+    std::vector<QProcess *> workers(numWorkers, nullptr);
+    std::vector<int> currentEntry(numWorkers, -1); ///< entry processed by each worker
+    std::vector<QElapsedTimer> entryTimer(numWorkers);
+    std::vector<bool> timedOut(numWorkers, false);
+
+    std::size_t nextEntry  = 0;
+    std::size_t numDone    = 0;
+    std::size_t numRunning = 0;
+    QEventLoop loop;
+
+    auto reportResult = [&](std::size_t w, const BatchResult &result) {
+        results[currentEntry[w]] = result;
+        currentEntry[w]          = -1;
+
+        std::cout << "[" << ++numDone << "/" << entries.size() << "] "
+                  << qPrintable(result.status) << " " << qPrintable(result.path) << std::endl;
+    };
+
+    // Hand the next entry to worker w, or tell it to exit if there are no entries left.
+    auto feedWorker = [&](std::size_t w) {
+        if (nextEntry < entries.size()) {
+            const BatchEntry &entry = entries[nextEntry];
+            currentEntry[w]         = static_cast<int>(nextEntry++);
+            entryTimer[w].start();
+            workers[w]->write((entry.outputDir + "\t" + entry.path + "\n").toUtf8());
+        }
+        else {
+            workers[w]->closeWriteChannel();
+        }
+    };
+
+    std::function<void(std::size_t)> startWorker = [&](std::size_t w) {
+        QProcess *worker = new QProcess();
+        workers[w]       = worker;
+        timedOut[w]      = false;
+        worker->setProcessChannelMode(QProcess::ForwardedErrorChannel);
+
+        this->connect(worker, &QProcess::readyReadStandardOutput, [&, w, worker]() {
+            while (worker->canReadLine()) {
+                const QStringList fields = QString::fromUtf8(worker->readLine())
+                                               .remove('\n')
+                                               .split('\t');
+
+                if (fields.size() != 4 || currentEntry[w] < 0) {
+                    continue; // not a result line
+                }
+
+                BatchResult result;
+                result.status   = fields[0];
+                result.seconds  = fields[1].toDouble();
+                result.numProcs = fields[2].toInt();
+                result.path     = fields[3];
+
+                reportResult(w, result);
+                feedWorker(w);
+            }
+        });
+
+        this->connect(worker, qOverload<int, QProcess::ExitStatus>(&QProcess::finished),
+                      [&, w, worker](int, QProcess::ExitStatus) {
+                          worker->deleteLater();
+                          workers[w] = nullptr;
+                          numRunning--;
+
+                          if (currentEntry[w] >= 0) {
+                              // the worker died while decompiling an entry
+                              BatchResult result;
+                              result.status  = timedOut[w] ? "timeout" : "crashed";
+                              result.seconds = entryTimer[w].elapsed() / 1000.0;
+                              result.path    = entries[currentEntry[w]].path;
+                              reportResult(w, result);
+
+                              if (nextEntry < entries.size()) {
+                                  startWorker(w);
+                              }
+                          }
+
+                          if (numRunning == 0) {
+                              loop.quit();
+                          }
+                      });
+
+        worker->start(QCoreApplication::applicationFilePath(),
+                      QStringList(m_workerArgs) << "--batch-worker");
+
+        if (!worker->waitForStarted()) {
+            std::cerr << "Cannot start batch worker: " << qPrintable(worker->errorString())
+                      << std::endl;
+            worker->disconnect();
+            worker->deleteLater();
+            workers[w] = nullptr;
+            return;
+        }
+
+        numRunning++;
+        feedWorker(w);
+    };
+
+    // The workers stop decompiling by themselves when the time limit (-S) is reached.
+    // Kill workers that are stuck anyway, e.g. while decoding, after twice the time limit.
+    QTimer watchdog;
+    this->connect(&watchdog, &QTimer::timeout, [&]() {
+        for (std::size_t w = 0; w < numWorkers; ++w) {
+            if (workers[w] && currentEntry[w] >= 0 &&
+                entryTimer[w].elapsed() > 2 * 1000 * 60 * minsToStopAfter) {
+                timedOut[w] = true;
+                workers[w]->kill();
+            }
+        }
+    });
+
+    for (std::size_t w = 0; w < numWorkers; ++w) {
+        startWorker(w);
+    }
+
+    if (minsToStopAfter > 0) {
+        watchdog.start(1000);
+    }
+
+    if (numRunning > 0) {
+        loop.exec();
+    }
+}
+
+
+int CommandlineDriver::runBatchWorker()
+{
+    m_project->loadPlugins();
+
+    QTextStream in(stdin);
+    QTextStream out(stdout);
+
+    while (!in.atEnd()) {
+        const QString line = in.readLine();
+        const int sep      = line.indexOf('\t');
+
+        if (sep < 0) {
+            continue;
+        }
+
+        BatchEntry entry;
+        entry.outputDir = line.left(sep);
+        entry.path      = line.mid(sep + 1);
+
+        const BatchResult result = decompileBatchEntry(entry);
+
+        out << result.status << "\t" << result.seconds << "\t" << result.numProcs << "\t"
+            << result.path << "\n";
+        out.flush();
+    }
+
+    return 0;
+}
+
+
+CommandlineDriver::BatchResult CommandlineDriver::decompileBatchEntry(const BatchEntry &entry)
+{
+    QDir().mkpath(entry.outputDir);
+
+    Log &log = Log::getOrCreateLog();
+    log.removeAllSinks();
+    log.addLogSink(
+        std::make_unique<FileLogSink>(QDir(entry.outputDir).absoluteFilePath("boomerang.log")));
+
+    m_project->getSettings()->setOutputDirectory(entry.outputDir);
+
+    if (m_metrics) {
+        m_metrics->reset();
+        m_metrics->setLabel(entry.path);
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+
+    BatchResult result;
+    result.path = entry.path;
+
+    try {
+        const bool ok = decompile(entry.path, QFileInfo(entry.path).baseName()) == 0;
+        result.status = ok ? "ok" : "failed";
+    }
+    catch (const std::exception &e) {
+        LOG_ERROR("Decompiling '%1' failed: %2", entry.path, e.what());
+        result.status = "failed";
+    }
+
+    result.seconds  = timer.elapsed() / 1000.0;
+    result.numProcs = m_project->getProg() ? m_project->getProg()->getNumFunctions() : 0;
+
+    // Keep plugins, SSL dictionaries and signatures for the next binary file
+    m_project->unloadBinaryFile();
+    log.removeAllSinks();
+
+    return result;
+}
+
+
+bool CommandlineDriver::readBatchList(const QString &listFile,
+                                      std::vector<BatchEntry> &entries) const
+{
+    QFile file;
+
+    if (listFile == "-") {
+        if (!file.open(stdin, QFile::ReadOnly | QFile::Text)) {
+            std::cerr << "Cannot read batch list from stdin" << std::endl;
+            return false;
+        }
+    }
+    else {
+        file.setFileName(listFile);
+
+        if (!file.open(QFile::ReadOnly | QFile::Text)) {
+            std::cerr << "Cannot open batch list '" << qPrintable(listFile) << "'" << std::endl;
+            return false;
+        }
+    }
+
+    const QDir wd = m_project->getSettings()->getWorkingDirectory();
+    QTextStream is(&file);
+
+    while (!is.atEnd()) {
+        const QString line = is.readLine().trimmed();
+
+        if (line.isEmpty() || line.startsWith('#')) {
+            continue;
+        }
+
+        BatchEntry entry;
+        entry.path = QFileInfo(wd.absoluteFilePath(line)).absoluteFilePath();
+        entries.push_back(entry);
+    }
+
+    return true;
+}
+
+
+void CommandlineDriver::assignBatchOutputDirectories(std::vector<BatchEntry> &entries,
+                                                     const QDir &outputDir)
+{
+    std::map<QString, int> numOccurrences;
+    for (const BatchEntry &entry : entries) {
+        numOccurrences[QFileInfo(entry.path).fileName()]++;
+    }
+
+    std::map<QString, int> numSeen;
+    for (BatchEntry &entry : entries) {
+        QString dirName = QFileInfo(entry.path).fileName();
+
+        if (numOccurrences[dirName] > 1) {
+            dirName += QString("_%1").arg(++numSeen[dirName]);
+        }
+
+        entry.outputDir = outputDir.absoluteFilePath(dirName) + "/";
+    }
+}
+
+
+bool CommandlineDriver::writeBatchSummary(const std::vector<BatchResult> &results,
+                                          const QDir &outputDir)
+{
+    QFile file(outputDir.absoluteFilePath("batch-summary.txt"));
+
+    if (!file.open(QFile::WriteOnly | QFile::Text)) {
+        std::cerr << "Cannot write batch summary to '" << qPrintable(file.fileName()) << "'"
+                  << std::endl;
+        return false;
+    }
+
+    QTextStream os(&file);
+    os << "# status\tseconds\tprocs\tpath\n";
+
+    for (const BatchResult &result : results) {
+        os << result.status << "\t" << result.seconds << "\t" << result.numProcs << "\t"
+           << result.path << "\n";
+    }
+
+    return true;
+}
@@ -13,10 +13,15 @@
 #include "boomerang-cli/Console.h"
 #include "boomerang-cli/MiniDebugger.h"
 
+#include "boomerang/core/MetricsWatcher.h"
 #include "boomerang/core/Project.h"
 
 #include <QObject>
-#include <QTimer>
+
+#include <vector>
+
+
+class QDir;
 
 
 class CommandlineDriver : public QObject
@@ -57,15 +62,72 @@ private:
      */
     int decompile(const QString &fname, const QString &pname);
 
-public slots:
-    void onCompilationTimeout();
+private:
+    /// A single binary file of a batch.
+    struct BatchEntry
+    {
+        QString path;      ///< absolute path to the binary file
+        QString outputDir; ///< where output for this binary file is generated
+    };
+
+    /// The outcome of decompiling a single binary file of a batch.
+    struct BatchResult
+    {
+        QString status = "skipped"; ///< ok, failed, crashed, timeout or skipped
+        double seconds = 0.0;
+        int numProcs   = 0;
+        QString path;
+    };
+
+    /**
+     * Decompiles all binary files listed in the batch list file (see --batch).
+     * Plugins, SSL dictionaries and signature catalogs are loaded only once
+     * and are re-used for all binary files.
+     * \returns Zero if all binary files were decompiled successfully, nonzero otherwise.
+     */
+    int decompileBatch();
+
+    /**
+     * Decompiles the binary files in \p entries concurrently in worker processes
+     * (see -j). A binary file that crashes its worker or exceeds the time limit (see -S)
+     * is reported as such; the remaining binary files are given to a new worker.
+     */
+    void decompileBatchWithWorkers(const std::vector<BatchEntry> &entries,
+                                   std::vector<BatchResult> &results);
+
+    /**
+     * Worker side of decompileBatchWithWorkers.
+     * Reads one entry per line from stdin and writes one result per line to stdout
+     * until stdin is closed.
+     */
+    int runBatchWorker();
+
+    /// Decompiles a single binary file of a batch in this process.
+    BatchResult decompileBatchEntry(const BatchEntry &entry);
+
+    /// Reads the paths of the binary files to decompile from \p listFile ('-' for stdin).
+    /// Empty lines and lines starting with '#' are ignored.
+    bool readBatchList(const QString &listFile, std::vector<BatchEntry> &entries) const;
+
+    /// Give each entry its own output directory below \p outputDir. Binary files
+    /// with the same file name are numbered in the order they appear in the list.
+    static void assignBatchOutputDirectories(std::vector<BatchEntry> &entries,
+                                             const QDir &outputDir);
+
+    /// Write a summary line for each result to batch-summary.txt in \p outputDir.
+    static bool writeBatchSummary(const std::vector<BatchResult> &results, const QDir &outputDir);
 
 private:
     std::unique_ptr<Project> m_project;
     std::unique_ptr<Console> m_console;
     std::unique_ptr<MiniDebugger> m_debugger;
+    std::unique_ptr<MetricsWatcher> m_metrics; ///< progress reports (--metrics)
 
-    QTimer m_kill_timer;
     int minsToStopAfter = 0;
     QString m_pathToBinary;
+
+    QString m_batchListFile;  ///< list of binary files to decompile (--batch)
+    int m_numBatchJobs = 1;   ///< number of binary files to decompile concurrently (-j)
+    bool m_batchWorker = false;
+    QStringList m_workerArgs; ///< command line switches passed on to batch workers
 };
@@ -35,6 +35,7 @@ Decompiler::Decompiler()
         m_project.getSettings()->getOutputDirectory().absolutePath());
 
     m_project.addWatcher(this);
+    m_project.addWatcher(&m_metrics);
     m_project.loadPlugins();
 }
 
@@ -66,6 +67,7 @@ void Decompiler::removeEntryPoint(Address entryAddr)
 void Decompiler::loadInputFile(const QString &inputFile, const QString &outputPath)
 {
     m_project.getSettings()->setOutputDirectory(outputPath);
+    m_metrics.reset();
     emit loadingStarted();
 
     bool ok = m_project.loadBinaryFile(inputFile);
@@ -136,7 +138,7 @@ void Decompiler::decompile()
 
 void Decompiler::moduleAndChildrenUpdated(Module *root)
 {
-    emit moduleCreated(root->getName());
+    addTreeUpdate(TreeUpdate::ModuleCreated, root->getName());
 
     for (size_t i = 0; i < root->getNumChildren(); i++) {
         moduleAndChildrenUpdated(root->getChild(i));
@@ -163,7 +165,7 @@ void Decompiler::generateCode()
                 continue;
             }
 
-            emit functionAddedToModule(p->getName(), module->getName());
+            addTreeUpdate(TreeUpdate::ProcAddedToModule, p->getName(), module->getName());
         }
     }
 
@@ -174,13 +176,13 @@ void Decompiler::generateCode()
 
 void Decompiler::onFunctionDiscovered(Function *proc)
 {
-    emit procDiscovered("", proc->getName());
+    addTreeUpdate(TreeUpdate::ProcDiscovered, proc->getName());
 }
 
 
 void Decompiler::onDecompileInProgress(UserProc *p)
 {
-    emit procDecompileStarted(p->getName());
+    addTreeUpdate(TreeUpdate::ProcDecompileStarted, p->getName());
 }
 
 
@@ -324,3 +326,30 @@ void Decompiler::getCompoundMembers(const QString &name, QTableWidget *tbl)
                      new QTableWidgetItem(tr("%1").arg(c->getMemberTypeByIdx(i)->getSize())));
     }
 }
+
+
+std::vector<TreeUpdate> Decompiler::takeTreeUpdates()
+{
+    std::lock_guard<std::mutex> lock(m_treeUpdatesMutex);
+
+    std::vector<TreeUpdate> updates;
+    updates.swap(m_treeUpdates);
+    return updates;
+}
+
+
+void Decompiler::addTreeUpdate(TreeUpdate::Kind kind, const QString &name,
+                               const QString &parentName)
+{
+    bool isFirst = false;
+
+    {
+        std::lock_guard<std::mutex> lock(m_treeUpdatesMutex);
+        isFirst = m_treeUpdates.empty();
+        m_treeUpdates.push_back({ kind, name, parentName });
+    }
+
+    if (isFirst) {
+        emit treeUpdatesPending();
+    }
+}
@@ -9,6 +9,7 @@
 #pragma endregion License
 
 
+#include "boomerang/core/MetricsWatcher.h"
 #include "boomerang/core/Project.h"
 #include "boomerang/core/Watcher.h"
 
@@ -16,6 +17,8 @@
 #include <QString>
 #include <QTableWidget>
 
+#include <mutex>
+
 
 class Module;
 class IFrontEnd;
@@ -26,6 +29,23 @@ class BinaryFile;
 Q_DECLARE_METATYPE(Address)
 
 
+/// A change of the procedure tree or the module tree of the GUI, see Decompiler::takeTreeUpdates
+struct TreeUpdate
+{
+    enum Kind
+    {
+        ProcDiscovered,       ///< \ref name was discovered, called by \ref parentName (if any)
+        ProcDecompileStarted, ///< decompilation of \ref name started
+        ModuleCreated,        ///< module \ref name was created
+        ProcAddedToModule     ///< \ref name was added to module \ref parentName
+    };
+
+    Kind kind;
+    QString name;
+    QString parentName;
+};
+
+
 /**
  * Interface between libboomerang and the GUI.
  */
@@ -57,15 +77,13 @@ signals: // Decompiler -> ui
     void decompileCompleted();
     void generateCodeCompleted();
 
-    void procDiscovered(const QString &callerName, const QString &procName);
-    void procDecompileStarted(const QString &procName);
+    /// Emitted when the first of a batch of tree updates is added, see takeTreeUpdates
+    void treeUpdatesPending();
 
     void userProcCreated(const QString &name, Address entryAddr);
     void libProcCreated(const QString &name, const QString &params);
     void userProcRemoved(const QString &name, Address entryAddr);
     void libProcRemoved(const QString &name);
-    void moduleCreated(const QString &name);
-    void functionAddedToModule(const QString &functionName, const QString &moduleName);
     void entryPointAdded(Address entryAddr, const QString &name);
     void sectionAdded(const QString &sectionName, Address start, Address end);
 
@@ -96,7 +114,22 @@ public:
     void setDebugEnabled(bool debug) { m_debugging = debug; }
     Project *getProject() { return &m_project; }
 
+    /// \returns the progress of the current decode or decompilation. Thread safe.
+    DecompilationMetrics getMetrics() const { return m_metrics.getMetrics(); }
+
+    /**
+     * \returns all tree updates since the last call, in order. Thread safe.
+     * Tree updates happen once per procedure and are therefore not signalled individually;
+     * instead, treeUpdatesPending is emitted once per batch, so the GUI can
+     * apply many updates at once.
+     */
+    std::vector<TreeUpdate> takeTreeUpdates();
+
 private:
+    void addTreeUpdate(TreeUpdate::Kind kind, const QString &name,
+                       const QString &parentName = "");
+
+
     /// After code generation, update the list of modules
     void moduleAndChildrenUpdated(Module *root);
 
@@ -105,6 +138,10 @@ protected:
     bool m_waiting   = false;
 
     Project m_project;
+    MetricsWatcher m_metrics;
 
     std::vector<Address> m_userEntrypoints;
+
+    std::mutex m_treeUpdatesMutex;
+    std::vector<TreeUpdate> m_treeUpdates; ///< not yet taken by the GUI
 };
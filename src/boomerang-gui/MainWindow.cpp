@@ -10,6 +10,7 @@
 #include "MainWindow.h"
 
 #include "boomerang-gui/Decompiler.h"
+#include "boomerang-gui/ProcTreeModel.h"
 #include "boomerang-gui/RTLEditor.h"
 #include "boomerang-gui/SettingsDlg.h"
 #include "boomerang-gui/ui_About.h"
@@ -38,9 +39,22 @@ MainWindow::MainWindow(QWidget *_parent)
 
     m_decompilerThread.start();
 
-    connect(m_decompiler, &Decompiler::moduleCreated, this, &MainWindow::showNewCluster);
-    connect(m_decompiler, &Decompiler::functionAddedToModule, this,
-            &MainWindow::showNewProcInCluster);
+    m_metricsTimer.setInterval(500);
+    connect(&m_metricsTimer, &QTimer::timeout, this, &MainWindow::showProgressMetrics);
+
+    // Procedures are discovered and decompiled much faster than the tree views can be updated
+    // one by one, so tree updates are collected for a short time and then applied in a batch.
+    m_treeUpdateTimer.setInterval(100);
+    m_treeUpdateTimer.setSingleShot(true);
+    connect(&m_treeUpdateTimer, &QTimer::timeout, this, &MainWindow::applyTreeUpdates);
+    connect(m_decompiler, &Decompiler::treeUpdatesPending, &m_treeUpdateTimer,
+            static_cast<void (QTimer::*)()>(&QTimer::start));
+
+    m_procTreeModel   = new ProcTreeModel("Name", this);
+    m_moduleTreeModel = new ProcTreeModel("", this);
+    ui->tvProcTree->setModel(m_procTreeModel);
+    ui->tvModuleTree->setModel(m_moduleTreeModel);
+
     connect(m_decompiler, &Decompiler::debugPointHit, this, &MainWindow::showDebuggingPoint);
     connect(m_decompiler, &Decompiler::loadingStarted, this, &MainWindow::showLoadPage);
     connect(m_decompiler, &Decompiler::decodingStarted, this, &MainWindow::showDecodePage);
@@ -54,9 +68,6 @@ MainWindow::MainWindow(QWidget *_parent)
     connect(m_decompiler, &Decompiler::decompileCompleted, this, &MainWindow::decompileComplete);
     connect(m_decompiler, &Decompiler::generateCodeCompleted, this,
             &MainWindow::generateCodeComplete);
-    connect(m_decompiler, &Decompiler::procDiscovered, this, &MainWindow::showConsideringProc);
-    connect(m_decompiler, &Decompiler::procDecompileStarted, this,
-            &MainWindow::showDecompilingProc);
     connect(m_decompiler, &Decompiler::userProcCreated, this, &MainWindow::showNewUserProc);
     connect(m_decompiler, &Decompiler::libProcCreated, this, &MainWindow::showNewLibProc);
     connect(m_decompiler, &Decompiler::userProcRemoved, this, &MainWindow::showRemoveUserProc);
@@ -316,8 +327,8 @@ void MainWindow::showInitPage()
     ui->tblEntryPoints->setRowCount(0);
     ui->tblUserProcs->setRowCount(0);
     ui->tblLibProcs->setRowCount(0);
-    ui->twProcTree->clear();
-    ui->twModuleTree->clear();
+    m_procTreeModel->clear();
+    m_moduleTreeModel->clear();
 
     m_numDecompiledProcs = 0;
     m_numCodeGenProcs    = 0;
@@ -355,6 +366,8 @@ void MainWindow::showDecodePage()
     ui->btnGenerateCode->setEnabled(false);
 
     ui->stackedWidget->setCurrentIndex(2);
+    ui->lblDecodeStatus->setText(tr("Decoding... "));
+    m_metricsTimer.start();
 
     if (!ui->actDebugEnabled->isChecked()) {
         ui->tblUserProcs->removeColumn(2);
@@ -379,6 +392,8 @@ void MainWindow::showDecompilePage()
     ui->btnGenerateCode->setEnabled(false);
 
     ui->stackedWidget->setCurrentIndex(3);
+    ui->lblDecompileStatus->setText(tr("Decompiling... "));
+    m_metricsTimer.start();
 
     ui->actDecompile->setEnabled(true);
 }
@@ -445,6 +460,10 @@ void MainWindow::decodeComplete()
     ui->btnDecompile->setEnabled(false);
     ui->btnGenerateCode->setEnabled(false);
     ui->stackedWidget->setCurrentIndex(2);
+
+    m_metricsTimer.stop();
+    showProgressMetrics();
+    applyTreeUpdates();
 }
 
 
@@ -460,6 +479,10 @@ void MainWindow::decompileComplete()
     ui->btnDecompile->setEnabled(true);
     ui->btnGenerateCode->setEnabled(false);
     ui->stackedWidget->setCurrentIndex(3);
+
+    m_metricsTimer.stop();
+    showProgressMetrics();
+    applyTreeUpdates();
 }
 
 
@@ -476,50 +499,138 @@ void MainWindow::generateCodeComplete()
     ui->btnGenerateCode->setEnabled(false);
 
     ui->stackedWidget->setCurrentIndex(4);
+    applyTreeUpdates();
 }
 
 
-void MainWindow::showConsideringProc(const QString &calledByName, const QString &procName)
+void MainWindow::applyTreeUpdates()
 {
-    QList<QTreeWidgetItem *> foundit = ui->twProcTree->findItems(procName, Qt::MatchExactly |
-                                                                               Qt::MatchRecursive);
+    m_treeUpdateTimer.stop();
 
-    if (foundit.isEmpty()) {
-        QStringList texts(procName);
+    const std::vector<TreeUpdate> updates = m_decompiler->takeTreeUpdates();
+    if (updates.empty()) {
+        return;
+    }
 
-        if (calledByName.isEmpty()) {
-            ui->twProcTree->addTopLevelItem(new QTreeWidgetItem(texts));
-        }
-        else {
-            QList<QTreeWidgetItem *> found = ui->twProcTree->findItems(
-                calledByName, Qt::MatchExactly | Qt::MatchRecursive);
-
-            if (!found.isEmpty()) {
-                QTreeWidgetItem *n = new QTreeWidgetItem(found.first(), texts);
-                n->setData(0, 1, procName);
-                ui->twProcTree->expandItem(found.first());
-                ui->twProcTree->scrollToItem(n);
-                ui->twProcTree->setCurrentItem(n, 0);
+    // Only the last new or decompiled procedure of the batch is made the current item
+    QModelIndex currentProc;
+    QModelIndex currentModuleProc;
+
+    for (const TreeUpdate &update : updates) {
+        switch (update.kind) {
+        case TreeUpdate::ProcDiscovered:
+            if (!m_procTreeModel->findNode(update.name).isValid()) {
+                const QModelIndex n = m_procTreeModel->addNode(update.name, update.parentName);
+
+                if (n.parent().isValid()) {
+                    ui->tvProcTree->expand(n.parent());
+                    currentProc = n;
+                }
             }
+            break;
+
+        case TreeUpdate::ProcDecompileStarted: {
+            const QModelIndex n = m_procTreeModel->findNode(update.name);
+
+            if (n.isValid()) {
+                m_procTreeModel->setHighlighted(n, true);
+                currentProc = n;
+                m_numDecompiledProcs++;
+            }
+        } break;
+
+        case TreeUpdate::ModuleCreated:
+            ui->tvModuleTree->expand(m_moduleTreeModel->addNode(update.name + ".c"));
+            break;
+
+        case TreeUpdate::ProcAddedToModule: {
+            const QModelIndex n = m_moduleTreeModel->addNode(update.name,
+                                                             update.parentName + ".c");
+
+            if (n.isValid()) {
+                ui->tvModuleTree->expand(n.parent());
+                currentModuleProc = n;
+                m_numCodeGenProcs++;
+            }
+        } break;
         }
     }
+
+    if (currentProc.isValid()) {
+        ui->tvProcTree->scrollTo(currentProc);
+        ui->tvProcTree->setCurrentIndex(currentProc);
+    }
+
+    if (currentModuleProc.isValid()) {
+        ui->tvModuleTree->scrollTo(currentModuleProc);
+        ui->tvModuleTree->setCurrentIndex(currentModuleProc);
+    }
+
+    ui->prgDecompile->setRange(0, ui->tblUserProcs->rowCount());
+    ui->prgDecompile->setValue(m_numDecompiledProcs);
+    ui->prgGenerateCode->setRange(0, ui->tblUserProcs->rowCount());
+    ui->prgGenerateCode->setValue(m_numCodeGenProcs);
 }
 
 
-void MainWindow::showDecompilingProc(const QString &name)
+/// Format a number of seconds as [h:]mm:ss
+static QString formatSeconds(double seconds)
 {
-    QList<QTreeWidgetItem *> foundit = ui->twProcTree->findItems(name, Qt::MatchExactly |
-                                                                           Qt::MatchRecursive);
+    const int total        = static_cast<int>(seconds + 0.5);
+    const QString minsSecs = QString("%1:%2")
+                                 .arg((total / 60) % 60, 2, 10, QChar('0'))
+                                 .arg(total % 60, 2, 10, QChar('0'));
 
-    if (!foundit.isEmpty()) {
-        ui->twProcTree->setCurrentItem(foundit.first(), 0);
-        foundit.first()->setTextColor(0, QColor("blue"));
-        m_numDecompiledProcs++;
-    }
+    return total >= 3600 ? QString("%1:%2").arg(total / 3600).arg(minsSecs) : minsSecs;
+}
 
-    const int max = ui->tblUserProcs->rowCount();
-    ui->prgDecompile->setRange(0, max);
-    ui->prgDecompile->setValue(m_numDecompiledProcs);
+
+void MainWindow::showProgressMetrics()
+{
+    const DecompilationMetrics metrics = m_decompiler->getMetrics();
+
+    switch (metrics.phase) {
+    case DecompilationMetrics::Phase::Decoding:
+    case DecompilationMetrics::Phase::Idle: {
+        if (metrics.numInstructionsDecoded == 0) {
+            break; // decoding has not started yet
+        }
+
+        QString text = tr("%1 %2 instructions (%3 instructions/s, %4 KiB/s), %5 procedures")
+                           .arg(metrics.phase == DecompilationMetrics::Phase::Decoding
+                                    ? tr("Decoding...")
+                                    : tr("Decoded"))
+                           .arg(metrics.numInstructionsDecoded)
+                           .arg(metrics.instructionsPerSecond, 0, 'f', 0)
+                           .arg(metrics.bytesPerSecond / 1024.0, 0, 'f', 1)
+                           .arg(metrics.numFunctionsDecoded);
+
+        if (metrics.phase == DecompilationMetrics::Phase::Decoding && metrics.etaSeconds >= 0.0) {
+            text += tr(", at most %1 remaining").arg(formatSeconds(metrics.etaSeconds));
+        }
+
+        ui->lblDecodeStatus->setText(text);
+    } break;
+
+    case DecompilationMetrics::Phase::Decompiling:
+    case DecompilationMetrics::Phase::Finished: {
+        const uint64 numProcs = metrics.numProcsDecompiled + metrics.numProcsRemaining;
+        QString text = tr("%1 %2 of %3 procedures (%4 procedures/s)")
+                           .arg(metrics.phase == DecompilationMetrics::Phase::Decompiling
+                                    ? tr("Decompiling...")
+                                    : tr("Decompiled"))
+                           .arg(metrics.numProcsDecompiled)
+                           .arg(numProcs)
+                           .arg(metrics.procsPerSecond, 0, 'f', 1);
+
+        if (metrics.phase == DecompilationMetrics::Phase::Decompiling &&
+            metrics.etaSeconds >= 0.0) {
+            text += tr(", about %1 remaining").arg(formatSeconds(metrics.etaSeconds));
+        }
+
+        ui->lblDecompileStatus->setText(text);
+    } break;
+    }
 }
 
 
@@ -625,35 +736,6 @@ void MainWindow::showNewSection(const QString &name, Address start, Address end)
 }
 
 
-void MainWindow::showNewCluster(const QString &name)
-{
-    QString cname = name;
-
-    cname              = cname.append(".c");
-    QTreeWidgetItem *n = new QTreeWidgetItem(QStringList(cname));
-    ui->twModuleTree->addTopLevelItem(n);
-    ui->twModuleTree->expandItem(n);
-}
-
-
-void MainWindow::showNewProcInCluster(const QString &name, const QString &moduleName)
-{
-    const QString fileName         = moduleName + ".c";
-    QList<QTreeWidgetItem *> found = ui->twModuleTree->findItems(fileName, Qt::MatchExactly);
-
-    if (!found.isEmpty()) {
-        QTreeWidgetItem *n = new QTreeWidgetItem(found.first(), QStringList(name));
-        ui->twModuleTree->scrollToItem(n);
-        ui->twModuleTree->setCurrentItem(n, 0);
-        ui->twModuleTree->expandItem(found.first());
-        m_numCodeGenProcs++;
-    }
-
-    ui->prgGenerateCode->setRange(0, ui->tblUserProcs->rowCount());
-    ui->prgGenerateCode->setValue(m_numCodeGenProcs);
-}
-
-
 void MainWindow::showDebuggingPoint(const QString &name, const QString &description)
 {
     QString msg = "debugging ";
@@ -722,19 +804,20 @@ void MainWindow::on_tblUserProcs_cellChanged(int row, int column)
 }
 
 
-void MainWindow::on_twModuleTree_itemDoubleClicked(QTreeWidgetItem *item, int column)
+void MainWindow::on_tvModuleTree_doubleClicked(const QModelIndex &index)
 {
-    Q_UNUSED(column);
-    QTreeWidgetItem *top = item;
+    QModelIndex top = index;
 
-    while (top->parent()) {
-        top = top->parent();
+    while (top.parent().isValid()) {
+        top = top.parent();
     }
 
+    const QString topName = top.data().toString();
+
     QTextEdit *n = nullptr;
 
     for (int i = 0; i < ui->tabWidget->count(); i++) {
-        if (ui->tabWidget->tabText(i) == top->text(0)) {
+        if (ui->tabWidget->tabText(i) == topName) {
             n = dynamic_cast<QTextEdit *>(ui->tabWidget->widget(i));
             break;
         }
@@ -742,7 +825,7 @@ void MainWindow::on_twModuleTree_itemDoubleClicked(QTreeWidgetItem *item, int co
 
     if (n == nullptr) {
         n                = new QTextEdit();
-        QString name     = top->text(0);
+        QString name     = topName;
         name             = name.left(name.lastIndexOf("."));
         QString filename = m_decompiler->getClusterFile(name);
         QFile file(filename);
@@ -757,17 +840,16 @@ void MainWindow::on_twModuleTree_itemDoubleClicked(QTreeWidgetItem *item, int co
         n->insertPlainText(contents);
         m_openFiles[n] = filename;
         connect(n, SIGNAL(textChanged()), this, SLOT(currentTabTextChanged()));
-        ui->tabWidget->addTab(n, top->text(0));
+        ui->tabWidget->addTab(n, topName);
     }
 
     ui->tabWidget->setCurrentWidget(n);
 }
 
 
-void MainWindow::on_twProcTree_itemDoubleClicked(QTreeWidgetItem *item, int column)
+void MainWindow::on_tvProcTree_doubleClicked(const QModelIndex &index)
 {
-    Q_UNUSED(column);
-    showRTLEditor(item->text(0));
+    showRTLEditor(index.data().toString());
 }
 
 
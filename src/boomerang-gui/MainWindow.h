@@ -12,7 +12,9 @@
 #include "boomerang/util/Address.h"
 
 #include <QMainWindow>
+#include <QModelIndex>
 #include <QThread>
+#include <QTimer>
 
 #include <map>
 #include <set>
@@ -20,9 +22,9 @@
 
 
 class QToolButton;
-class QTreeWidgetItem;
 class QTableWidgetItem;
 class Decompiler;
+class ProcTreeModel;
 
 
 namespace Ui
@@ -59,22 +61,20 @@ public slots:
     void on_btnOutputPathBrowse_clicked();
     void on_cbInputFile_currentIndexChanged(const QString &text);
     void on_cbOutputPath_currentIndexChanged(const QString &text);
-    void showConsideringProc(const QString &parent, const QString &name);
-    void showDecompilingProc(const QString &name);
+    void applyTreeUpdates();
     void showNewUserProc(const QString &name, Address addr);
     void showNewLibProc(const QString &name, const QString &params);
     void showRemoveUserProc(const QString &name, Address addr);
     void showRemoveLibProc(const QString &name);
     void showNewEntrypoint(Address addr, const QString &name);
     void showMachineType(const QString &machine);
-    void showNewCluster(const QString &name);
-    void showNewProcInCluster(const QString &name, const QString &cluster);
     void showDebuggingPoint(const QString &name, const QString &description);
     void showNewSection(const QString &name, Address start, Address end);
     void showRTLEditor(const QString &name);
+    void showProgressMetrics();
 
-    void on_twModuleTree_itemDoubleClicked(QTreeWidgetItem *item, int column);
-    void on_twProcTree_itemDoubleClicked(QTreeWidgetItem *item, int column);
+    void on_tvModuleTree_doubleClicked(const QModelIndex &index);
+    void on_tvProcTree_doubleClicked(const QModelIndex &index);
     void on_actDebugEnabled_toggled(bool b);
     void on_actDebugStep_triggered();
     void onUserProcsHorizontalHeaderSectionClicked(int logicalIndex);
@@ -126,6 +126,11 @@ private:
 
     QThread m_decompilerThread;
     Decompiler *m_decompiler = nullptr;
+    QTimer m_metricsTimer;    ///< periodically updates the progress while decoding/decompiling
+    QTimer m_treeUpdateTimer; ///< delays tree updates, so they can be applied in batches
+
+    ProcTreeModel *m_procTreeModel   = nullptr;
+    ProcTreeModel *m_moduleTreeModel = nullptr;
 
     bool m_loadingSettings   = false;
     int m_numDecompiledProcs = 0;
@@ -0,0 +1,174 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "ProcTreeModel.h"
+
+#include <QBrush>
+
+
+ProcTreeModel::ProcTreeModel(const QString &header, QObject *parent)
+    : QAbstractItemModel(parent)
+    , m_header(header)
+{
+}
+
+
+ProcTreeModel::~ProcTreeModel()
+{
+}
+
+
+QModelIndex ProcTreeModel::index(int row, int column, const QModelIndex &parent) const
+{
+    const Node *parentNode = nodeOf(parent);
+
+    if (column != 0 || row < 0 || row >= static_cast<int>(parentNode->children.size())) {
+        return QModelIndex();
+    }
+
+    return createIndex(row, column, parentNode->children[row].get());
+}
+
+
+QModelIndex ProcTreeModel::parent(const QModelIndex &child) const
+{
+    if (!child.isValid()) {
+        return QModelIndex();
+    }
+
+    return indexOf(nodeOf(child)->parent);
+}
+
+
+int ProcTreeModel::rowCount(const QModelIndex &parent) const
+{
+    if (parent.column() > 0) {
+        return 0;
+    }
+
+    return static_cast<int>(nodeOf(parent)->children.size());
+}
+
+
+int ProcTreeModel::columnCount(const QModelIndex &parent) const
+{
+    Q_UNUSED(parent);
+    return 1;
+}
+
+
+QVariant ProcTreeModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid()) {
+        return QVariant();
+    }
+
+    const Node *node = nodeOf(index);
+
+    if (role == Qt::DisplayRole) {
+        return node->name;
+    }
+    else if (role == Qt::ForegroundRole && node->highlighted) {
+        return QBrush(Qt::blue);
+    }
+
+    return QVariant();
+}
+
+
+QVariant ProcTreeModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (section != 0 || orientation != Qt::Horizontal || role != Qt::DisplayRole) {
+        return QVariant();
+    }
+
+    return m_header;
+}
+
+
+void ProcTreeModel::clear()
+{
+    beginResetModel();
+    m_nodes.clear();
+    m_root.children.clear();
+    endResetModel();
+}
+
+
+QModelIndex ProcTreeModel::addNode(const QString &name, const QString &parentName)
+{
+    auto it = m_nodes.find(name);
+    if (it != m_nodes.end()) {
+        return indexOf(it.value());
+    }
+
+    Node *parentNode = &m_root;
+
+    if (!parentName.isEmpty()) {
+        parentNode = m_nodes.value(parentName, nullptr);
+
+        if (!parentNode) {
+            return QModelIndex();
+        }
+    }
+
+    const int row = static_cast<int>(parentNode->children.size());
+    beginInsertRows(indexOf(parentNode), row, row);
+
+    std::unique_ptr<Node> node(new Node);
+    node->name   = name;
+    node->parent = parentNode;
+    node->row    = row;
+
+    m_nodes.insert(name, node.get());
+    parentNode->children.push_back(std::move(node));
+
+    endInsertRows();
+    return createIndex(row, 0, parentNode->children.back().get());
+}
+
+
+QModelIndex ProcTreeModel::findNode(const QString &name) const
+{
+    return indexOf(m_nodes.value(name, nullptr));
+}
+
+
+void ProcTreeModel::setHighlighted(const QModelIndex &index, bool highlighted)
+{
+    if (!index.isValid()) {
+        return;
+    }
+
+    Node *node = nodeOf(index);
+    if (node->highlighted != highlighted) {
+        node->highlighted = highlighted;
+        emit dataChanged(index, index, { Qt::ForegroundRole });
+    }
+}
+
+
+QModelIndex ProcTreeModel::indexOf(const Node *node) const
+{
+    if (!node || node == &m_root) {
+        return QModelIndex();
+    }
+
+    return createIndex(node->row, 0, const_cast<Node *>(node));
+}
+
+
+ProcTreeModel::Node *ProcTreeModel::nodeOf(const QModelIndex &index) const
+{
+    if (!index.isValid()) {
+        return const_cast<Node *>(&m_root);
+    }
+
+    return static_cast<Node *>(index.internalPointer());
+}
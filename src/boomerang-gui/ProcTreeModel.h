@@ -0,0 +1,92 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include <QAbstractItemModel>
+#include <QHash>
+#include <QString>
+
+#include <memory>
+#include <vector>
+
+
+/**
+ * A tree of uniquely named nodes (e.g. procedures, or modules and their procedures)
+ * for display in a QTreeView.
+ * Nodes are looked up by name in constant time, so adding and updating nodes
+ * does not depend on the size of the tree.
+ */
+class ProcTreeModel : public QAbstractItemModel
+{
+    Q_OBJECT
+
+public:
+    ProcTreeModel(const QString &header, QObject *parent = nullptr);
+    ~ProcTreeModel() override;
+
+public:
+    /// \copydoc QAbstractItemModel::index
+    QModelIndex index(int row, int column,
+                      const QModelIndex &parent = QModelIndex()) const override;
+
+    /// \copydoc QAbstractItemModel::parent
+    QModelIndex parent(const QModelIndex &child) const override;
+
+    /// \copydoc QAbstractItemModel::rowCount
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+
+    /// \copydoc QAbstractItemModel::columnCount
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+
+    /// \copydoc QAbstractItemModel::data
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+    /// \copydoc QAbstractItemModel::headerData
+    QVariant headerData(int section, Qt::Orientation orientation,
+                        int role = Qt::DisplayRole) const override;
+
+public:
+    /// Remove all nodes.
+    void clear();
+
+    /**
+     * Add a node named \p name as the last child of the node named \p parentName,
+     * or as a top level node if \p parentName is empty.
+     * \returns the index of the new node, or of the existing node named \p name.
+     * If there is no node named \p parentName, nothing is added and
+     * an invalid index is returned.
+     */
+    QModelIndex addNode(const QString &name, const QString &parentName = "");
+
+    /// \returns the index of the node named \p name, or an invalid index if not found.
+    QModelIndex findNode(const QString &name) const;
+
+    /// Show the node at \p index highlighted or not.
+    void setHighlighted(const QModelIndex &index, bool highlighted);
+
+private:
+    struct Node
+    {
+        QString name;
+        Node *parent     = nullptr;
+        int row          = 0; ///< index of this node in the children of the parent
+        bool highlighted = false;
+        std::vector<std::unique_ptr<Node>> children;
+    };
+
+    QModelIndex indexOf(const Node *node) const;
+    Node *nodeOf(const QModelIndex &index) const;
+
+private:
+    QString m_header;
+    Node m_root;
+    QHash<QString, Node *> m_nodes; ///< all nodes except the root, by name
+};
@@ -21,6 +21,11 @@
 #include <QBuffer>
 #include <QFile>
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
 
 struct SectionParam
 {
@@ -40,6 +45,7 @@ struct SectionParam
 // anonymous_namespace::Translated_ElfSym vs. ElfTypes.h/Translated_ElfSym declarations
 struct Translated_ElfSym
 {
+    bool HasName = false; ///< false for symbols without a name (name index 0)
     QString Name;
     ElfSymType Type;
     ElfSymBinding Binding;
@@ -51,6 +57,12 @@ struct Translated_ElfSym
 
 typedef std::map<QString, int, std::less<QString>> StrIntMap;
 
+/// Symbol tables with at least this many symbols are translated on multiple threads
+static constexpr int MIN_PARALLEL_SYMBOLS = 16384;
+
+/// Number of symbols a thread translates at once
+static constexpr int SYMBOL_CHUNK_SIZE = 4096;
+
 
 ElfBinaryLoader::ElfBinaryLoader()
     : m_nextExtern(Address::ZERO)
@@ -378,7 +390,7 @@ void ElfBinaryLoader::unload()
 }
 
 
-const char *ElfBinaryLoader::getStrPtr(int sectionIdx, int offset)
+const char *ElfBinaryLoader::getStrPtr(int sectionIdx, int offset) const
 {
     if (sectionIdx < 0) {
         // Most commonly, this will be an index of -1, because a call to GetSectionIndexByName()
@@ -400,15 +412,16 @@ const char *ElfBinaryLoader::getStrPtr(int sectionIdx, int offset)
 }
 
 
-Address ElfBinaryLoader::findRelPltOffset(int i)
+Address ElfBinaryLoader::findRelPltOffset(int i) const
 {
-    const BinarySection *siPlt    = m_binaryImage->getSectionByName(".plt");
+    const BinaryImage *image      = m_binaryImage;
+    const BinarySection *siPlt    = image->getSectionByName(".plt");
     Address addrPlt               = siPlt ? siPlt->getSourceAddr() : Address::ZERO;
-    const BinarySection *siRelPlt = m_binaryImage->getSectionByName(".rel.plt");
+    const BinarySection *siRelPlt = image->getSectionByName(".rel.plt");
     int sizeRelPlt                = sizeof(Elf32_Rel); // Size of each entry in the .rel.plt table
 
     if (siRelPlt == nullptr) {
-        siRelPlt   = m_binaryImage->getSectionByName(".rela.plt");
+        siRelPlt   = image->getSectionByName(".rela.plt");
         sizeRelPlt = sizeof(Elf32_Rela); // Size of each entry in the .rela.plt table is 12 bytes
     }
 
@@ -443,8 +456,7 @@ Address ElfBinaryLoader::findRelPltOffset(int i)
         const int entryType = entry & 0xFF;
 
         if (sym == i) {
-            const BinarySection *targetSect = m_binaryImage->getSectionByAddr(
-                Address(elfRead4(pltEntry)));
+            const BinarySection *targetSect = image->getSectionByAddr(Address(elfRead4(pltEntry)));
 
             if (targetSect) {
                 if (targetSect->getName().contains("got")) {
@@ -478,12 +490,27 @@ Address ElfBinaryLoader::findRelPltOffset(int i)
 }
 
 
-void ElfBinaryLoader::processSymbol(Translated_ElfSym &sym, int e_type, int i,
-                                    const QString &currentFile)
+void ElfBinaryLoader::translateSymbol(int i, int strSectionIdx, SWord e_type,
+                                      const BinarySection *siPlt, Translated_ElfSym &sym) const
 {
-    bool imported              = sym.SectionIdx == SHT_NULL;
-    bool local                 = sym.Binding == STB_LOCAL || sym.Binding == STB_WEAK;
-    const BinarySection *siPlt = m_binaryImage->getSectionByName(".plt");
+    const int nameIdx = elfRead4(&m_symbolSection[i].st_name);
+
+    if (nameIdx == 0) { /* Silly symbols with no names */
+        sym.HasName = false;
+        return;
+    }
+
+    const QString symbolName = getStrPtr(strSectionIdx, nameIdx);
+
+    sym.HasName    = true;
+    // Hack off the "@@GLIBC_2.0" of Linux, if present
+    sym.Name       = symbolName.left(symbolName.indexOf("@@"));
+    sym.Type       = ELF32_ST_TYPE(m_symbolSection[i].st_info);
+    sym.Binding    = ELF32_ST_BIND(m_symbolSection[i].st_info);
+    sym.Visibility = ELF32_ST_VISIBILITY(m_symbolSection[i].st_other);
+    sym.SymbolSize = ELF32_ST_VISIBILITY(m_symbolSection[i].st_size);
+    sym.SectionIdx = elfRead2(&m_symbolSection[i].st_shndx);
+    sym.Value      = Address(elfRead4(&m_symbolSection[i].st_value));
 
     if (sym.Value.isZero() && siPlt) { // && i < max_i_for_hack) {
         // Special hack for gcc circa 3.3.3: (e.g. test/pentium/settest).  The value in the dynamic
@@ -498,45 +525,31 @@ void ElfBinaryLoader::processSymbol(Translated_ElfSym &sym, int e_type, int i,
             sym.Value += m_elfSections[sym.SectionIdx].SourceAddr;
         }
     }
+}
 
-    // try to find given symbol, if it has Value of 0, try to use the name.
-    const BinarySymbol *symbol = sym.Value.isZero() ? m_symbols->findSymbolByName(sym.Name)
-                                                    : m_symbols->findSymbolByAddress(sym.Value);
 
-    // Ensure no overwriting (except functions)
-    if (symbol != nullptr) { // TODO: if symbol already exists
-        return;
-    }
-    else if (sym.Binding == STB_WEAK && sym.Type == STT_NOTYPE) {
-        return;
+bool ElfBinaryLoader::isSymbolToAdd(const Translated_ElfSym &sym) const
+{
+    if (sym.Binding == STB_WEAK && sym.Type == STT_NOTYPE) {
+        return false;
     }
     else if (sym.Type == STT_FILE) {
-        return;
+        return false;
     }
     else if (sym.Name.isEmpty()) {
-        return;
+        return false;
     }
 
     if (sym.Value.isZero()) {
-        LOG_WARN("Skipping symbol %1 with unknown location", sym.Name);
-        return;
-    }
-
-    // TODO: add more symbol information here (function/export etc. ) ?
-    BinarySymbol *new_symbol(m_symbols->createSymbol(sym.Value, sym.Name, local));
-    new_symbol->setSize(elfRead4(&m_symbolSection[i].st_size));
-
-    if (imported) {
-        new_symbol->setAttribute("Imported", true);
-    }
+        // try to use the name of the symbol
+        if (m_symbols->findSymbolByName(sym.Name) == nullptr) {
+            LOG_WARN("Skipping symbol %1 with unknown location", sym.Name);
+        }
 
-    if (sym.Type == STT_FUNC) {
-        new_symbol->setAttribute("Function", true);
+        return false;
     }
 
-    if (!currentFile.isEmpty()) {
-        new_symbol->setAttribute("SourceFile", currentFile);
-    }
+    return true;
 }
 
 
@@ -573,29 +586,60 @@ void ElfBinaryLoader::addSymbolsForSection(int secIndex)
         return; // cannot read symbol name from invalid string section
     }
 
-    const int numSymbols = section.Size / section.entry_size;
-    QString fileName;
+    const int numSymbols       = section.Size / section.entry_size;
+    const BinarySection *siPlt = m_binaryImage->getSectionByName(".plt");
 
+    // Translating the symbols (reading the names, searching the PLT) does not modify
+    // the symbol table, so for large symbol tables, it is done in parallel.
     // Index 0 is a dummy entry
+    std::vector<Translated_ElfSym> translatedSyms(numSymbols);
+
+    auto translateRange = [&](int from, int to) {
+        for (int i = std::max(from, 1); i < to; i++) {
+            translateSymbol(i, strSectionIdx, symbolType, siPlt, translatedSyms[i]);
+        }
+    };
+
+    const int numChunks  = (numSymbols + SYMBOL_CHUNK_SIZE - 1) / SYMBOL_CHUNK_SIZE;
+    const int numThreads = std::min(numChunks,
+                                    static_cast<int>(std::thread::hardware_concurrency()));
+
+    if (numSymbols < MIN_PARALLEL_SYMBOLS || numThreads <= 1) {
+        translateRange(0, numSymbols);
+    }
+    else {
+        std::atomic<int> nextChunk(0);
+        std::vector<std::thread> workers;
+        workers.reserve(numThreads);
+
+        for (int t = 0; t < numThreads; ++t) {
+            workers.emplace_back([&translateRange, &nextChunk, numChunks, numSymbols]() {
+                int chunk;
+                while ((chunk = nextChunk++) < numChunks) {
+                    translateRange(chunk * SYMBOL_CHUNK_SIZE,
+                                   std::min(numSymbols, (chunk + 1) * SYMBOL_CHUNK_SIZE));
+                }
+            });
+        }
+
+        for (std::thread &worker : workers) {
+            worker.join();
+        }
+    }
+
+    // The source file of a symbol depends on the symbols before it, so this is done in order.
+    std::vector<BinarySymbolDefinition> definitions;
+    std::vector<int> definitionSymIdx;    // symbol index of each definition
+    std::vector<QString> definitionFiles; // source file of each definition
+    QString fileName;
+
     for (int i = 1; i < numSymbols; i++) {
-        Translated_ElfSym translatedSym;
-        Address val = Address(elfRead4(&m_symbolSection[i].st_value));
-        int nameIdx = elfRead4(&m_symbolSection[i].st_name);
+        const Translated_ElfSym &translatedSym = translatedSyms[i];
 
-        if (nameIdx == 0) { /* Silly symbols with no names */
+        if (!translatedSym.HasName) {
             continue;
         }
 
-        const QString symbolName = getStrPtr(strSectionIdx, nameIdx);
-        // Hack off the "@@GLIBC_2.0" of Linux, if present
-        translatedSym.Name       = symbolName.left(symbolName.indexOf("@@"));
-        translatedSym.Type       = ELF32_ST_TYPE(m_symbolSection[i].st_info);
-        translatedSym.Binding    = ELF32_ST_BIND(m_symbolSection[i].st_info);
-        translatedSym.Visibility = ELF32_ST_VISIBILITY(m_symbolSection[i].st_other);
-        translatedSym.SymbolSize = ELF32_ST_VISIBILITY(m_symbolSection[i].st_size);
-        translatedSym.SectionIdx = elfRead2(&m_symbolSection[i].st_shndx);
-        translatedSym.Value      = val;
-
         if (translatedSym.Type == STT_FILE) {
             fileName = translatedSym.Name;
         }
@@ -605,7 +649,42 @@ void ElfBinaryLoader::addSymbolsForSection(int secIndex)
             fileName.clear();
         }
 
-        processSymbol(translatedSym, symbolType, i, fileName);
+        if (isSymbolToAdd(translatedSym)) {
+            const bool local = translatedSym.Binding == STB_LOCAL ||
+                               translatedSym.Binding == STB_WEAK;
+
+            definitions.push_back({ translatedSym.Value, translatedSym.Name, local });
+            definitionSymIdx.push_back(i);
+            definitionFiles.push_back(fileName);
+        }
+    }
+
+    // Symbols with the name of an existing symbol become aliases of the existing symbol.
+    const std::vector<BinarySymbol *> newSymbols = m_symbols->createSymbols(definitions);
+
+    for (std::size_t j = 0; j < newSymbols.size(); j++) {
+        BinarySymbol *newSymbol = newSymbols[j];
+        if (newSymbol == nullptr) {
+            continue; // there already is a symbol at this address
+        }
+
+        const int i                            = definitionSymIdx[j];
+        const Translated_ElfSym &translatedSym = translatedSyms[i];
+
+        // TODO: add more symbol information here (function/export etc. ) ?
+        newSymbol->setSize(elfRead4(&m_symbolSection[i].st_size));
+
+        if (translatedSym.SectionIdx == SHT_NULL) {
+            newSymbol->setAttribute("Imported", true);
+        }
+
+        if (translatedSym.Type == STT_FUNC) {
+            newSymbol->setAttribute("Function", true);
+        }
+
+        if (!definitionFiles[j].isEmpty()) {
+            newSymbol->setAttribute("SourceFile", definitionFiles[j]);
+        }
     }
 
     const Address addressOfMain = getMainEntryPoint();
@@ -1153,5 +1232,11 @@ int ElfBinaryLoader::canLoad(QIODevice &fl) const
 }
 
 
+std::vector<FileSignature> ElfBinaryLoader::getSignatures() const
+{
+    return { { 0, QByteArray("\x7F" "ELF") } };
+}
+
+
 BOOMERANG_LOADER_PLUGIN(ElfBinaryLoader, "ELF32 loader plugin", BOOMERANG_VERSION,
                         "Boomerang developers")
@@ -13,6 +13,8 @@
 #include "boomerang/ifc/IFileLoader.h"
 #include "boomerang/util/ByteUtil.h"
 
+#include <map>
+
 struct Elf32_Ehdr;
 struct Elf32_Phdr;
 struct Elf32_Shdr;
@@ -42,6 +44,9 @@ public:
     /// \copydoc IFileLoader::canLoad
     int canLoad(QIODevice &fl) const override;
 
+    /// \copydoc IFileLoader::getSignatures
+    std::vector<FileSignature> getSignatures() const override;
+
     /// \copydoc IFileLoader::loadFromMemory
     /// Note that empty sections will not be added to the image.
     bool loadFromMemory(QByteArray &img) override;
@@ -85,7 +90,7 @@ private:
     /// Not meant to be used externally, but sometimes you just have to have it.
     /// Like a replacement for elf_strptr().
     /// If the string pointer could not be found, this function returns nullptr.
-    const char *getStrPtr(int sectionIdx, int offset); // Calc string pointer
+    const char *getStrPtr(int sectionIdx, int offset) const; // Calc string pointer
 
 
     /// FIXME: the below assumes a fixed delta
@@ -104,7 +109,7 @@ private:
     /// If found, return the native address of the associated PLT entry.
     /// A linear search will be needed. However, starting at offset i and searching backwards with
     /// wraparound should typically minimise the number of entries to search
-    Address findRelPltOffset(int i);
+    Address findRelPltOffset(int i) const;
 
     // Internal elf reading methods // TODO replace by Util::swapEndian
 
@@ -124,7 +129,17 @@ private:
      */
     void markImports();
 
-    void processSymbol(Translated_ElfSym &sym, int e_type, int i, const QString &currentFile = "");
+    /**
+     * Read the symbol with index \p i of the current symbol section into \p sym,
+     * including its address (which might require searching the PLT).
+     * Does not modify the loader or the symbol table, so it can be called concurrently.
+     */
+    void translateSymbol(int i, int strSectionIdx, SWord e_type, const BinarySection *siPlt,
+                         Translated_ElfSym &sym) const;
+
+    /// \returns false if the symbol \p sym must not be added to the symbol table,
+    /// e.g. because it is a file symbol or its location is unknown.
+    bool isSymbolToAdd(const Translated_ElfSym &sym) const;
 
 private:
     size_t m_loadedImageSize = 0;       ///< Size of image in bytes
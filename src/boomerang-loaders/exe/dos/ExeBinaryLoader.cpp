@@ -160,20 +160,21 @@ bool ExeBinaryLoader::loadFromMemory(QByteArray &data)
         LOG_ERROR("Cannot read Exe file: Invalid image size.");
         return false;
     }
-
-    /* Allocate a block of memory for the image. */
-    m_imageSize   = cb;
-    m_loadedImage = new uint8_t[m_imageSize];
-
-    if (cb != fp.read(reinterpret_cast<char *>(m_loadedImage), cb)) {
+    else if (fp.pos() + cb > data.size()) {
         LOG_ERROR("Cannot read Exe file: Failed to read loaded image");
         return false;
     }
 
+    /* The load module is contiguous in the file, so the image is not copied,
+     * but refers to the file contents directly. */
+    m_imageSize   = cb;
+    m_loadedImage = reinterpret_cast<Byte *>(data.data()) + fp.pos();
+
     /* Relocate segment constants */
     for (int i = 0; i < m_numReloc; i++) {
         const DWord fileOffset = m_relocTable[i];
-        if (!Util::inRange(fileOffset, sizeof(ExeHeader), (DWord)data.size())) {
+        if (!Util::inRange(fileOffset, sizeof(ExeHeader), (DWord)data.size()) ||
+            fileOffset + sizeof(SWord) > (DWord)m_imageSize) {
             LOG_WARN("Cannot read Exe relocation entry %1: Offset %2 is not valid", i, fileOffset);
             continue;
         }
@@ -216,7 +217,9 @@ bool ExeBinaryLoader::loadFromMemory(QByteArray &data)
 void ExeBinaryLoader::unload()
 {
     delete m_header;
-    delete[] m_loadedImage;
+
+    // The image is owned by the BinaryImage
+    m_loadedImage = nullptr;
 }
 
 
@@ -269,5 +272,11 @@ int ExeBinaryLoader::canLoad(QIODevice &fl) const
 }
 
 
+std::vector<FileSignature> ExeBinaryLoader::getSignatures() const
+{
+    return { { 0, QByteArray("MZ") } };
+}
+
+
 BOOMERANG_LOADER_PLUGIN(ExeBinaryLoader, "DOS Exe loader plugin", BOOMERANG_VERSION,
                         "Boomerang developers")
@@ -78,6 +78,9 @@ public:
     /// \copydoc IFileLoader::canLoad
     int canLoad(QIODevice &fl) const override;
 
+    /// \copydoc IFileLoader::getSignatures
+    std::vector<FileSignature> getSignatures() const override;
+
     /// \copydoc IFileLoader::loadFromMemory
     bool loadFromMemory(QByteArray &data) override;
 
@@ -386,6 +386,12 @@ int DOS4GWBinaryLoader::canLoad(QIODevice &fl) const
 }
 
 
+std::vector<FileSignature> DOS4GWBinaryLoader::getSignatures() const
+{
+    return { { 0, QByteArray("MZ") } };
+}
+
+
 // Clean up and unload the binary image
 void DOS4GWBinaryLoader::unload()
 {
@@ -43,6 +43,9 @@ namespace dbghelp
 #include <QFile>
 #include <QString>
 
+#include <algorithm>
+#include <vector>
+
 
 extern "C"
 {
@@ -598,6 +601,101 @@ void Win32BinaryLoader::readDebugData(QString exename)
 
 #define DOS_HEADER_SIZE 0x3C
 
+
+/**
+ * Lay out the headers and sections of the PE file in \p data as they are mapped into memory,
+ * and replace the file contents in \p data by the image.
+ * This way, the file contents are not kept in memory in addition to the image.
+ *
+ * If the sections are stored in the file in the same order as in the image, and no section
+ * is stored at a larger offset in the file than in the image (which is the case when the file
+ * alignment is not larger than the section alignment), the sections are moved to their location
+ * inside the file buffer. Otherwise, the image is built in a new buffer.
+ * Bytes of the image not covered by the headers or initialized section data are zero.
+ */
+static void layOutImage(QByteArray &data, DWord imageSize, DWord headerSize,
+                        const std::vector<PEObject> &objects)
+{
+    struct Extent
+    {
+        DWord rva;      ///< offset in the image
+        DWord size;     ///< size in the image
+        DWord physOff;  ///< offset in the file
+        DWord copySize; ///< number of bytes initialized from the file
+    };
+
+    const DWord fileSize = data.size();
+    std::vector<Extent> extents;
+    extents.reserve(objects.size());
+
+    for (const PEObject &o : objects) {
+        Extent e;
+        e.rva     = READ4_LE(o.RVA);
+        e.size    = READ4_LE(o.VirtualSize);
+        e.physOff = READ4_LE(o.PhysicalOffset);
+
+        // FIXME Using std::min fixes the crash but does not solve the root issue.
+        // This needs further consideration.
+        e.copySize = std::min<DWord>(READ4_LE(o.PhysicalSize), e.size);
+        e.copySize = (e.physOff < fileSize) ? std::min(e.copySize, fileSize - e.physOff) : 0;
+
+        extents.push_back(e);
+    }
+
+    std::sort(extents.begin(), extents.end(),
+              [](const Extent &a, const Extent &b) { return a.rva < b.rva; });
+
+    bool inPlace   = true;
+    QWord imageEnd = headerSize; // end of the previous section in the image
+    QWord fileEnd  = headerSize; // end of the previous section in the file
+
+    for (const Extent &e : extents) {
+        if (e.rva < imageEnd || (e.copySize > 0 && (e.physOff < fileEnd || e.physOff > e.rva))) {
+            inPlace = false;
+            break;
+        }
+
+        imageEnd = QWord(e.rva) + e.size;
+        fileEnd  = e.copySize > 0 ? QWord(e.physOff) + e.copySize : fileEnd;
+    }
+
+    if (!inPlace) {
+        QByteArray image(imageSize, 0);
+        memcpy(image.data(), data.constData(), headerSize);
+
+        for (const Extent &e : extents) {
+            memcpy(image.data() + e.rva, data.constData() + e.physOff, e.copySize);
+        }
+
+        data.swap(image);
+        return;
+    }
+
+    // No section is moved to a lower offset, so move the last section first.
+    data.resize(imageSize);
+    char *image = data.data();
+
+    for (auto it = extents.rbegin(); it != extents.rend(); ++it) {
+        if (it->copySize > 0 && it->rva != it->physOff) {
+            memmove(image + it->rva, image + it->physOff, it->copySize);
+        }
+    }
+
+    DWord end = headerSize;
+    for (const Extent &e : extents) {
+        if (e.rva > end) {
+            memset(image + end, 0, e.rva - end);
+        }
+
+        end = std::max(end, e.rva + e.copySize);
+    }
+
+    if (end < imageSize) {
+        memset(image + end, 0, imageSize - end);
+    }
+}
+
+
 bool Win32BinaryLoader::loadFromMemory(QByteArray &arr)
 {
     const char *fileData = arr.constData();
@@ -607,6 +705,10 @@ bool Win32BinaryLoader::loadFromMemory(QByteArray &arr)
         LOG_ERROR("Invalid PE: File size too small");
         return false;
     }
+    else if (!Util::testMagic(reinterpret_cast<const Byte *>(fileData), { 'M', 'Z' })) {
+        LOG_ERROR("Invalid PE: Bad magic");
+        return false;
+    }
 
     DWord peHeaderOffset = Util::readDWord(fileData + DOS_HEADER_SIZE, Endian::Little);
     if (peHeaderOffset + sizeof(PEHeader) > fileSize) {
@@ -615,71 +717,77 @@ bool Win32BinaryLoader::loadFromMemory(QByteArray &arr)
     }
 
     const PEHeader *peHdr = reinterpret_cast<const PEHeader *>(fileData + peHeaderOffset);
-
-    try {
-        const DWord imageSize = READ4_LE(peHdr->ImageSize);
-        m_image               = new char[imageSize];
-        m_imageSize           = imageSize;
-    }
-    catch (const std::bad_alloc &) {
-        LOG_ERROR("Cannot allocate memory for copy of image");
+    if (!Util::testMagic(reinterpret_cast<const Byte *>(peHdr), { 'P', 'E' })) {
+        LOG_ERROR("Invalid PE: Bad PE magic");
         return false;
     }
 
+    const DWord imageSize     = READ4_LE(peHdr->ImageSize);
     const DWord dosHeaderSize = READ4_LE(peHdr->HeaderSize);
     if (dosHeaderSize >= fileSize) {
         LOG_ERROR("Invalid PE: DOS header extends past file boundary");
         return false;
     }
+    else if (dosHeaderSize > imageSize || peHeaderOffset + sizeof(PEHeader) > dosHeaderSize) {
+        LOG_ERROR("Invalid PE: Invalid header size");
+        return false;
+    }
 
-    memcpy(m_image, fileData, dosHeaderSize);
-    m_header = reinterpret_cast<Header *>(m_image);
+    const SWord ntHeaderSize  = Util::readWord(&peHdr->NtHdrSize, Endian::Little);
+    const DWord numSections   = Util::readWord(&peHdr->numObjects, Endian::Little);
+    const QWord objectsOffset = QWord(peHeaderOffset) + ntHeaderSize + 24;
 
-    if (!Util::testMagic((Byte *)m_header, { 'M', 'Z' })) {
-        LOG_ERROR("Invalid PE: Bad magic");
+    if (objectsOffset + numSections * sizeof(PEObject) > dosHeaderSize) {
+        LOG_ERROR("Invalid PE: Section table extends past header boundary");
         return false;
     }
 
-    m_peHeader = reinterpret_cast<PEHeader *>(m_image + peHeaderOffset);
-    if (!Util::testMagic((Byte *)m_peHeader, { 'P', 'E' })) {
-        LOG_ERROR("Invalid PE: Bad PE magic");
+    const PEObject *o = reinterpret_cast<const PEObject *>(fileData + objectsOffset);
+    const std::vector<PEObject> objects(o, o + numSections);
+
+    for (const PEObject &obj : objects) {
+        if (QWord(READ4_LE(obj.RVA)) + READ4_LE(obj.VirtualSize) > imageSize) {
+            LOG_ERROR("Invalid PE: Section extends past image boundary");
+            return false;
+        }
+    }
+
+    try {
+        layOutImage(arr, imageSize, dosHeaderSize, objects);
+    }
+    catch (const std::bad_alloc &) {
+        LOG_ERROR("Cannot allocate memory for image");
         return false;
     }
 
-    const SWord ntHeaderSize = Util::readWord(&m_peHeader->NtHdrSize, Endian::Little);
-    const PEObject *o = reinterpret_cast<const PEObject *>((Byte *)(m_peHeader) + ntHeaderSize +
-                                                           24);
+    // arr now contains the image instead of the file
+    m_image     = arr.data();
+    m_imageSize = imageSize;
+    m_header    = reinterpret_cast<Header *>(m_image);
+    m_peHeader  = reinterpret_cast<PEHeader *>(m_image + peHeaderOffset);
 
     std::vector<SectionParam> params;
 
-    const DWord numSections = Util::readWord(&m_peHeader->numObjects, Endian::Little);
-
-    for (DWord i = 0; i < numSections; i++, o++) {
-        const DWord rva      = READ4_LE(o->RVA);
-        const DWord size     = READ4_LE(o->VirtualSize);
-        const DWord physOff  = READ4_LE(o->PhysicalOffset);
-        const DWord physSize = READ4_LE(o->PhysicalSize);
+    for (const PEObject &obj : objects) {
+        const DWord rva      = READ4_LE(obj.RVA);
+        const DWord size     = READ4_LE(obj.VirtualSize);
+        const DWord physSize = READ4_LE(obj.PhysicalSize);
 
         SectionParam sect;
         // TODO: Check for unreadable sections (!IMAGE_SCN_MEM_READ)?
-        // FIXME Using std::min fixes the crash but does not solve the root issue.
-        // This needs further consideration.
-        memset(m_image + rva, 0, size);
-        memcpy(m_image + rva, fileData + physOff, std::min(physSize, size));
-
-        sect.Name         = QByteArray(o->ObjectName, 8);
+        sect.Name         = QByteArray(obj.ObjectName, 8);
         sect.From         = Address(READ4_LE(m_peHeader->Imagebase) + rva);
         sect.ImageAddress = HostAddress(m_image) + rva;
         sect.Size         = size;
         sect.PhysSize     = physSize;
 
         // clang-format off
-        const DWord peFlags = READ4_LE(o->Flags);
+        const DWord peFlags = READ4_LE(obj.Flags);
         sect.Bss            = (peFlags & IMAGE_SCN_CNT_UNINITIALIZED_DATA) ? true  : false;
         sect.Code           = (peFlags & IMAGE_SCN_CNT_CODE)               ? true  : false;
         sect.Data           = (peFlags & IMAGE_SCN_CNT_INITIALIZED_DATA)   ? true  : false;
         sect.ReadOnly       = (peFlags & IMAGE_SCN_MEM_WRITE)              ? false : true;
-        // clang-fomat on
+        // clang-format on
 
         params.push_back(sect);
     }
@@ -755,6 +863,12 @@ int Win32BinaryLoader::canLoad(QIODevice &fl) const
 }
 
 
+std::vector<FileSignature> Win32BinaryLoader::getSignatures() const
+{
+    return { { 0, QByteArray("MZ") } };
+}
+
+
 /**
  * \internal Used above for a hack to find jump instructions pointing to IATs.
  * Heuristic: start just before the "start" entry point looking for FF 25 opcodes followed by a
@@ -820,7 +934,7 @@ void Win32BinaryLoader::unload()
     m_imageSize = 0;
     m_numRelocs = 0;
 
-    delete[] m_image;
+    // The image is owned by the BinaryImage
     m_image = nullptr;
 }
 
@@ -484,6 +484,15 @@ int HpSomBinaryLoader::canLoad(QIODevice &dev) const
 }
 
 
+std::vector<FileSignature> HpSomBinaryLoader::getSignatures() const
+{
+    // system_id (big endian) of the header
+    return { { 0, QByteArray("\x02\x0B", 2) },
+             { 0, QByteArray("\x02\x10", 2) },
+             { 0, QByteArray("\x02\x14", 2) } };
+}
+
+
 void HpSomBinaryLoader::unload()
 {
 }
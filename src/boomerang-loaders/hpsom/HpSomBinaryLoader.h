@@ -13,6 +13,7 @@
 #include "boomerang/db/binary/BinarySymbol.h"
 #include "boomerang/ifc/IFileLoader.h"
 
+#include <map>
 #include <set>
 
 
@@ -91,6 +92,9 @@ public:
     /// \copydoc IFileLoader::canLoad
     int canLoad(QIODevice &dev) const override;
 
+    /// \copydoc IFileLoader::getSignatures
+    std::vector<FileSignature> getSignatures() const override;
+
     /// \copydoc IFileLoader::loadFromMemory
     bool loadFromMemory(QByteArray &data) override;
 
@@ -477,6 +477,14 @@ int MachOBinaryLoader::canLoad(QIODevice &dev) const
 }
 
 
+std::vector<FileSignature> MachOBinaryLoader::getSignatures() const
+{
+    return { { 0, QByteArray("\xFE\xED\xFA\xCE", 4) },
+             { 0, QByteArray("\xCE\xFA\xED\xFE", 4) },
+             { 0, QByteArray("\xCA\xFE\xBA\xBE", 4) } };
+}
+
+
 // Clean up and unload the binary image
 void MachOBinaryLoader::unload()
 {
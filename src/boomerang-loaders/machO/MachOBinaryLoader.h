@@ -12,6 +12,7 @@
 
 #include "boomerang/ifc/IFileLoader.h"
 
+#include <map>
 #include <string>
 #include <vector>
 
@@ -82,6 +83,9 @@ public:
     /// \copydoc IFileLoader::canLoad
     int canLoad(QIODevice &dev) const override;
 
+    /// \copydoc IFileLoader::getSignatures
+    std::vector<FileSignature> getSignatures() const override;
+
     /// \copydoc IFileLoader::unload
     void unload() override;
 
@@ -345,6 +345,12 @@ int PalmBinaryLoader::canLoad(QIODevice &dev) const
 }
 
 
+std::vector<FileSignature> PalmBinaryLoader::getSignatures() const
+{
+    return { { 0x3C, QByteArray("appl") }, { 0x3C, QByteArray("panl") } };
+}
+
+
 void PalmBinaryLoader::unload()
 {
 }
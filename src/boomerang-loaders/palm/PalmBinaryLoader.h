@@ -31,6 +31,9 @@ public:
     /// \copydoc IFileLoader::canLoad
     int canLoad(QIODevice &dev) const override;
 
+    /// \copydoc IFileLoader::getSignatures
+    std::vector<FileSignature> getSignatures() const override;
+
     /// \copydoc IFileLoader::loadFromMemory
     bool loadFromMemory(QByteArray &data) override;
 
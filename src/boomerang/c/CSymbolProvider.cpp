@@ -10,6 +10,7 @@
 #include "CSymbolProvider.h"
 
 #include "boomerang/c/parser/AnsiCParser.h"
+#include "boomerang/core/Project.h"
 #include "boomerang/db/Prog.h"
 #include "boomerang/db/binary/BinarySymbol.h"
 #include "boomerang/db/binary/BinarySymbolTable.h"
@@ -21,6 +22,12 @@
 #include <QFileInfo>
 #include <QTextStream>
 
+#include <mutex>
+
+
+/// The C parser is not reentrant, so only one file can be parsed at a time.
+static std::mutex g_parserMutex;
+
 
 CSymbolProvider::CSymbolProvider(Prog *prog)
     : m_prog(prog)
@@ -75,6 +82,21 @@ bool CSymbolProvider::readLibraryCatalog(const QString &filePath)
 
 bool CSymbolProvider::readLibrarySignatures(const QString &signatureFile, CallConv cc)
 {
+    Project *project = m_prog->getProject();
+
+    const Project::SignatureList *cached = project ? project->getLibrarySignatures(
+                                                         signatureFile, m_prog->getMachine(), cc)
+                                                   : nullptr;
+
+    if (cached) {
+        for (const std::shared_ptr<const Signature> &signature : *cached) {
+            m_librarySignatures[signature->getName()] = signature;
+        }
+
+        return true;
+    }
+
+    std::lock_guard<std::mutex> lock(g_parserMutex);
     std::unique_ptr<AnsiCParser> p;
 
     try {
@@ -87,9 +109,17 @@ bool CSymbolProvider::readLibrarySignatures(const QString &signatureFile, CallCo
 
     p->yyparse(m_prog->getMachine(), cc);
 
+    Project::SignatureList signatures;
+
     for (auto &signature : p->signatures) {
-        m_librarySignatures[signature->getName()] = signature;
         signature->setSigFilePath(signatureFile);
+        m_librarySignatures[signature->getName()] = signature;
+        signatures.push_back(signature);
+    }
+
+    if (project) {
+        project->addLibrarySignatures(signatureFile, m_prog->getMachine(), cc,
+                                      std::move(signatures));
     }
 
     return true;
@@ -100,16 +130,20 @@ bool CSymbolProvider::addSymbolsFromSymbolFile(const QString &fname)
 {
     std::unique_ptr<AnsiCParser> parser = nullptr;
 
-    try {
-        parser.reset(new AnsiCParser(qPrintable(fname), false));
-    }
-    catch (const char *msg) {
-        LOG_ERROR("Cannot read symbol file '%1': %2", fname, msg);
-        return false;
-    }
+    {
+        std::lock_guard<std::mutex> lock(g_parserMutex);
 
-    CallConv cc = m_prog->isWin32() ? CallConv::Pascal : CallConv::C;
-    parser->yyparse(m_prog->getMachine(), cc);
+        try {
+            parser.reset(new AnsiCParser(qPrintable(fname), false));
+        }
+        catch (const char *msg) {
+            LOG_ERROR("Cannot read symbol file '%1': %2", fname, msg);
+            return false;
+        }
+
+        CallConv cc = m_prog->isWin32() ? CallConv::Pascal : CallConv::C;
+        parser->yyparse(m_prog->getMachine(), cc);
+    }
 
     Module *targetModule = m_prog->getRootModule();
 
@@ -149,5 +183,5 @@ bool CSymbolProvider::addSymbolsFromSymbolFile(const QString &fname)
 std::shared_ptr<Signature> CSymbolProvider::getSignatureByName(const QString &functionName) const
 {
     auto it = m_librarySignatures.find(functionName);
-    return it != m_librarySignatures.end() ? it.value() : nullptr;
+    return it != m_librarySignatures.end() ? it.value()->clone() : nullptr;
 }
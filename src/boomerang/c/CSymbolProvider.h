@@ -40,5 +40,7 @@ private:
 
 private:
     Prog *m_prog;
-    QMap<QString, std::shared_ptr<Signature>> m_librarySignatures;
+    /// Library signatures by function name. The signatures may be shared with other Progs
+    /// via the project cache, so they are cloned before they are handed out.
+    QMap<QString, std::shared_ptr<const Signature>> m_librarySignatures;
 };
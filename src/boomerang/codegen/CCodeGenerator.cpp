@@ -17,6 +17,7 @@
 #include "boomerang/db/proc/UserProc.h"
 #include "boomerang/db/signature/Signature.h"
 #include "boomerang/decomp/CFGCompressor.h"
+#include "boomerang/decomp/DecompilationBudget.h"
 #include "boomerang/passes/PassManager.h"
 #include "boomerang/ssl/RTL.h"
 #include "boomerang/ssl/exp/Const.h"
@@ -879,6 +880,11 @@ void CCodeGenerator::addProcStart(UserProc *proc)
 
     s << "/** address: " << proc->getEntryAddress() << " */";
     appendLine(tgt);
+
+    if (proc->getProg()->getProject()->getDecompilationBudget()->isDegraded(proc)) {
+        addLineComment("Decompilation budget exceeded, procedure was only partially analysed");
+    }
+
     addFunctionSignature(proc, true);
 }
 
@@ -0,0 +1,321 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "MetricsWatcher.h"
+
+#include "boomerang/db/proc/Proc.h"
+
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include <chrono>
+#include <cstdio>
+
+
+/// Number of decoded instructions between two checks whether a report is due
+#define REPORT_CHECK_INTERVAL (1024)
+
+
+const char *DecompilationMetrics::phaseToString(Phase phase)
+{
+    switch (phase) {
+    case Phase::Idle: return "idle";
+    case Phase::Decoding: return "decoding";
+    case Phase::Decompiling: return "decompiling";
+    case Phase::Finished: return "finished";
+    }
+
+    return "unknown";
+}
+
+
+QString DecompilationMetrics::toJson(const QString &label) const
+{
+    QJsonObject obj;
+
+    if (!label.isEmpty()) {
+        obj["label"] = label;
+    }
+
+    obj["phase"]              = phaseToString(phase);
+    obj["decodeSeconds"]      = decodeSeconds;
+    obj["instructions"]       = static_cast<double>(numInstructionsDecoded);
+    obj["bytes"]              = static_cast<double>(numBytesDecoded);
+    obj["badDecodes"]         = static_cast<double>(numBadDecodes);
+    obj["functionsDecoded"]   = static_cast<double>(numFunctionsDecoded);
+    obj["instructionsPerSec"] = instructionsPerSecond;
+    obj["bytesPerSec"]        = bytesPerSecond;
+    obj["decompileSeconds"]   = decompileSeconds;
+    obj["procsDecompiled"]    = static_cast<double>(numProcsDecompiled);
+    obj["procsRemaining"]     = static_cast<double>(numProcsRemaining);
+    obj["procsPerSec"]        = procsPerSecond;
+    obj["eta"] = etaSeconds >= 0.0 ? QJsonValue(etaSeconds) : QJsonValue(QJsonValue::Null);
+
+    return QString::fromUtf8(QJsonDocument(obj).toJson(QJsonDocument::Compact));
+}
+
+
+MetricsWatcher::MetricsWatcher(int reportInterval)
+    : m_reportInterval(static_cast<sint64>(reportInterval) * 1000000)
+{
+}
+
+
+MetricsWatcher::~MetricsWatcher()
+{
+}
+
+
+bool MetricsWatcher::setOutputFile(const QString &filePath)
+{
+    std::lock_guard<std::mutex> lock(m_outputMutex);
+    m_output.reset();
+
+    if (filePath.isEmpty()) {
+        return true;
+    }
+
+    std::unique_ptr<QFile> output(new QFile());
+    bool ok = false;
+
+    if (filePath == "-") {
+        ok = output->open(stderr, QIODevice::WriteOnly | QIODevice::Unbuffered);
+    }
+    else {
+        output->setFileName(filePath);
+        // Unbuffered, so concurrent processes appending to the same file write whole lines
+        ok = output->open(QIODevice::WriteOnly | QIODevice::Append | QIODevice::Unbuffered);
+    }
+
+    if (ok) {
+        m_output = std::move(output);
+    }
+
+    return ok;
+}
+
+
+void MetricsWatcher::setLabel(const QString &label)
+{
+    std::lock_guard<std::mutex> lock(m_outputMutex);
+    m_label = label;
+}
+
+
+DecompilationMetrics MetricsWatcher::getMetrics() const
+{
+    DecompilationMetrics metrics;
+    const sint64 currentTime = now();
+
+    metrics.phase                  = m_phase.load();
+    metrics.numInstructionsDecoded = m_numInstructions.load();
+    metrics.numBytesDecoded        = m_numBytes.load();
+    metrics.numBytesToDecode       = m_numBytesToDecode.load();
+    metrics.numBadDecodes          = m_numBadDecodes.load();
+    metrics.numFunctionsDecoded    = m_numFunctionsDecoded.load();
+    metrics.numProcsDecompiled     = m_numProcsDecompiled.load();
+
+    const sint64 numUserProcs = m_numUserProcs.load();
+    metrics.numProcsRemaining = numUserProcs > static_cast<sint64>(metrics.numProcsDecompiled)
+                                    ? numUserProcs - metrics.numProcsDecompiled
+                                    : 0;
+
+    const sint64 decodeStart = m_decodeStart.load();
+    const sint64 decodeEnd   = m_decodeEnd.load();
+
+    if (decodeStart != 0) {
+        metrics.decodeSeconds = ((decodeEnd != 0 ? decodeEnd : currentTime) - decodeStart) / 1e9;
+    }
+
+    if (metrics.decodeSeconds > 0.0) {
+        metrics.instructionsPerSecond = metrics.numInstructionsDecoded / metrics.decodeSeconds;
+        metrics.bytesPerSecond        = metrics.numBytesDecoded / metrics.decodeSeconds;
+    }
+
+    const sint64 decompileStart = m_decompileStart.load();
+    const sint64 decompileEnd   = m_decompileEnd.load();
+
+    if (decompileStart != 0) {
+        metrics.decompileSeconds = ((decompileEnd != 0 ? decompileEnd : currentTime) -
+                                    decompileStart) /
+                                   1e9;
+    }
+
+    if (metrics.decompileSeconds > 0.0) {
+        metrics.procsPerSecond = metrics.numProcsDecompiled / metrics.decompileSeconds;
+    }
+
+    switch (metrics.phase) {
+    case DecompilationMetrics::Phase::Decoding:
+        // Not all of the code section is necessarily reachable, so this is an upper bound.
+        if (metrics.numBytesToDecode > metrics.numBytesDecoded && metrics.bytesPerSecond > 0.0) {
+            metrics.etaSeconds = (metrics.numBytesToDecode - metrics.numBytesDecoded) /
+                                 metrics.bytesPerSecond;
+        }
+        break;
+
+    case DecompilationMetrics::Phase::Decompiling:
+        if (metrics.procsPerSecond > 0.0) {
+            metrics.etaSeconds = metrics.numProcsRemaining / metrics.procsPerSecond;
+        }
+        break;
+
+    case DecompilationMetrics::Phase::Idle:
+    case DecompilationMetrics::Phase::Finished: metrics.etaSeconds = 0.0; break;
+    }
+
+    return metrics;
+}
+
+
+void MetricsWatcher::report()
+{
+    const DecompilationMetrics metrics = getMetrics();
+
+    std::lock_guard<std::mutex> lock(m_outputMutex);
+    if (m_output) {
+        m_output->write((metrics.toJson(m_label) + "\n").toUtf8());
+    }
+
+    m_nextReport = now() + m_reportInterval;
+}
+
+
+void MetricsWatcher::reset()
+{
+    m_phase               = DecompilationMetrics::Phase::Idle;
+    m_decodeStart         = 0;
+    m_decodeEnd           = 0;
+    m_decompileStart      = 0;
+    m_decompileEnd        = 0;
+    m_numInstructions     = 0;
+    m_numBytes            = 0;
+    m_numBytesToDecode    = 0;
+    m_numBadDecodes       = 0;
+    m_numFunctionsDecoded = 0;
+    m_numUserProcs        = 0;
+    m_numProcsDecompiled  = 0;
+}
+
+
+void MetricsWatcher::onFunctionCreated(Function *function)
+{
+    if (!function->isLib()) {
+        m_numUserProcs++;
+    }
+}
+
+
+void MetricsWatcher::onFunctionRemoved(Function *function)
+{
+    if (!function->isLib()) {
+        m_numUserProcs--;
+    }
+}
+
+
+void MetricsWatcher::onStartDecode(Address, int numBytes)
+{
+    m_numInstructions     = 0;
+    m_numBytes            = 0;
+    m_numBadDecodes       = 0;
+    m_numFunctionsDecoded = 0;
+    m_decodeStart         = 0;
+
+    beginDecode(numBytes > 0 ? numBytes : 0);
+}
+
+
+void MetricsWatcher::onInstructionDecoded(Address, int numBytes)
+{
+    if (m_phase == DecompilationMetrics::Phase::Idle && m_decodeStart == 0) {
+        beginDecode(0);
+    }
+
+    m_numBytes += numBytes;
+    if (++m_numInstructions % REPORT_CHECK_INTERVAL == 0) {
+        maybeReport();
+    }
+}
+
+
+void MetricsWatcher::onFunctionDecoded(Function *, Address, Address, int)
+{
+    m_numFunctionsDecoded++;
+}
+
+
+void MetricsWatcher::onBadDecode(Address)
+{
+    m_numBadDecodes++;
+}
+
+
+void MetricsWatcher::onEndDecode()
+{
+    m_decodeEnd = now();
+    m_phase     = DecompilationMetrics::Phase::Idle;
+    report();
+}
+
+
+void MetricsWatcher::onStartDecompile(UserProc *)
+{
+    if (m_phase != DecompilationMetrics::Phase::Decompiling) {
+        m_numProcsDecompiled = 0;
+        m_decompileEnd       = 0;
+        m_decompileStart     = now();
+        m_phase              = DecompilationMetrics::Phase::Decompiling;
+    }
+}
+
+
+void MetricsWatcher::onEndDecompile(UserProc *)
+{
+    m_numProcsDecompiled++;
+    maybeReport();
+}
+
+
+void MetricsWatcher::onDecompilationEnd()
+{
+    m_decompileEnd = now();
+    m_phase        = DecompilationMetrics::Phase::Finished;
+    report();
+}
+
+
+void MetricsWatcher::beginDecode(uint64 numBytesToDecode)
+{
+    if (m_decodeStart == 0) {
+        m_decodeStart = now();
+    }
+
+    m_decodeEnd        = 0;
+    m_numBytesToDecode = numBytesToDecode;
+    m_phase            = DecompilationMetrics::Phase::Decoding;
+}
+
+
+void MetricsWatcher::maybeReport()
+{
+    if (now() >= m_nextReport) {
+        report();
+    }
+}
+
+
+sint64 MetricsWatcher::now()
+{
+    // never 0, which denotes an unset timestamp
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+               .count() +
+           1;
+}
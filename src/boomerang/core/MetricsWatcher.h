@@ -0,0 +1,161 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include "boomerang/core/Watcher.h"
+#include "boomerang/util/Types.h"
+
+#include <QFile>
+#include <QString>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+
+/// A snapshot of the progress of decoding and decompiling a program.
+struct BOOMERANG_API DecompilationMetrics
+{
+    enum class Phase
+    {
+        Idle,
+        Decoding,
+        Decompiling,
+        Finished
+    };
+
+    Phase phase = Phase::Idle;
+
+    double decodeSeconds          = 0.0; ///< time spent decoding so far
+    uint64 numInstructionsDecoded = 0;
+    uint64 numBytesDecoded        = 0;
+    uint64 numBytesToDecode       = 0; ///< size of the code section (0 if unknown)
+    uint64 numBadDecodes          = 0;
+    uint64 numFunctionsDecoded    = 0;
+    double instructionsPerSecond  = 0.0;
+    double bytesPerSecond         = 0.0;
+
+    double decompileSeconds   = 0.0; ///< time spent decompiling so far
+    uint64 numProcsDecompiled = 0;
+    uint64 numProcsRemaining  = 0; ///< user procedures that are not decompiled yet
+    double procsPerSecond     = 0.0;
+
+    /// Estimated seconds until the current phase is finished, or < 0 if unknown.
+    double etaSeconds = -1.0;
+
+public:
+    static const char *phaseToString(Phase phase);
+
+    /// \returns the metrics as a single line JSON object.
+    /// \param label if not empty, added as "label" to the object
+    QString toJson(const QString &label = "") const;
+};
+
+
+/**
+ * Aggregates decode and decompilation throughput from the watcher callbacks.
+ * Counters are updated atomically, so getMetrics() may be called from any thread
+ * (e.g. by the GUI) while the program is decoded or decompiled in another thread.
+ *
+ * If an output file is set, the metrics are written as one JSON object per line
+ * at most once per report interval, and once at the end of each phase.
+ */
+class BOOMERANG_API MetricsWatcher : public IWatcher
+{
+public:
+    /// \param reportInterval minimum time between two reports, in milliseconds
+    explicit MetricsWatcher(int reportInterval = 1000);
+    ~MetricsWatcher() override;
+
+public:
+    /**
+     * Write reports to \p filePath. Reports are appended to the file.
+     * \param filePath path to the report file, "-" for stderr, or empty to disable reports
+     * \returns false if the file cannot be opened.
+     */
+    bool setOutputFile(const QString &filePath);
+
+    /// Set the label added to each report, e.g. the path of the binary file.
+    void setLabel(const QString &label);
+
+    /// \returns the current metrics. Thread safe.
+    DecompilationMetrics getMetrics() const;
+
+    /// Write the current metrics to the output file, if any.
+    void report();
+
+    /// Forget all metrics, e.g. before loading another binary file.
+    void reset();
+
+    /// \copydoc IWatcher::onFunctionCreated
+    void onFunctionCreated(Function *function) override;
+
+    /// \copydoc IWatcher::onFunctionRemoved
+    void onFunctionRemoved(Function *function) override;
+
+    /// \copydoc IWatcher::onStartDecode
+    void onStartDecode(Address start, int numBytes) override;
+
+    /// \copydoc IWatcher::onInstructionDecoded
+    void onInstructionDecoded(Address pc, int numBytes) override;
+
+    /// \copydoc IWatcher::onFunctionDecoded
+    void onFunctionDecoded(Function *function, Address pc, Address last, int numBytes) override;
+
+    /// \copydoc IWatcher::onBadDecode
+    void onBadDecode(Address pc) override;
+
+    /// \copydoc IWatcher::onEndDecode
+    void onEndDecode() override;
+
+    /// \copydoc IWatcher::onStartDecompile
+    void onStartDecompile(UserProc *proc) override;
+
+    /// \copydoc IWatcher::onEndDecompile
+    void onEndDecompile(UserProc *proc) override;
+
+    /// \copydoc IWatcher::onDecompilationEnd
+    void onDecompilationEnd() override;
+
+private:
+    /// Enter the decoding phase. Called by onInstructionDecoded if onStartDecode
+    /// was not called, e.g. when only decoding the entry points given by the user.
+    void beginDecode(uint64 numBytesToDecode);
+
+    /// Write a report if the report interval has passed since the last report.
+    void maybeReport();
+
+    static sint64 now();
+
+private:
+    const sint64 m_reportInterval; ///< in nanoseconds
+
+    std::atomic<DecompilationMetrics::Phase> m_phase{ DecompilationMetrics::Phase::Idle };
+
+    // Timestamps are in nanoseconds of a monotonic clock; 0 if not set
+    std::atomic<sint64> m_decodeStart{ 0 };
+    std::atomic<sint64> m_decodeEnd{ 0 };
+    std::atomic<sint64> m_decompileStart{ 0 };
+    std::atomic<sint64> m_decompileEnd{ 0 };
+    std::atomic<sint64> m_nextReport{ 0 };
+
+    std::atomic<uint64> m_numInstructions{ 0 };
+    std::atomic<uint64> m_numBytes{ 0 };
+    std::atomic<uint64> m_numBytesToDecode{ 0 };
+    std::atomic<uint64> m_numBadDecodes{ 0 };
+    std::atomic<uint64> m_numFunctionsDecoded{ 0 };
+    std::atomic<sint64> m_numUserProcs{ 0 };
+    std::atomic<uint64> m_numProcsDecompiled{ 0 };
+
+    mutable std::mutex m_outputMutex;
+    std::unique_ptr<QFile> m_output;
+    QString m_label;
+};
@@ -14,22 +14,31 @@
 #include "boomerang/core/Watcher.h"
 #include "boomerang/db/Prog.h"
 #include "boomerang/db/binary/BinarySymbolTable.h"
+#include "boomerang/decomp/DecompilationBudget.h"
 #include "boomerang/decomp/ProgDecompiler.h"
 #include "boomerang/frontend/mips/MIPSFrontEnd.h"
 #include "boomerang/frontend/pentium/PentiumFrontEnd.h"
 #include "boomerang/frontend/ppc/PPCFrontEnd.h"
 #include "boomerang/frontend/sparc/SPARCFrontEnd.h"
 #include "boomerang/frontend/st20/ST20FrontEnd.h"
+#include "boomerang/ssl/RTLInstDictCache.h"
 #include "boomerang/type/dfa/DFATypeRecovery.h"
 #include "boomerang/util/CallGraphDotWriter.h"
 #include "boomerang/util/ProgSymbolWriter.h"
 #include "boomerang/util/log/Log.h"
 
+#include <QBuffer>
+#include <QFileInfo>
+
+#include <algorithm>
+#include <utility>
+
 
 Project::Project()
     : m_settings(new Settings())
     , m_typeRecovery(new DFATypeRecovery())
     , m_codeGenerator(new CCodeGenerator())
+    , m_budget(new DecompilationBudget(m_settings.get()))
 {
 }
 
@@ -87,6 +96,18 @@ const ITypeRecovery *Project::getTypeRecoveryEngine() const
 }
 
 
+DecompilationBudget *Project::getDecompilationBudget()
+{
+    return m_budget.get();
+}
+
+
+const DecompilationBudget *Project::getDecompilationBudget() const
+{
+    return m_budget.get();
+}
+
+
 const char *Project::getVersionStr() const
 {
     return BOOMERANG_VERSION;
@@ -97,8 +118,19 @@ bool Project::loadBinaryFile(const QString &filePath)
 {
     LOG_MSG("Loading binary file '%1'", filePath);
 
+    QFile srcFile(filePath);
+    if (!srcFile.open(QFile::ReadOnly)) {
+        LOG_WARN("Opening '%1' failed", filePath);
+        return false;
+    }
+
+    // Read the file only once; the contents are used both for finding the loader
+    // and for loading the file.
+    QByteArray data = srcFile.readAll();
+    srcFile.close();
+
     // Find loader plugin to load file
-    IFileLoader *loader = getBestLoader(filePath);
+    IFileLoader *loader = getBestLoader(data);
 
     if (loader == nullptr) {
         LOG_WARN("Cannot load '%1': Unrecognized binary file format.", filePath);
@@ -110,19 +142,16 @@ bool Project::loadBinaryFile(const QString &filePath)
         unloadBinaryFile();
     }
 
-    QFile srcFile(filePath);
-    if (!srcFile.open(QFile::ReadOnly)) {
-        LOG_WARN("Opening '%1' failed");
-        return false;
-    }
-
-    m_loadedBinary.reset(new BinaryFile(srcFile.readAll(), loader));
+    // Hand the contents over to the image, so the loader does not have to detach
+    // (and copy) them when it modifies the image, e.g. when applying relocations.
+    m_loadedBinary.reset(new BinaryFile(std::move(data), loader));
 
     if (loader->loadFromFile(m_loadedBinary.get()) == false) {
         return false;
     }
 
     m_loadedBinary->getImage()->updateTextLimits();
+    m_loadedBinary->getImage()->updateStringIndex();
 
     return createProg(m_loadedBinary.get(), QFileInfo(filePath).baseName()) != nullptr;
 }
@@ -150,6 +179,7 @@ bool Project::isBinaryLoaded() const
 
 void Project::unloadBinaryFile()
 {
+    m_budget->reset();
     m_prog.reset();
     m_loadedBinary.reset();
 }
@@ -209,6 +239,8 @@ bool Project::decompileBinaryFile()
     ProgDecompiler dcomp(m_prog.get());
     dcomp.decompile();
 
+    alertDecompilationEnd();
+
     return true;
 }
 
@@ -230,6 +262,41 @@ bool Project::generateCode(Module *module)
 }
 
 
+std::shared_ptr<const RTLInstDict> Project::getSSLDictionary(const QString &sslFilePath)
+{
+    const QString canonicalPath = QFileInfo(sslFilePath).absoluteFilePath();
+
+    auto it = m_sslDicts.find(canonicalPath);
+    if (it != m_sslDicts.end()) {
+        return it->second;
+    }
+
+    std::shared_ptr<const RTLInstDict> dict = RTLInstDictCache::getDictionary(
+        canonicalPath, getSettings()->debugDecoder, getSettings()->getSSLCacheDirectory());
+
+    if (dict) {
+        m_sslDicts[canonicalPath] = dict;
+    }
+
+    return dict;
+}
+
+
+const Project::SignatureList *Project::getLibrarySignatures(const QString &sigFilePath,
+                                                            Machine machine, CallConv cc) const
+{
+    auto it = m_librarySignatures.find(std::make_tuple(sigFilePath, machine, cc));
+    return it != m_librarySignatures.end() ? &it->second : nullptr;
+}
+
+
+void Project::addLibrarySignatures(const QString &sigFilePath, Machine machine, CallConv cc,
+                                   SignatureList signatures)
+{
+    m_librarySignatures[std::make_tuple(sigFilePath, machine, cc)] = std::move(signatures);
+}
+
+
 Prog *Project::createProg(BinaryFile *file, const QString &name)
 {
     if (!file) {
@@ -341,6 +408,7 @@ void Project::loadPlugins()
 #endif
         try {
             std::unique_ptr<LoaderPlugin> loaderPlugin(new LoaderPlugin(sofilename));
+            m_loaderSignatures.push_back(loaderPlugin->get()->getSignatures());
             m_loaderPlugins.push_back(std::move(loaderPlugin));
         }
         catch (const char *errmsg) {
@@ -367,6 +435,12 @@ void Project::addWatcher(IWatcher *watcher)
 }
 
 
+void Project::removeWatcher(IWatcher *watcher)
+{
+    m_watchers.erase(watcher);
+}
+
+
 void Project::alertDecompileDebugPoint(UserProc *p, const char *description)
 {
     for (IWatcher *elem : m_watchers) {
@@ -487,12 +561,30 @@ void Project::alertDecompilationEnd()
 }
 
 
-IFileLoader *Project::getBestLoader(const QString &filePath) const
+/// \returns true if \p data matches any of \p signatures, or if there are no signatures.
+static bool matchesSignature(const QByteArray &data, const std::vector<FileSignature> &signatures)
+{
+    if (signatures.empty()) {
+        return true;
+    }
+
+    for (const FileSignature &sig : signatures) {
+        if (sig.offset >= 0 && sig.offset + sig.bytes.size() <= data.size() &&
+            std::equal(sig.bytes.begin(), sig.bytes.end(), data.begin() + sig.offset)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+IFileLoader *Project::getBestLoader(const QByteArray &data) const
 {
-    QFile inputBinary(filePath);
+    QBuffer inputBinary;
+    inputBinary.setData(data);
 
-    if (!inputBinary.open(QFile::ReadOnly)) {
-        LOG_ERROR("Unable to open binary file: %1", filePath);
+    if (!inputBinary.open(QBuffer::ReadOnly)) {
         return nullptr;
     }
 
@@ -500,9 +592,13 @@ IFileLoader *Project::getBestLoader(const QString &filePath) const
     int bestScore           = 0;
 
     // get the best plugin for loading this file
-    for (const std::unique_ptr<LoaderPlugin> &p : m_loaderPlugins) {
+    for (std::size_t i = 0; i < m_loaderPlugins.size(); ++i) {
+        if (!matchesSignature(data, m_loaderSignatures[i])) {
+            continue; // definitely not a file for this loader
+        }
+
         inputBinary.seek(0); // reset the file offset for the next plugin
-        IFileLoader *loader = p->get();
+        IFileLoader *loader = m_loaderPlugins[i]->get();
 
         int score = loader->canLoad(inputBinary);
 
@@ -11,15 +11,19 @@
 
 
 #include "boomerang/core/BoomerangAPI.h"
+#include "boomerang/frontend/SigEnum.h"
 #include "boomerang/ifc/IFileLoader.h"
 #include "boomerang/util/Address.h"
 
+#include <map>
 #include <memory>
 #include <set>
+#include <tuple>
 #include <vector>
 
 
 class BinaryFile;
+class DecompilationBudget;
 class ICodeGenerator;
 class IFrontEnd;
 class ITypeRecovery;
@@ -27,7 +31,9 @@ class IWatcher;
 class Function;
 class Module;
 class Prog;
+class RTLInstDict;
 class Settings;
+class Signature;
 class UserProc;
 
 class QString;
@@ -35,6 +41,9 @@ class QString;
 
 class BOOMERANG_API Project
 {
+public:
+    typedef std::vector<std::shared_ptr<const Signature>> SignatureList;
+
 public:
     Project();
     Project(const Project &other) = delete;
@@ -59,6 +68,10 @@ public:
     ITypeRecovery *getTypeRecoveryEngine();
     const ITypeRecovery *getTypeRecoveryEngine() const;
 
+    /// \returns the effort limits of the current decompilation
+    DecompilationBudget *getDecompilationBudget();
+    const DecompilationBudget *getDecompilationBudget() const;
+
 public:
     /// \returns the library version string
     const char *getVersionStr() const;
@@ -119,11 +132,37 @@ public:
      */
     bool generateCode(Module *module = nullptr);
 
+public:
+    /**
+     * \returns the instruction dictionary parsed from the SSL file at \p sslFilePath,
+     * or nullptr if the file could not be parsed.
+     * The dictionary is shared by all decoders and projects of this process
+     * (see RTLInstDictCache) and is kept when a different binary file is loaded.
+     */
+    std::shared_ptr<const RTLInstDict> getSSLDictionary(const QString &sslFilePath);
+
+    /**
+     * \returns the library signatures previously parsed from the signature file at \p sigFilePath
+     * for machine \p machine and calling convention \p cc, or nullptr if the file was not parsed
+     * yet. The signatures are shared by all Progs of this project and must not be modified;
+     * clone them before use.
+     */
+    const SignatureList *getLibrarySignatures(const QString &sigFilePath, Machine machine,
+                                              CallConv cc) const;
+
+    /// Remember the library signatures \p signatures parsed from \p sigFilePath,
+    /// so that the file does not need to be parsed again for the next binary file.
+    void addLibrarySignatures(const QString &sigFilePath, Machine machine, CallConv cc,
+                              SignatureList signatures);
+
 public:
     /// Register a watcher to receive events about the decompilation.
     /// Does NOT take ownership of the pointer.
     void addWatcher(IWatcher *watcher);
 
+    /// Stop alerting \p watcher. Does nothing if \p watcher was not added.
+    void removeWatcher(IWatcher *watcher);
+
     /// Called once after a function was created.
     void alertFunctionCreated(Function *function);
 
@@ -170,8 +209,11 @@ public:
     void alertDecompilationEnd();
 
 private:
-    /// Get the best loader that is able to load the file at \p filePath
-    IFileLoader *getBestLoader(const QString &filePath) const;
+    /**
+     * Get the best loader that is able to load the file with contents \p data.
+     * Only loaders with a signature matching \p data are asked whether they can load the file.
+     */
+    IFileLoader *getBestLoader(const QByteArray &data) const;
 
     /**
      * Create a Prog from a loaded binary file. Returns nullptr on failure.
@@ -209,10 +251,21 @@ private:
     // Plugins
     std::vector<std::unique_ptr<LoaderPlugin>> m_loaderPlugins;
 
+    /// File signatures of each loader plugin, in the same order as \ref m_loaderPlugins
+    std::vector<std::vector<FileSignature>> m_loaderSignatures;
+
     std::unique_ptr<BinaryFile> m_loadedBinary;
     std::unique_ptr<Prog> m_prog;
 
     std::unique_ptr<IFrontEnd> m_fe;                 ///< front end
     std::unique_ptr<ITypeRecovery> m_typeRecovery;   ///< middle end
     std::unique_ptr<ICodeGenerator> m_codeGenerator; ///< back end
+
+    std::unique_ptr<DecompilationBudget> m_budget;
+
+    /// Parsed SSL files, by file path. Kept alive across binary files.
+    std::map<QString, std::shared_ptr<const RTLInstDict>> m_sslDicts;
+
+    /// Parsed library signature files. Kept alive across binary files.
+    std::map<std::tuple<QString, Machine, CallConv>, SignatureList> m_librarySignatures;
 };
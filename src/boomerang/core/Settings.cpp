@@ -12,6 +12,7 @@
 #include "boomerang/util/log/Log.h"
 
 #include <QCoreApplication>
+#include <QStandardPaths>
 
 
 Settings::Settings()
@@ -22,6 +23,12 @@ Settings::Settings()
     setDataDirectory(appDirPath + "/../share/boomerang");
     setPluginDirectory(appDirPath + "/../lib/boomerang/plugins");
     setOutputDirectory("./output");
+
+    const QString cacheDirPath = QStandardPaths::writableLocation(
+        QStandardPaths::GenericCacheLocation);
+    if (!cacheDirPath.isEmpty()) {
+        setSSLCacheDirectory(cacheDirPath + "/boomerang/ssl");
+    }
 }
 
 
@@ -51,3 +58,12 @@ void Settings::setOutputDirectory(const QString &directoryPath)
     m_outputDirectory = m_workingDirectory.absoluteFilePath(directoryPath);
     LOG_VERBOSE("od now '%1'", m_outputDirectory.absolutePath());
 }
+
+
+void Settings::setSSLCacheDirectory(const QString &directoryPath)
+{
+    m_sslCacheDirectory = directoryPath.isEmpty()
+                              ? QString()
+                              : m_workingDirectory.absoluteFilePath(directoryPath);
+    LOG_VERBOSE("ssl cache dir now '%1'", m_sslCacheDirectory);
+}
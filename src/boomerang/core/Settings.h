@@ -33,6 +33,10 @@ public:
     void setPluginDirectory(const QString &directoryPath);
     void setOutputDirectory(const QString &directoryPath);
 
+    /// Set the directory where parsed SSL files are cached. Pass an empty string
+    /// to disable the cache.
+    void setSSLCacheDirectory(const QString &directoryPath);
+
     /// Get the path where the boomerang executable is run from.
     QDir getWorkingDirectory() const { return m_workingDirectory; }
 
@@ -45,6 +49,9 @@ public:
     /// Get the path where the decompiled files should be put
     QDir getOutputDirectory() const { return m_outputDirectory; }
 
+    /// Get the path where parsed SSL files are cached, or an empty string if they are not cached.
+    QString getSSLCacheDirectory() const { return m_sslCacheDirectory; }
+
 public:
     // Command line flags
     bool verboseOutput       = false;
@@ -86,6 +93,13 @@ public:
     bool useGlobals        = true;
     bool assumeABI         = false; ///< Assume ABI compliance
     bool experimental      = false; ///< Activate experimental code. Caution!
+    bool preDecode         = false; ///< Linearly sweep all code sections before decoding
+    bool prunedSSA         = true;  ///< Only place phi functions where the variable is live
+    bool prunedOverlaps    = true;  ///< Only update overlapping registers where they are live
+
+    int procTimeLimit      = 0; ///< Max seconds spent on analysing a single procedure (0 = no limit)
+    int procPassLimit      = 0; ///< Max number of passes executed on a single procedure (0 = no limit)
+    int decompileTimeLimit = 0; ///< Max seconds spent on decompiling the program (0 = no limit)
 
     QString replayFile; ///< file with commands to execute in interactive mode
 
@@ -103,4 +117,5 @@ private:
     QDir m_dataDirectory;
     QDir m_pluginDirectory;
     QDir m_outputDirectory;
+    QString m_sslCacheDirectory;
 };
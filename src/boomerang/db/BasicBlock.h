@@ -10,6 +10,7 @@
 #pragma once
 
 
+#include "boomerang/ssl/RTL.h"
 #include "boomerang/util/Address.h"
 #include "boomerang/util/StatementList.h"
 
@@ -18,7 +19,6 @@
 #include <vector>
 
 
-class RTL;
 class Exp;
 class ImplicitAssign;
 class PhiAssign;
@@ -26,7 +26,6 @@ class PhiAssign;
 class OStream;
 
 
-using RTLList   = std::list<std::unique_ptr<RTL>>;
 using SharedExp = std::shared_ptr<Exp>;
 
 
@@ -199,15 +198,22 @@ public:
      */
     void setRTLs(std::unique_ptr<RTLList> rtls);
 
+    /**
+     * Invalidate the cached statements of the enclosing procedure.
+     * Called whenever statements are added to or removed from this BB.
+     * \sa UserProc::getStatements
+     */
+    void statementsChanged();
+
     /**
      * Get first/next statement this BB
      * Somewhat intricate because of the post call semantics; these funcs save a lot of duplicated,
      * easily-bugged code
      */
-    Statement *getFirstStmt(RTLIterator &rit, StatementList::iterator &sit);
-    Statement *getNextStmt(RTLIterator &rit, StatementList::iterator &sit);
-    Statement *getLastStmt(RTLRIterator &rit, StatementList::reverse_iterator &sit);
-    Statement *getPrevStmt(RTLRIterator &rit, StatementList::reverse_iterator &sit);
+    Statement *getFirstStmt(RTLIterator &rit, RTL::iterator &sit);
+    Statement *getNextStmt(RTLIterator &rit, RTL::iterator &sit);
+    Statement *getLastStmt(RTLRIterator &rit, RTL::reverse_iterator &sit);
+    Statement *getPrevStmt(RTLRIterator &rit, RTL::reverse_iterator &sit);
 
     Statement *getFirstStmt();
     const Statement *getFirstStmt() const;
@@ -24,7 +24,9 @@
 #include "boomerang/visitor/expmodifier/ExpSSAXformer.h"
 #include "boomerang/visitor/expmodifier/ImplicitConverter.h"
 
+#include <algorithm>
 #include <cstring>
+#include <iterator>
 #include <sstream>
 
 
@@ -268,22 +270,8 @@ bool DataFlow::placePhiFunctions()
     m_parent.resize(0);
     m_best.resize(0);
     m_bucket.resize(0);
-    m_defsites.clear();
-    m_defallsites.clear();
 
-    for (ExSet &exps : m_definedAt) {
-        for (auto iter = exps.begin(); iter != exps.end();) {
-            if (m_A_phi.find(*iter) == m_A_phi.end()) {
-                iter = exps.erase(iter);
-            }
-            else {
-                ++iter;
-            }
-        }
-    }
-
-    m_definedAt.clear(); // and A_orig,
-    m_defStmts.clear();  // and the map from variable to defining Stmt
+    m_definedAt.clear(); // and A_orig
 
 
     // Set the sizes of needed vectors
@@ -294,74 +282,130 @@ bool DataFlow::placePhiFunctions()
 
     m_definedAt.resize(numBB);
 
-    const bool assumeABICompliance = m_proc->getProg()->getProject()->getSettings()->assumeABI;
+    const Settings *settings       = m_proc->getProg()->getProject()->getSettings();
+    const bool assumeABICompliance = settings->assumeABI;
+
+    // Blocks containing a childless call define every variable
+    std::vector<int> definesAllBlocks;
 
     // We need to create m_definedAt[n] for all n
     // Recreate each call because propagation and other changes make old data invalid
     for (int n = 0; n < numBB; n++) {
         BasicBlock::RTLIterator rit;
-        StatementList::iterator sit;
+        RTL::iterator sit;
         BasicBlock *bb = m_BBs[n];
 
         for (Statement *stmt = bb->getFirstStmt(rit, sit); stmt; stmt = bb->getNextStmt(rit, sit)) {
             LocationSet locationSet;
             stmt->getDefinitions(locationSet, assumeABICompliance);
 
-            if (stmt->isCall() && static_cast<const CallStatement *>(stmt)
-                                      ->isChildless()) { // If this is a childless call
-                m_defallsites.insert(n);                 // then this block defines every variable
+            if (stmt->isCall() && static_cast<const CallStatement *>(stmt)->isChildless() &&
+                (definesAllBlocks.empty() || definesAllBlocks.back() != n)) {
+                definesAllBlocks.push_back(n);
             }
 
             for (const SharedExp &exp : locationSet) {
                 if (canRename(exp)) {
                     m_definedAt[n].insert(exp->clone());
-                    m_defStmts[exp] = stmt;
                 }
             }
         }
     }
 
+    // Number the variables defined anywhere, so the def sites and liveness of each variable
+    // can be stored as bit sets indexed by block. Numbers follow the order of the variables.
+    std::map<SharedExp, int, lessExpStar> varIndices;
     for (int n = 0; n < numBB; n++) {
         for (const SharedExp &a : m_definedAt[n]) {
-            m_defsites[a].insert(n);
+            varIndices.insert({ a, 0 });
         }
     }
 
-    bool change = false;
+    std::vector<SharedExp> vars;
+    vars.reserve(varIndices.size());
+
+    for (auto &val : varIndices) {
+        val.second = static_cast<int>(vars.size());
+        vars.push_back(val.first);
+    }
+
+    // defsites[i] contains the blocks defining variable i, in ascending order;
+    // isDefsite[i] contains the same blocks as a bit set
+    std::vector<std::vector<int>> defsites(vars.size());
+    std::vector<BitSet> isDefsite(vars.size(), BitSet(numBB));
+    for (int n = 0; n < numBB; n++) {
+        for (const SharedExp &a : m_definedAt[n]) {
+            const int i = varIndices[a];
+            defsites[i].push_back(n);
+            isDefsite[i].set(n);
+        }
+    }
+
+    std::vector<BitSet> liveIn;
+    if (settings->prunedSSA) {
+        calculateLiveIn(varIndices, liveIn);
+    }
+
+    Prog::PhiStats &stats = m_proc->getProg()->getPhiStats();
+    bool change           = false;
+
+    // Blocks that already have (or had) a phi function for the current variable.
+    // Only the blocks in hasPhiBlocks are reset for the next variable.
+    BitSet hasPhi(numBB);
+    std::vector<int> hasPhiBlocks;
+    std::vector<int> W;
+
     // For each variable a (in defsites, i.e. defined anywhere)
-    for (auto &val : m_defsites) {
-        SharedExp a = val.first;
+    for (std::size_t i = 0; i < vars.size(); i++) {
+        const SharedExp &a       = vars[i];
+        std::set<int> &phiBlocks = m_A_phi[a];
 
-        // Those variables that are defined everywhere (i.e. in defallsites)
-        // need to be defined at every defsite, too
-        for (int da : m_defallsites) {
-            m_defsites[a].insert(da);
+        for (int y : hasPhiBlocks) {
+            hasPhi.reset(y);
         }
 
-        std::set<int> W = m_defsites[a];
+        hasPhiBlocks.assign(phiBlocks.begin(), phiBlocks.end());
+        for (int y : phiBlocks) {
+            hasPhi.set(y);
+        }
+
+        // Those variables that are defined everywhere (i.e. in blocks defining all variables)
+        // need to be defined at every defsite, too
+        W.clear();
+        std::set_union(defsites[i].begin(), defsites[i].end(), definesAllBlocks.begin(),
+                       definesAllBlocks.end(), std::back_inserter(W));
 
         while (!W.empty()) {
-            // Pop first node from W
-            const int n = *W.begin();
-            W.erase(W.begin());
+            const int n = W.back();
+            W.pop_back();
 
             for (int y : m_DF[n]) {
-                // phi function already created for y?
-                if (m_A_phi[a].find(y) != m_A_phi[a].end()) {
+                // phi function already created (or pruned) for y?
+                if (hasPhi.test(y)) {
                     continue;
                 }
 
-                // Insert trivial phi function for a at top of block y: a := phi()
-                change = true;
-                m_BBs[y]->addPhi(a->clone());
+                hasPhi.set(y);
+                hasPhiBlocks.push_back(y);
 
-                // A_phi[a] <- A_phi[a] U {y}
-                m_A_phi[a].insert(y);
+                if (liveIn.empty() || liveIn[y].test(i)) {
+                    // Insert trivial phi function for a at top of block y: a := phi()
+                    change = true;
+                    m_BBs[y]->addPhi(a->clone());
+                    stats.numPlaced++;
+
+                    // A_phi[a] <- A_phi[a] U {y}
+                    phiBlocks.insert(y);
+                }
+                else {
+                    // a is dead at the start of y, so the phi function would be unused
+                    stats.numPruned++;
+                }
 
                 // if a !elementof A_orig[y]
-                if (!m_definedAt[y].contains(a)) {
+                if (!isDefsite[i].test(y)) {
                     // W <- W U {y}
-                    W.insert(y);
+                    W.push_back(y);
                 }
             }
         }
@@ -371,6 +415,112 @@ bool DataFlow::placePhiFunctions()
 }
 
 
+void DataFlow::calculateLiveIn(const std::map<SharedExp, int, lessExpStar> &varIndices,
+                               std::vector<BitSet> &liveIn)
+{
+    const int numBB                = static_cast<int>(m_BBs.size());
+    const std::size_t numVars      = varIndices.size();
+    const bool assumeABICompliance = m_proc->getProg()->getProject()->getSettings()->assumeABI;
+
+    auto varIndexOf = [&varIndices](SharedExp e) {
+        if (e->isSubscript()) {
+            e = e->getSubExp1();
+        }
+
+        auto it = varIndices.find(e);
+        return it != varIndices.end() ? it->second : -1;
+    };
+
+    // For each block, the variables used before they are defined in the block (gen)
+    // and the variables defined in the block (kill)
+    std::vector<BitSet> gen(numBB, BitSet(numVars));
+    std::vector<BitSet> kill(numBB, BitSet(numVars));
+    std::vector<std::vector<int>> successors(numBB);
+
+    for (int n = 0; n < numBB; n++) {
+        BasicBlock *bb = m_BBs[n];
+
+        for (BasicBlock *succ : bb->getSuccessors()) {
+            successors[n].push_back(pbbToNode(succ));
+        }
+
+        BasicBlock::RTLRIterator rrit;
+        RTL::reverse_iterator srit;
+
+        for (Statement *S = bb->getLastStmt(rrit, srit); S; S = bb->getPrevStmt(rrit, srit)) {
+            LocationSet locs;
+            S->getDefinitions(locs, assumeABICompliance);
+
+            for (const SharedExp &def : locs) {
+                const int i = varIndexOf(def);
+                if (i != -1) {
+                    gen[n].reset(i);
+                    kill[n].set(i);
+                }
+            }
+
+            // The collectors of calls and returns take the reaching definitions
+            // of all variables, so calls and returns use every variable
+            if (S->isCall() || S->isReturn()) {
+                gen[n].setAll();
+                continue;
+            }
+
+            locs.clear();
+            S->addUsedLocs(locs);
+
+            // Phi functions are treated as using their variable at the start of the block,
+            // which keeps the variable live in all predecessors.
+            if (S->isPhi()) {
+                locs.insert(static_cast<PhiAssign *>(S)->getLeft());
+            }
+
+            for (const SharedExp &use : locs) {
+                const int i = varIndexOf(use);
+                if (i != -1) {
+                    gen[n].set(i);
+                }
+            }
+        }
+    }
+
+    // Iterate liveIn[n] = gen[n] U (liveOut[n] - kill[n]) to a fixed point.
+    // Blocks without successors (e.g. unresolved computed jumps) might lead anywhere,
+    // so everything is live at their end.
+    liveIn.assign(numBB, BitSet(numVars));
+    BitSet live(numVars);
+    bool change = true;
+
+    while (change) {
+        change = false;
+
+        for (int n = numBB - 1; n >= 0; n--) {
+            // live = liveOut[n]
+            if (successors[n].empty()) {
+                live.setAll();
+            }
+            else {
+                live.resetAll();
+            }
+
+            for (int succ : successors[n]) {
+                live |= liveIn[succ];
+            }
+
+            // live = gen[n] U (liveOut[n] - kill[n])
+            live.subtract(kill[n]);
+            live |= gen[n];
+
+            // liveIn only grows, so it changed iff it differs
+            if (live != liveIn[n]) {
+                liveIn[n] = live;
+                change    = true;
+            }
+        }
+    }
+}
+
+
 void DataFlow::convertImplicits()
 {
     ProcCFG *cfg = m_proc->getCFG();
@@ -386,15 +536,6 @@ void DataFlow::convertImplicits()
         m_A_phi[e]  = it.second; // Copy the set (doesn't have to be deep)
     }
 
-    std::map<SharedExp, std::set<int>, lessExpStar> defsites_copy = m_defsites; // Object copy
-    m_defsites.clear();
-
-    for (std::pair<SharedExp, std::set<int>> dd : defsites_copy) {
-        SharedExp e   = dd.first->clone();
-        e             = e->acceptModifier(&ic);
-        m_defsites[e] = dd.second; // Copy the set (doesn't have to be deep)
-    }
-
     std::vector<ExSet> definedAtCopy = m_definedAt;
     m_definedAt.clear();
 
@@ -428,7 +569,7 @@ void DataFlow::findLiveAtDomPhi(int n, LocationSet &usedByDomPhi, LocationSet &u
 
     // For each statement this BB
     BasicBlock::RTLIterator rit;
-    StatementList::iterator sit;
+    RTL::iterator sit;
     BasicBlock *bb                 = m_BBs[n];
     const bool assumeABICompliance = m_proc->getProg()->getProject()->getSettings()->assumeABI;
 
@@ -514,9 +655,6 @@ void DataFlow::allocateData()
     m_DF.resize(numBBs);
 
     m_A_phi.clear();
-    m_defsites.clear();
-    m_defallsites.clear();
-    m_defStmts.clear();
 
 
     // Set up the BBs and indices vectors. Do this here
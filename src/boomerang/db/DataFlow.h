@@ -10,10 +10,12 @@
 #pragma once
 
 
+#include "boomerang/util/BitSet.h"
 #include "boomerang/util/LocationSet.h"
 
 #include <map>
 #include <unordered_map>
+#include <vector>
 
 
 class BasicBlock;
@@ -46,8 +48,12 @@ public:
      */
     bool calculateDominators();
 
-    /// Place phi functions.
-    /// \returns true if any change
+    /**
+     * Place phi functions.
+     * Unless Settings::prunedSSA is false, phi functions are only placed where the variable
+     * is live, i.e. where the phi function might be used.
+     * \returns true if any change
+     */
     bool placePhiFunctions();
 
     /// \returns true if the expression \p e can be renamed
@@ -139,6 +145,14 @@ private:
 private:
     void allocateData();
 
+    /**
+     * Calculate the variables that are live at the start of each block.
+     * \param varIndices maps each variable to its index in the bit sets of \p liveIn
+     * \param liveIn bit i of liveIn[n] is set if variable i is live at the start of block n.
+     */
+    void calculateLiveIn(const std::map<SharedExp, int, lessExpStar> &varIndices,
+                         std::vector<BitSet> &liveIn);
+
     void findLiveAtDomPhi(int n, LocationSet &usedByDomPhi, LocationSet &usedByDomPhi0,
                           std::map<SharedExp, PhiAssign *, lessExpStar> &defdByPhi);
 
@@ -179,15 +193,6 @@ private:
     /// For a given expression e, stores the BBs needing a phi for e
     std::map<SharedExp, std::set<int>, lessExpStar> m_A_phi;
 
-    /// For a given expression e, stores the BBs where e is defined
-    std::map<SharedExp, std::set<int>, lessExpStar> m_defsites;
-
-    /// Set of block numbers defining all variables
-    std::set<int> m_defallsites;
-
-    /// A Boomerang requirement: Statements defining particular subscripted locations
-    std::map<SharedExp, Statement *, lessExpStar> m_defStmts;
-
     /**
      * Initially false, meaning that locals and parameters are not renamed and hence not propagated.
      * When true, locals and parameters can be renamed if their address does not escape the local
@@ -14,6 +14,8 @@
 
 #include <QtAlgorithms>
 
+#include <algorithm>
+
 
 DefCollector::~DefCollector()
 {
@@ -28,17 +30,13 @@ void DefCollector::clear()
 }
 
 
-void DefCollector::updateDefs(std::map<SharedExp, std::deque<Statement *>, lessExpStar> &Stacks,
+void DefCollector::updateDefs(const std::vector<std::pair<SharedExp, Statement *>> &reachingDefs,
                               UserProc *proc)
 {
-    for (auto &Stack : Stacks) {
-        if (Stack.second.empty()) {
-            continue; // This variable's definition doesn't reach here
-        }
-
+    for (const auto &reachingDef : reachingDefs) {
         // Create an assignment of the form loc := loc{def}
-        auto re    = RefExp::get(Stack.first->clone(), Stack.second.back());
-        Assign *as = new Assign(Stack.first->clone(), re);
+        auto re    = RefExp::get(reachingDef.first->clone(), reachingDef.second);
+        Assign *as = new Assign(reachingDef.first->clone(), re);
         as->setProc(proc); // Simplify sometimes needs this
         insert(as);
     }
@@ -91,10 +89,10 @@ void DefCollector::print(OStream &os) const
 
 SharedExp DefCollector::findDefFor(SharedExp e) const
 {
-    for (Assign *def : m_defs) {
-        SharedExp lhs = def->getLeft();
-
-        if (*lhs == *e) {
+    // Not a binary search, since operator== also matches wildcards
+    // and subscripts of nullptr with subscripts of implicit assignments.
+    for (const Assign *def : m_defs) {
+        if (*def->getLeft() == *e) {
             return def->getRight();
         }
     }
@@ -117,8 +115,15 @@ void DefCollector::makeCloneOf(const DefCollector &other)
 
 void DefCollector::searchReplaceAll(const Exp &from, SharedExp to, bool &changed)
 {
+    bool defsChanged = false;
+
     for (auto def : m_defs) {
-        changed |= def->searchAndReplace(from, to);
+        defsChanged |= def->searchAndReplace(from, to);
+    }
+
+    if (defsChanged) {
+        m_defs.sort();
+        changed = true;
     }
 }
 
@@ -127,10 +132,18 @@ void DefCollector::insert(Assign *a)
 {
     SharedExp l = a->getLeft();
 
-    if (existsOnLeft(l)) {
+    if (existsOnLeft(l) || !m_defs.insert(a).second) {
         delete a;
-        return;
+    }
+}
+
+
+bool DefCollector::existsOnLeft(SharedExp e) const
+{
+    if (!e) {
+        return false;
     }
 
-    m_defs.insert(a);
+    return std::any_of(m_defs.begin(), m_defs.end(),
+                       [&e](const Assign *def) { return def->definesLoc(e); });
 }
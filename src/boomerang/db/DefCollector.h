@@ -11,10 +11,11 @@
 
 
 #include "boomerang/ssl/exp/ExpHelp.h"
+#include "boomerang/util/FlatSet.h"
 #include "boomerang/util/StatementSet.h"
 
-#include <deque>
-#include <map>
+#include <utility>
+#include <vector>
 
 
 class Statement;
@@ -24,12 +25,15 @@ class UserProc;
 /**
  * This class collects all definitions that reach the statement
  * that contains this collector.
+ *
+ * The definitions are kept in a flat set sorted by their left hand sides.
  */
 class BOOMERANG_API DefCollector
 {
 public:
-    typedef AssignSet::const_iterator const_iterator;
-    typedef AssignSet::iterator iterator;
+    typedef FlatSet<Assign *, lessAssign> DefSet;
+    typedef DefSet::const_iterator const_iterator;
+    typedef DefSet::iterator iterator;
 
 public:
     DefCollector()                          = default;
@@ -42,8 +46,6 @@ public:
     DefCollector &operator=(DefCollector &&other) = default;
 
 public:
-    iterator begin() { return m_defs.begin(); }
-    iterator end() { return m_defs.end(); }
     const_iterator begin() const { return m_defs.begin(); }
     const_iterator end() const { return m_defs.end(); }
 
@@ -67,13 +69,18 @@ public:
     /// Print the collected locations to stream os
     void print(OStream &os) const;
 
-    bool existsOnLeft(SharedExp e) const { return m_defs.definesLoc(e); }
+    /// \returns true if any of the definitions defines \p e
+    bool existsOnLeft(SharedExp e) const;
+
+    /// \returns the number of definitions
+    int size() const { return m_defs.size(); }
 
     /**
-     * Update the definitions with the current set of reaching definitions
-     * proc is the enclosing procedure
+     * Update the definitions with the current set of reaching definitions.
+     * \param reachingDefs the locations and their reaching definitions, sorted by location
+     * \param proc the enclosing procedure
      */
-    void updateDefs(std::map<SharedExp, std::deque<Statement *>, lessExpStar> &Stacks,
+    void updateDefs(const std::vector<std::pair<SharedExp, Statement *>> &reachingDefs,
                     UserProc *proc);
 
     /**
@@ -86,11 +93,14 @@ public:
     /// Search and replace all occurrences
     void searchReplaceAll(const Exp &pattern, SharedExp replacement, bool &change);
 
+    /// Restore the order of the definitions after they were modified in place
+    void sort() { m_defs.sort(); }
+
 private:
     /**
      * True if initialised. When not initialised, callees should not
      * subscript parameters inserted into the associated CallStatement
      */
     bool m_initialised = false;
-    AssignSet m_defs; ///< The set of definitions.
+    DefSet m_defs; ///< The set of definitions.
 };
@@ -23,6 +23,7 @@
 #include "boomerang/db/module/Module.h"
 #include "boomerang/db/proc/LibProc.h"
 #include "boomerang/db/proc/ProcCFG.h"
+#include "boomerang/db/proc/ProofCache.h"
 #include "boomerang/db/proc/UserProc.h"
 #include "boomerang/db/signature/Signature.h"
 #include "boomerang/ifc/ICodeGenerator.h"
@@ -40,6 +41,7 @@
 #include "boomerang/ssl/type/IntegerType.h"
 #include "boomerang/ssl/type/PointerType.h"
 #include "boomerang/ssl/type/SizeType.h"
+#include "boomerang/ssl/type/TypeContext.h"
 #include "boomerang/util/Types.h"
 #include "boomerang/util/Util.h"
 #include "boomerang/util/log/Log.h"
@@ -48,12 +50,12 @@
 #include <QFileInfo>
 #include <QSaveFile>
 
-#include <cctype>
-
 
 Prog::Prog(const QString &name, Project *project)
     : m_name(name)
     , m_symbolProvider(new CSymbolProvider(this))
+    , m_proofCache(new ProofCache())
+    , m_typeContext(new TypeContext())
     , m_project(project)
     , m_binaryFile(project ? project->getLoadedBinaryFile() : nullptr)
     , m_fe(nullptr)
@@ -419,8 +421,6 @@ const char *Prog::getStringConstant(Address addr, bool knownString /* = false */
         return nullptr;
     }
 
-    // At this stage, only support ascii, null terminated, non unicode strings.
-    // At least 4 of the first 6 chars should be printable ascii
     const char *p = reinterpret_cast<const char *>(
         (sect->getHostAddr() - sect->getSourceAddr() + addr).value());
 
@@ -428,32 +428,13 @@ const char *Prog::getStringConstant(Address addr, bool knownString /* = false */
         // No need to guess... this is hopefully a known string
         return p;
     }
-
-    // this address is not known to be a string -> use heuristic
-    int numPrintables = 0;
-    int numControl    = 0; // Control characters like \n, \r, \t
-    int numTotal      = 0;
-
-    for (int i = 0; i < 6; i++, numTotal++) {
-        if (p[i] == 0) {
-            break;
-        }
-        else if (std::isprint(static_cast<Byte>(p[i]))) {
-            numPrintables++;
-        }
-        else if (*p == '\n' || *p == '\t' || *p == '\r') {
-            numControl++;
-        }
-    }
-
-    if (numTotal == 0) {
+    else if (*p == 0) {
         return "";
     }
-    else if (numTotal - numPrintables - numControl < 2) {
-        return p;
-    }
 
-    return nullptr;
+    // this address is not known to be a string -> look it up in the strings of the image.
+    // At this stage, only support ascii, null terminated, non unicode strings.
+    return m_binaryFile->getImage()->findString(addr);
 }
 
 
@@ -576,6 +557,12 @@ int Prog::readNative4(Address a) const
 }
 
 
+int Prog::readNative4Array(Address a, int count, std::vector<DWord> &values) const
+{
+    return m_binaryFile->getImage()->readNative4Array(a, count, values);
+}
+
+
 void Prog::updateLibrarySignatures()
 {
     for (const auto &m : m_moduleList) {
@@ -813,7 +800,7 @@ SharedType Prog::guessGlobalType(const QString &globalName, Address globAddr) co
     case 4:
     case 8: ty = IntegerType::get(sz * 8); break;
 
-    default: ty = std::make_shared<ArrayType>(std::make_shared<CharType>(), sz);
+    default: ty = std::make_shared<ArrayType>(CharType::get(), sz);
     }
 
     return ty;
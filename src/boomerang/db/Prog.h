@@ -17,6 +17,7 @@
 #include "boomerang/frontend/SigEnum.h"
 #include "boomerang/type/DataIntervalMap.h"
 #include "boomerang/util/Address.h"
+#include "boomerang/util/Types.h"
 
 #include <QString>
 
@@ -24,6 +25,7 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <vector>
 
 
 class ArrayType;
@@ -35,6 +37,8 @@ class IFrontEnd;
 class LibProc;
 class Module;
 class Project;
+class ProofCache;
+class TypeContext;
 class Signature;
 class ISymbolProvider;
 
@@ -181,6 +185,11 @@ public:
 
     int readNative4(Address a) const;
 
+    /// Read a table of \p count 32 bit values starting at \p a.
+    /// \returns the number of values read.
+    /// \sa BinaryImage::readNative4Array
+    int readNative4Array(Address a, int count, std::vector<DWord> &values) const;
+
     void updateLibrarySignatures();
 
 
@@ -197,6 +206,35 @@ public:
 
     const std::list<UserProc *> &getEntryProcs() const { return m_entryProcs; }
 
+    /// \returns the results of the proofs of all procedures (see UserProc::proveEqual)
+    ProofCache *getProofCache() { return m_proofCache.get(); }
+    const ProofCache *getProofCache() const { return m_proofCache.get(); }
+
+    /// \returns the canonical types and the meet results of this program
+    TypeContext *getTypeContext() { return m_typeContext.get(); }
+    const TypeContext *getTypeContext() const { return m_typeContext.get(); }
+
+    /// Statistics about the phi functions of all procedures
+    struct PhiStats
+    {
+        uint64 numPlaced  = 0; ///< number of phi functions placed by DataFlow::placePhiFunctions
+        uint64 numPruned  = 0; ///< number of phi functions not placed because they would be dead
+        uint64 numRemoved = 0; ///< number of phi functions removed by UserProc::removeStatement
+    };
+
+    PhiStats &getPhiStats() { return m_phiStats; }
+    const PhiStats &getPhiStats() const { return m_phiStats; }
+
+    /// Statistics about the assignments to overlapping registers (e.g. %ax after %eax := ...)
+    struct OverlapStats
+    {
+        uint64 numInserted = 0; ///< number of assignments inserted by the front end
+        uint64 numPruned   = 0; ///< number of assignments not inserted because they would be dead
+    };
+
+    OverlapStats &getOverlapStats() { return m_overlapStats; }
+    const OverlapStats &getOverlapStats() const { return m_overlapStats; }
+
     // globals
 
     /**
@@ -249,6 +287,10 @@ public:
 private:
     QString m_name; ///< name of the program
     std::unique_ptr<ISymbolProvider> m_symbolProvider;
+    std::unique_ptr<ProofCache> m_proofCache; ///< must outlive the procedures
+    std::unique_ptr<TypeContext> m_typeContext;
+    PhiStats m_phiStats;
+    OverlapStats m_overlapStats;
     Project *m_project       = nullptr;
     BinaryFile *m_binaryFile = nullptr;
     IFrontEnd *m_fe          = nullptr; ///< Pointer to the FrontEnd object for the project
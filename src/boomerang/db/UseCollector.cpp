@@ -13,6 +13,8 @@
 #include "boomerang/util/Util.h"
 #include "boomerang/visitor/expmodifier/ExpSSAXformer.h"
 
+#include <algorithm>
+
 
 UseCollector::UseCollector()
     : m_initialised(false)
@@ -26,19 +28,12 @@ bool UseCollector::operator==(const UseCollector &other) const
         return false;
     }
 
-    iterator it1, it2;
-
     if (other.m_locs.size() != m_locs.size()) {
         return false;
     }
 
-    for (it1 = m_locs.begin(), it2 = other.m_locs.begin(); it1 != m_locs.end(); ++it1, ++it2) {
-        if (!(**it1 == **it2)) {
-            return false;
-        }
-    }
-
-    return true;
+    return std::equal(m_locs.begin(), m_locs.end(), other.m_locs.begin(),
+                      [](const SharedExp &loc1, const SharedExp &loc2) { return *loc1 == *loc2; });
 }
 
 
@@ -91,10 +86,9 @@ void UseCollector::print(OStream &os) const
 void UseCollector::fromSSAForm(UserProc *proc, Statement *def)
 {
     LocationSet removes, inserts;
-    iterator it;
     ExpSSAXformer esx(proc);
 
-    for (it = m_locs.begin(); it != m_locs.end(); ++it) {
+    for (const_iterator it = m_locs.begin(); it != m_locs.end(); ++it) {
         auto ref      = RefExp::get(*it, def); // Wrap it in a def
         SharedExp ret = ref->acceptModifier(&esx);
 
@@ -107,12 +101,12 @@ void UseCollector::fromSSAForm(UserProc *proc, Statement *def)
         }
     }
 
-    for (it = removes.begin(); it != removes.end(); ++it) {
-        m_locs.remove(*it);
+    for (const SharedExp &loc : removes) {
+        m_locs.remove(loc);
     }
 
-    for (it = inserts.begin(); it != inserts.end(); ++it) {
-        m_locs.insert(*it);
+    for (const SharedExp &loc : inserts) {
+        m_locs.insert(loc);
     }
 }
 
@@ -123,7 +117,7 @@ void UseCollector::remove(SharedExp loc)
 }
 
 
-void UseCollector::remove(iterator it)
+UseCollector::iterator UseCollector::remove(iterator it)
 {
-    m_locs.erase(it);
+    return m_locs.erase(it);
 }
@@ -10,6 +10,7 @@
 #pragma once
 
 
+#include "boomerang/util/FlatSet.h"
 #include "boomerang/util/LocationSet.h"
 
 
@@ -22,13 +23,16 @@ class UserProc;
  * (or the UserProc that contains it).
  *
  * Typically the entries are not subscripted,
- * like parameters or locations on the LHS of assignments
+ * like parameters or locations on the LHS of assignments.
+ *
+ * Most collectors only contain a few locations, so they are stored in a flat set.
  */
 class BOOMERANG_API UseCollector
 {
 public:
-    typedef LocationSet::iterator iterator;
-    typedef LocationSet::const_iterator const_iterator;
+    typedef FlatSet<SharedExp, lessExpStar> LocSet;
+    typedef LocSet::iterator iterator;
+    typedef LocSet::const_iterator const_iterator;
 
 public:
     UseCollector();
@@ -37,8 +41,6 @@ public:
     bool operator==(const UseCollector &other) const;
     bool operator!=(const UseCollector &other) const { return !(*this == other); }
 
-    inline iterator begin() { return m_locs.begin(); }
-    inline iterator end() { return m_locs.end(); }
     inline const_iterator begin() const { return m_locs.begin(); }
     inline const_iterator end() const { return m_locs.end(); }
 
@@ -60,14 +62,20 @@ public:
 
     /// \returns true if \p e is in the collection
     inline bool exists(SharedExp e) const { return m_locs.contains(e); }
-    LocationSet &getLocSet() { return m_locs; }
+
+    /// \returns the number of collected locations
+    inline int size() const { return m_locs.size(); }
 
 public:
     /// Remove the given location
     void remove(SharedExp loc);
 
     /// Remove the current location
-    void remove(iterator it);
+    /// \returns an iterator to the location after the removed location
+    iterator remove(iterator it);
+
+    /// Restore the order of the locations after they were modified in place
+    void sort() { m_locs.sort(); }
 
     /// Translate out of SSA form
     /// Called from CallStatement::fromSSAForm. The UserProc is needed for the symbol map
@@ -79,5 +87,5 @@ private:
     bool m_initialised;
 
     /// The set of locations. Use lessExpStar to compare properly
-    LocationSet m_locs;
+    LocSet m_locs;
 };
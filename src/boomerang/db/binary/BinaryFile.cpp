@@ -14,8 +14,8 @@
 #include "boomerang/ifc/IFileLoader.h"
 
 
-BinaryFile::BinaryFile(const QByteArray &rawData, IFileLoader *loader)
-    : m_image(new BinaryImage(rawData))
+BinaryFile::BinaryFile(QByteArray rawData, IFileLoader *loader)
+    : m_image(new BinaryImage(std::move(rawData)))
     , m_symbols(new BinarySymbolTable())
     , m_loader(loader)
 {
@@ -59,7 +59,7 @@ enum class Machine : uint8_t
 class BOOMERANG_API BinaryFile
 {
 public:
-    BinaryFile(const QByteArray &rawData, IFileLoader *loader);
+    BinaryFile(QByteArray rawData, IFileLoader *loader);
     BinaryFile(const BinaryFile &) = delete;
     BinaryFile(BinaryFile &&)      = delete;
 
@@ -15,10 +15,12 @@
 #include "boomerang/util/log/Log.h"
 
 #include <algorithm>
+#include <cstring>
+#include <iterator>
 
 
-BinaryImage::BinaryImage(const QByteArray &rawData)
-    : m_rawData(rawData)
+BinaryImage::BinaryImage(QByteArray rawData)
+    : m_rawData(std::move(rawData))
 {
 }
 
@@ -33,6 +35,7 @@ void BinaryImage::reset()
 {
     m_sectionMap.clear();
     m_sections.clear();
+    m_stringSections.clear();
 }
 
 
@@ -152,6 +155,56 @@ bool BinaryImage::readNativeFloat8(Address addr, double &value) const
 }
 
 
+int BinaryImage::readNative4Array(Address addr, int count, std::vector<DWord> &values) const
+{
+    values.clear();
+
+    const BinarySection *si = getSectionByAddr(addr);
+    if (si == nullptr || si->getHostAddr() == HostAddress::INVALID) {
+        LOG_WARN("Invalid read at address %1: Address is not mapped to a section", addr.toString());
+        return 0;
+    }
+
+    if (count <= 0) {
+        return 0;
+    }
+
+    // Clamp the table to the end of the section
+    const Address sectionEnd           = si->getSourceAddr() + si->getSize();
+    const Address::value_type maxCount = (sectionEnd - addr).value() / 4;
+    if (static_cast<Address::value_type>(count) > maxCount) {
+        LOG_WARN("Invalid read at address %1: Table of %2 entries extends past section boundary",
+                 addr, count);
+        count = static_cast<int>(maxCount);
+    }
+
+    values.resize(count);
+
+    const HostAddress host = si->getHostAddr() - si->getSourceAddr() + addr;
+    std::memcpy(values.data(), reinterpret_cast<const void *>(host.value()), count * sizeof(DWord));
+
+    // Byte swap all values in one tight loop instead of one call per value,
+    // so the compiler can vectorize it.
+    constexpr Endian hostEndian = static_cast<Endian>(BOOMERANG_BIG_ENDIAN);
+    if (si->getEndian() != hostEndian) {
+        for (DWord &val : values) {
+            val = Util::swapEndian(val);
+        }
+    }
+
+    // Only writable sections can contain uninitialized data
+    if (!si->isReadOnly()) {
+        for (int i = 0; i < count; ++i) {
+            if (si->isAddressBss(addr + i * 4)) {
+                values[i] = 0;
+            }
+        }
+    }
+
+    return count;
+}
+
+
 bool BinaryImage::writeNative4(Address addr, uint32_t value)
 {
     BinarySection *si = getSectionByAddr(addr);
@@ -215,6 +268,143 @@ void BinaryImage::updateTextLimits()
 }
 
 
+/// \returns true if \p c is a printable ASCII character or whitespace
+static bool isTextChar(Byte c)
+{
+    return (c >= 0x20 && c < 0x7F) || (c >= '\t' && c <= '\r');
+}
+
+
+/**
+ * \returns true if the \p len characters at \p str are likely to be text.
+ * At most one of the first 6 characters may be a control character or a non-ASCII character;
+ * the continuation bytes of a UTF-8 character do not count as separate characters.
+ */
+static bool isLikelyText(const char *str, std::size_t len)
+{
+    const std::size_t numChecked = std::min<std::size_t>(6, len);
+    int numText                  = 0;
+    int numOther                 = 0;
+
+    for (std::size_t i = 0; i < numChecked; i++) {
+        const Byte c = static_cast<Byte>(str[i]);
+
+        if (isTextChar(c)) {
+            numText++;
+        }
+        else if ((c & 0xC0) == 0x80 && i > 0 && static_cast<Byte>(str[i - 1]) >= 0x80) {
+            continue; // UTF-8 continuation byte
+        }
+        else {
+            numOther++;
+        }
+    }
+
+    return numText > 0 && numOther < 2;
+}
+
+
+/// \returns true if \p section has contents that can contain strings
+static bool hasStringData(const BinarySection *section)
+{
+    return !section->isBss() && section->getHostAddr() != HostAddress::INVALID &&
+           section->getHostAddr() != HostAddress::ZERO && section->getSize() > 0;
+}
+
+
+void BinaryImage::updateStringIndex()
+{
+    m_stringSections.clear();
+
+    for (const BinarySection *section : m_sections) {
+        if (section->isCode() || !hasStringData(section)) {
+            continue;
+        }
+
+        const char *sectionStart = reinterpret_cast<const char *>(section->getHostAddr().value());
+        const char *sectionEnd   = sectionStart + section->getSize();
+        const char *pos          = sectionStart;
+
+        std::vector<StringRun> runs;
+
+        // Find the terminators with memchr (which is vectorized).
+        while (pos < sectionEnd) {
+            const char *nul = static_cast<const char *>(std::memchr(pos, 0, sectionEnd - pos));
+            if (!nul) {
+                break; // no terminator for the rest of the section
+            }
+
+            if (std::any_of(pos, nul, [](char c) { return isTextChar(static_cast<Byte>(c)); })) {
+                runs.push_back({ static_cast<uint32>(pos - sectionStart),
+                                 static_cast<uint32>(nul - sectionStart) });
+            }
+
+            pos = nul + 1;
+        }
+
+        if (!runs.empty()) {
+            runs.shrink_to_fit();
+            m_stringSections.push_back({ section, std::move(runs) });
+        }
+    }
+
+    // sections are not necessarily sorted by address
+    std::sort(m_stringSections.begin(), m_stringSections.end(),
+              [](const StringSection &a, const StringSection &b) {
+                  return a.section->getSourceAddr() < b.section->getSourceAddr();
+              });
+
+    LOG_VERBOSE("Found strings in %1 sections of binary image",
+                static_cast<int>(m_stringSections.size()));
+}
+
+
+const char *BinaryImage::findString(Address addr) const
+{
+    const BinarySection *section = getSectionByAddr(addr);
+    if (!section || !hasStringData(section)) {
+        return nullptr;
+    }
+
+    const char *sectionStart = reinterpret_cast<const char *>(section->getHostAddr().value());
+    const uint32 offset      = static_cast<uint32>((addr - section->getSourceAddr()).value());
+    const char *str          = sectionStart + offset;
+
+    if (section->isCode()) {
+        // Code sections are not indexed since they rarely contain strings.
+        const char *nul = static_cast<const char *>(
+            std::memchr(str, 0, section->getSize() - offset));
+
+        return (nul && isLikelyText(str, nul - str)) ? str : nullptr;
+    }
+
+    auto sectIt = std::lower_bound(m_stringSections.begin(), m_stringSections.end(), section,
+                                   [](const StringSection &sect, const BinarySection *s) {
+                                       return sect.section->getSourceAddr() < s->getSourceAddr();
+                                   });
+
+    if (sectIt == m_stringSections.end() || sectIt->section != section) {
+        return nullptr;
+    }
+
+    // first string starting after addr
+    const std::vector<StringRun> &runs = sectIt->runs;
+    auto it = std::upper_bound(runs.begin(), runs.end(), offset,
+                               [](uint32 off, const StringRun &run) { return off < run.start; });
+
+    if (it == runs.begin()) {
+        return nullptr;
+    }
+
+    const StringRun &run = *std::prev(it);
+    if (offset >= run.end) {
+        return nullptr;
+    }
+
+    return isLikelyText(str, run.end - offset) ? str : nullptr;
+}
+
+
 bool BinaryImage::isReadOnly(Address addr) const
 {
     const BinarySection *section = getSectionByAddr(addr);
@@ -272,7 +462,7 @@ BinarySection *BinaryImage::createSection(const QString &name, Address from, Add
     // section. It can therefore overlap other sections containing data. This is a quirk of ELF
     // programs linked statically with glibc
     if (name != ".tbss") {
-        IntervalMap<Address, std::unique_ptr<BinarySection>>::iterator itFrom, itTo;
+        FlatIntervalMap<Address, std::unique_ptr<BinarySection>>::iterator itFrom, itTo;
         std::tie(itFrom, itTo) = m_sectionMap.equalRange(from, to);
 
         for (auto clash_with = itFrom; clash_with != itTo; ++clash_with) {
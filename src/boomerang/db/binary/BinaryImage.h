@@ -11,7 +11,8 @@
 
 
 #include "boomerang/util/Address.h"
-#include "boomerang/util/IntervalMap.h"
+#include "boomerang/util/FlatIntervalMap.h"
+#include "boomerang/util/Types.h"
 
 #include <QByteArray>
 
@@ -38,7 +39,7 @@ class BOOMERANG_API BinaryImage
     typedef SectionList::const_reverse_iterator const_reverse_iterator;
 
 public:
-    BinaryImage(const QByteArray &rawData);
+    BinaryImage(QByteArray rawData);
     BinaryImage(const BinaryImage &other) = delete;
     BinaryImage(BinaryImage &&other)      = delete;
 
@@ -102,6 +103,25 @@ public:
 
     Interval<Address> getLimitText() const;
 
+    /**
+     * After loading the image, index all strings in the initialized data sections,
+     * so that findString does not need to search for their terminators.
+     * A string is a run of non-NUL bytes that contains a printable ASCII character
+     * and is terminated by a NUL character in the same section.
+     * Code and BSS sections are not indexed.
+     */
+    void updateStringIndex();
+
+    /**
+     * \returns a pointer to the host copy of \p addr if \p addr is the start or inside
+     * of a NUL terminated string that is likely to be text, or nullptr if it is not.
+     * At most one of the first 6 characters at \p addr may be a control character
+     * or a non-ASCII character, otherwise the string is more likely data than text.
+     * Strings in data sections are looked up in the index built by updateStringIndex;
+     * strings in code sections are read from the image.
+     */
+    const char *findString(Address addr) const;
+
     ptrdiff_t getTextDelta() const { return m_textDelta; }
 
 
@@ -113,11 +133,36 @@ public:
     bool readNativeFloat4(Address addr, float &value) const;
     bool readNativeFloat8(Address addr, double &value) const;
 
+    /**
+     * Read a table of \p count consecutive 32 bit values starting at \p addr
+     * (e.g. a switch table) with a single section lookup.
+     * Values in uninitialized (BSS) memory are read as 0.
+     * \param values receives the values that could be read.
+     * \returns the number of values read. This is less than \p count
+     * if the table extends past the end of the section containing \p addr.
+     */
+    int readNative4Array(Address addr, int count, std::vector<DWord> &values) const;
+
     bool writeNative4(Address addr, DWord value);
 
     /// \returns true if \p addr is in a read-only section
     bool isReadOnly(Address addr) const;
 
+private:
+    /// A string found by updateStringIndex. Offsets are relative to the start of the section.
+    struct StringRun
+    {
+        uint32 start; ///< offset of the first character
+        uint32 end;   ///< offset of the NUL terminator
+    };
+
+    /// The strings of a section
+    struct StringSection
+    {
+        const BinarySection *section;
+        std::vector<StringRun> runs; ///< sorted by offset
+    };
+
 private:
     QByteArray m_rawData;
     Address m_limitTextLow  = Address::INVALID;
@@ -125,5 +170,7 @@ private:
     ptrdiff_t m_textDelta   = 0;
 
     SectionList m_sections; ///< The section info
-    IntervalMap<Address, std::unique_ptr<BinarySection>> m_sectionMap;
+    FlatIntervalMap<Address, std::unique_ptr<BinarySection>> m_sectionMap;
+
+    std::vector<StringSection> m_stringSections; ///< Sorted by address
 };
@@ -9,8 +9,8 @@
 #pragma endregion License
 #include "BinarySection.h"
 
-#include "boomerang/util/IntervalMap.h"
-#include "boomerang/util/IntervalSet.h"
+#include "boomerang/util/FlatIntervalMap.h"
+#include "boomerang/util/FlatIntervalSet.h"
 #include "boomerang/util/Util.h"
 #include "boomerang/util/log/Log.h"
 
@@ -95,8 +95,8 @@ public:
     }
 
 public:
-    IntervalSet<Address> m_hasDefinedValue;
-    IntervalMap<Address, VariantHolder> m_attributeMap;
+    FlatIntervalSet<Address> m_hasDefinedValue;
+    FlatIntervalMap<Address, VariantHolder> m_attributeMap;
 };
 
 
@@ -12,7 +12,9 @@
 #include "boomerang/db/binary/BinarySymbol.h"
 #include "boomerang/util/log/Log.h"
 
-#include <cassert>
+#include <algorithm>
+#include <iterator>
+#include <utility>
 
 
 BinarySymbolTable::BinarySymbolTable()
@@ -20,73 +22,153 @@ BinarySymbolTable::BinarySymbolTable()
 }
 
 
+BinarySymbolTable::BinarySymbolTable(BinarySymbolTable &&other)
+{
+    // leave other empty, so it does not delete the symbols
+    *this = std::move(other);
+}
+
+
 BinarySymbolTable::~BinarySymbolTable()
 {
     clear();
 }
 
 
+BinarySymbolTable &BinarySymbolTable::operator=(BinarySymbolTable &&other)
+{
+    // the symbols of this table are deleted by other
+    std::swap(m_addrIndex, other.m_addrIndex);
+    std::swap(m_nameIndex, other.m_nameIndex);
+    std::swap(m_addrOrder, other.m_addrOrder);
+    std::swap(m_numSortedAddrs, other.m_numSortedAddrs);
+    std::swap(m_symbolList, other.m_symbolList);
+    return *this;
+}
+
+
 void BinarySymbolTable::clear()
 {
     m_addrIndex.clear();
-    m_symbolList.clear();
     m_nameIndex.clear();
+    m_addrOrder.clear();
+    m_numSortedAddrs = 0;
+
+    for (BinarySymbol *sym : m_symbolList) {
+        delete sym;
+    }
+
+    m_symbolList.clear();
+}
+
+
+void BinarySymbolTable::reserve(int numSymbols)
+{
+    if (numSymbols <= 0) {
+        return;
+    }
+
+    m_addrIndex.reserve(numSymbols);
+    m_nameIndex.reserve(numSymbols);
+    m_addrOrder.reserve(numSymbols);
+    m_symbolList.reserve(numSymbols);
 }
 
 
 BinarySymbol *BinarySymbolTable::createSymbol(Address addr, const QString &name, bool local)
 {
-    if (m_addrIndex.find(addr) != m_addrIndex.end()) {
+    auto addrIt = m_addrIndex.find(addr.value());
+    if (addrIt != m_addrIndex.end()) {
         return nullptr; // symbol already exists
     }
 
     // If the symbol already exists, redirect the new symbol to the old one.
-    std::map<QString, std::shared_ptr<BinarySymbol>>::iterator it = m_nameIndex.find(name);
+    auto nameIt = m_nameIndex.find(name);
 
-    if (it != m_nameIndex.end()) {
+    if (nameIt != m_nameIndex.end()) {
         LOG_WARN("Symbol '%1' already exists in the global symbol table!", name);
-        std::shared_ptr<BinarySymbol> existingSymbol = it->second;
-        m_addrIndex[addr]                            = existingSymbol;
-        return existingSymbol.get();
+        BinarySymbol *existingSymbol = nameIt.value();
+        m_addrIndex[addr.value()]    = existingSymbol;
+        addAddress(addr, existingSymbol);
+        return existingSymbol;
     }
 
-    std::shared_ptr<BinarySymbol> sym = std::make_shared<BinarySymbol>(addr, name);
-    m_addrIndex[addr]                 = sym;
+    BinarySymbol *sym         = new BinarySymbol(addr, name);
+    m_addrIndex[addr.value()] = sym;
+    addAddress(addr, sym);
 
     if (!local) {
-        m_nameIndex[name] = sym;
+        // Use the name of the symbol as key so the string data is shared
+        m_nameIndex.insert(sym->getName(), sym);
+    }
+
+    m_symbolList.push_back(sym);
+    return sym;
+}
+
+
+std::vector<BinarySymbol *>
+BinarySymbolTable::createSymbols(const std::vector<BinarySymbolDefinition> &definitions)
+{
+    reserve(size() + static_cast<int>(definitions.size()));
+
+    std::vector<BinarySymbol *> result;
+    result.reserve(definitions.size());
+
+    for (const BinarySymbolDefinition &def : definitions) {
+        result.push_back(createSymbol(def.addr, def.name, def.local));
     }
 
-    m_symbolList.push_back(sym.get());
-    return sym.get();
+    // Sort once now instead of on the first query
+    sortAddresses();
+    return result;
 }
 
 
 BinarySymbol *BinarySymbolTable::findSymbolByAddress(Address addr)
 {
-    auto ff = m_addrIndex.find(addr);
-    return (ff != m_addrIndex.end()) ? ff->second.get() : nullptr;
+    auto ff = m_addrIndex.find(addr.value());
+    return (ff != m_addrIndex.end()) ? ff->second : nullptr;
 }
 
 
 const BinarySymbol *BinarySymbolTable::findSymbolByAddress(Address addr) const
 {
-    auto ff = m_addrIndex.find(addr);
-    return (ff != m_addrIndex.end()) ? ff->second.get() : nullptr;
+    auto ff = m_addrIndex.find(addr.value());
+    return (ff != m_addrIndex.end()) ? ff->second : nullptr;
 }
 
 
 BinarySymbol *BinarySymbolTable::findSymbolByName(const QString &name)
 {
-    auto ff = m_nameIndex.find(name);
-    return (ff != m_nameIndex.end()) ? ff->second.get() : nullptr;
+    return m_nameIndex.value(name, nullptr);
 }
 
 
 const BinarySymbol *BinarySymbolTable::findSymbolByName(const QString &name) const
 {
-    auto ff = m_nameIndex.find(name);
-    return (ff != m_nameIndex.end()) ? ff->second.get() : nullptr;
+    return m_nameIndex.value(name, nullptr);
+}
+
+
+BinarySymbol *BinarySymbolTable::findNearestSymbol(Address addr)
+{
+    return const_cast<BinarySymbol *>(
+        static_cast<const BinarySymbolTable *>(this)->findNearestSymbol(addr));
+}
+
+
+const BinarySymbol *BinarySymbolTable::findNearestSymbol(Address addr) const
+{
+    sortAddresses();
+
+    // first entry with address > addr
+    auto it = std::upper_bound(m_addrOrder.begin(), m_addrOrder.end(), addr,
+                               [](Address a, const std::pair<Address, BinarySymbol *> &entry) {
+                                   return a < entry.first;
+                               });
+
+    return (it != m_addrOrder.begin()) ? std::prev(it)->second : nullptr;
 }
 
 
@@ -97,23 +179,57 @@ bool BinarySymbolTable::renameSymbol(const QString &oldName, const QString &newN
     }
 
     auto oldIt = m_nameIndex.find(oldName);
-    auto newIt = m_nameIndex.find(newName);
 
     if (oldIt == m_nameIndex.end()) { // symbol not found
         LOG_ERROR("Could not rename symbol '%1' to '%2': A symbol with name '%1' was not found.",
                   oldName, newName);
         return false;
     }
-    else if (newIt != m_nameIndex.end()) { // symbol name clash
+    else if (m_nameIndex.contains(newName)) { // symbol name clash
         LOG_ERROR("Could not rename symbol '%1' to '%2': A symbol with name '%2' already exists",
                   oldName, newName);
         return false;
     }
 
-    std::shared_ptr<BinarySymbol> oldSymbol = oldIt->second;
+    BinarySymbol *oldSymbol = oldIt.value();
     m_nameIndex.erase(oldIt);
-    oldSymbol->m_name    = newName;
-    m_nameIndex[newName] = oldSymbol;
+    oldSymbol->m_name = newName;
+    m_nameIndex.insert(oldSymbol->getName(), oldSymbol);
 
     return true;
 }
+
+
+void BinarySymbolTable::addAddress(Address addr, BinarySymbol *sym)
+{
+    // Symbols from binary files are usually added in ascending order,
+    // so the sorted part can just grow.
+    const bool inOrder = m_numSortedAddrs == m_addrOrder.size() &&
+                         (m_addrOrder.empty() || m_addrOrder.back().first < addr);
+
+    m_addrOrder.push_back({ addr, sym });
+
+    if (inOrder) {
+        m_numSortedAddrs++;
+    }
+}
+
+
+void BinarySymbolTable::sortAddresses() const
+{
+    if (m_numSortedAddrs == m_addrOrder.size()) {
+        return;
+    }
+
+    auto cmp = [](const std::pair<Address, BinarySymbol *> &a,
+                  const std::pair<Address, BinarySymbol *> &b) { return a.first < b.first; };
+
+    const auto newBegin = m_addrOrder.begin() + m_numSortedAddrs;
+
+    if (!std::is_sorted(newBegin, m_addrOrder.end(), cmp)) {
+        std::sort(newBegin, m_addrOrder.end(), cmp);
+    }
+
+    std::inplace_merge(m_addrOrder.begin(), newBegin, m_addrOrder.end(), cmp);
+    m_numSortedAddrs = m_addrOrder.size();
+}
@@ -12,16 +12,31 @@
 
 #include "boomerang/util/Address.h"
 
-#include <map>
-#include <memory>
+#include <QHash>
+#include <QString>
+
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 
 class BinarySymbol;
 
 
+/// Definition of a symbol for BinarySymbolTable::createSymbols
+struct BinarySymbolDefinition
+{
+    Address addr;
+    QString name;
+    bool local = false;
+};
+
+
 /**
- * A simple class to implement a symbol table than can be looked up by address or by name.
+ * A symbol table than can be looked up by address or by name.
+ * Lookups by address and by name are hash lookups; the names of the symbols are shared
+ * between the symbols and the name index (QString is implicitly shared).
+ * Additionally, the table keeps the addresses in sorted order for nearest symbol queries.
  *
  * \note Can't readily use operator[] overloaded for address and string parameters.
  * The main problem is that when you do symtab[0x100] = "main", the string map
@@ -41,12 +56,12 @@ class BOOMERANG_API BinarySymbolTable
 public:
     BinarySymbolTable();
     BinarySymbolTable(const BinarySymbolTable &other) = delete;
-    BinarySymbolTable(BinarySymbolTable &&other)      = default;
+    BinarySymbolTable(BinarySymbolTable &&other);
 
     ~BinarySymbolTable();
 
     BinarySymbolTable &operator=(const BinarySymbolTable &other) = delete;
-    BinarySymbolTable &operator=(BinarySymbolTable &&other) = default;
+    BinarySymbolTable &operator=(BinarySymbolTable &&other);
 
 public:
     iterator begin() { return m_symbolList.begin(); }
@@ -64,24 +79,65 @@ public:
     bool empty() const { return m_symbolList.empty(); }
     void clear();
 
-    /// Creates a symbol if it does not exist.
+    /// Reserve space for a total of \p numSymbols symbols.
+    void reserve(int numSymbols);
+
+    /**
+     * Creates a symbol if it does not exist.
+     * \returns the new symbol, or the existing symbol named \p name
+     * (in which case \p addr is an alias of the existing symbol),
+     * or nullptr if there is already a symbol at \p addr.
+     */
     BinarySymbol *createSymbol(Address addr, const QString &name, bool local = false);
 
+    /**
+     * Creates many symbols at once, e.g. from the symbol table of a binary file.
+     * Equivalent to calling createSymbol for each definition in order,
+     * but the indexes are only grown and sorted once.
+     * Building the table is fastest if \p definitions are sorted by address,
+     * since the addresses do not need to be sorted then.
+     * \returns the results of createSymbol for all definitions, in the same order.
+     */
+    std::vector<BinarySymbol *>
+    createSymbols(const std::vector<BinarySymbolDefinition> &definitions);
+
     BinarySymbol *findSymbolByAddress(Address addr);
     const BinarySymbol *findSymbolByAddress(Address addr) const;
 
     BinarySymbol *findSymbolByName(const QString &name);
     const BinarySymbol *findSymbolByName(const QString &name) const;
 
+    /**
+     * \returns the symbol with the highest address less than or equal to \p addr,
+     * or nullptr if there is no such symbol.
+     * \note If symbols were created out of address order by createSymbol, the first query
+     * sorts the new addresses, so this must not be called concurrently with other queries
+     * in this case. createSymbols always leaves the addresses sorted.
+     */
+    BinarySymbol *findNearestSymbol(Address addr);
+    const BinarySymbol *findNearestSymbol(Address addr) const;
+
     /// \returns true iff the rename was successful
     bool renameSymbol(const QString &oldName, const QString &newName);
 
 private:
-    /// The map indexed by address.
-    std::map<Address, std::shared_ptr<BinarySymbol>> m_addrIndex;
+    /// Add \p addr to m_addrOrder, keeping it sorted if \p addr is the highest address so far
+    void addAddress(Address addr, BinarySymbol *sym);
+
+    /// Merge the addresses added since the last call into the sorted part of m_addrOrder
+    void sortAddresses() const;
+
+private:
+    /// The index by address. More than one address may refer to the same symbol.
+    std::unordered_map<Address::value_type, BinarySymbol *> m_addrIndex;
+
+    /// The index by name. Local symbols are not in this index.
+    QHash<QString, BinarySymbol *> m_nameIndex;
 
-    /// The map indexed by string. Note that the strings are stored twice.
-    std::map<QString, std::shared_ptr<BinarySymbol>> m_nameIndex;
+    /// All addresses of m_addrIndex. The first m_numSortedAddrs entries are sorted by address,
+    /// the remaining entries were added out of order and are sorted by sortAddresses().
+    mutable std::vector<std::pair<Address, BinarySymbol *>> m_addrOrder;
+    mutable std::size_t m_numSortedAddrs = 0;
 
-    SymbolList m_symbolList;
+    SymbolList m_symbolList; ///< All symbols, in creation order. Owns the symbols.
 };
@@ -13,6 +13,7 @@
 #include "boomerang/core/Settings.h"
 #include "boomerang/db/Prog.h"
 #include "boomerang/db/module/Module.h"
+#include "boomerang/db/proc/ProofCache.h"
 #include "boomerang/db/signature/Signature.h"
 #include "boomerang/ssl/statements/CallStatement.h"
 #include "boomerang/util/log/Log.h"
@@ -31,6 +32,9 @@ Function::Function(Address entryAddr, const std::shared_ptr<Signature> &sig, Mod
 
 Function::~Function()
 {
+    if (m_prog) {
+        m_prog->getProofCache()->removeFunction(this);
+    }
 }
 
 
@@ -103,6 +107,16 @@ void Function::removeFromModule()
 }
 
 
+void Function::setSignature(std::shared_ptr<Signature> sig)
+{
+    m_signature = sig;
+
+    if (m_prog) {
+        m_prog->getProofCache()->invalidate(this);
+    }
+}
+
+
 void Function::removeParameterFromSignature(SharedExp e)
 {
     const int n = m_signature->findParam(e);
@@ -43,6 +43,7 @@ void ProcCFG::clear()
 
     m_bbStartMap.clear();
     m_implicitMap.clear();
+    statementsChanged();
     m_entryBB    = nullptr;
     m_exitBB     = nullptr;
     m_wellFormed = true;
@@ -289,6 +290,7 @@ void ProcCFG::removeBB(BasicBlock *bb)
     }
 
     delete bb;
+    statementsChanged();
 }
 
 
@@ -494,6 +496,8 @@ BasicBlock *ProcCFG::splitBB(BasicBlock *bb, Address splitAddr, BasicBlock *_new
             splitIt = bb->getRTLs()->erase(splitIt); // deletes RTLs
         }
 
+        bb->statementsChanged();
+
         bb->updateBBAddresses();
         _newBB->updateBBAddresses();
 
@@ -517,11 +521,7 @@ BasicBlock *ProcCFG::splitBB(BasicBlock *bb, Address splitAddr, BasicBlock *_new
     // We don't want to "deep copy" the RTLs themselves,
     // because we want to transfer ownership from the original BB to the "high" part
     std::unique_ptr<RTLList> highRTLs(new RTLList);
-    for (RTLList::iterator it = splitIt; it != bb->getRTLs()->end();) {
-        highRTLs->push_back(std::move(*it));
-        assert(*it == nullptr);
-        it = bb->getRTLs()->erase(it);
-    }
+    highRTLs->splice(highRTLs->end(), *bb->getRTLs(), splitIt, bb->getRTLs()->end());
 
     _newBB->setRTLs(std::move(highRTLs));
     bb->updateBBAddresses();
@@ -575,4 +575,14 @@ void ProcCFG::insertBB(BasicBlock *bb)
         // this is an orpahned BB (e.g. delay slot)
         m_bbStartMap.insert({ Address::ZERO, bb });
     }
+
+    statementsChanged();
+}
+
+
+void ProcCFG::statementsChanged()
+{
+    if (m_myProc) {
+        m_myProc->statementsChanged();
+    }
 }
@@ -240,6 +240,9 @@ public:
 private:
     void insertBB(BasicBlock *bb);
 
+    /// Invalidate the cached statements of the procedure after BBs were added or removed.
+    void statementsChanged();
+
 private:
     UserProc *m_myProc = nullptr;    ///< Procedure to which this CFG belongs.
     BBStartMap m_bbStartMap;         ///< The Address to BB map
@@ -0,0 +1,223 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "ProofCache.h"
+
+#include "boomerang/db/proc/Proc.h"
+#include "boomerang/ssl/exp/Binary.h"
+#include "boomerang/util/log/Log.h"
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+
+ProofCache::ProofCache()
+{
+}
+
+
+ProofCache::~ProofCache()
+{
+}
+
+
+void ProofCache::addQuery()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stats.numQueries++;
+}
+
+
+bool ProofCache::lookup(const Function *proc, const SharedConstExp &left,
+                        const SharedConstExp &right, bool &result)
+{
+    const SharedConstExp query = makeQuery(left, right);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto procIt = m_results.find(proc);
+    if (procIt == m_results.end()) {
+        return false;
+    }
+
+    auto it = procIt->second.find(query);
+    if (it == procIt->second.end()) {
+        return false;
+    }
+
+    m_stats.numHits++;
+    result = it->second;
+    return true;
+}
+
+
+void ProofCache::store(const Function *proc, const SharedConstExp &left,
+                       const SharedConstExp &right, bool result)
+{
+    const SharedConstExp query = makeQuery(left, right);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (result) {
+        // Something new might have been proven, which might make failed proofs succeed.
+        removeFailed();
+    }
+
+    auto ins = m_results[proc].insert({ query, result });
+    if (ins.second) {
+        if (!result) {
+            m_numFailed++;
+        }
+    }
+    else if (ins.first->second != result) {
+        m_numFailed += result ? -1 : 1;
+        ins.first->second = result;
+    }
+}
+
+
+void ProofCache::invalidate(const Function *proc)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_results.find(proc);
+    if (it != m_results.end()) {
+        m_numFailed -= static_cast<int>(std::count_if(
+            it->second.begin(), it->second.end(),
+            [](const QueryResults::value_type &val) { return !val.second; }));
+        m_results.erase(it);
+    }
+
+    removeFailed();
+}
+
+
+void ProofCache::removeFunction(const Function *proc)
+{
+    invalidate(proc);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_numProverCalls.erase(proc);
+}
+
+
+void ProofCache::invalidateFailed()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    removeFailed();
+}
+
+
+void ProofCache::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_results.clear();
+    m_numFailed = 0;
+}
+
+
+void ProofCache::addPremise()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_numPremises++;
+}
+
+
+void ProofCache::removePremise()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    assert(m_numPremises > 0);
+    m_numPremises--;
+}
+
+
+bool ProofCache::hasPremises() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_numPremises > 0;
+}
+
+
+void ProofCache::addProverCall(const Function *proc, int depth)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_stats.numProverCalls++;
+    m_stats.maxDepth = std::max(m_stats.maxDepth, depth);
+    m_numProverCalls[proc]++;
+}
+
+
+ProofCache::Stats ProofCache::getStats() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+
+uint64 ProofCache::getNumProverCalls(const Function *proc) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_numProverCalls.find(proc);
+    return it != m_numProverCalls.end() ? it->second : 0;
+}
+
+
+void ProofCache::logStats(int numProcs) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    LOG_VERBOSE("Proof statistics: %1 queries, %2 cache hits, %3 prover calls, max depth %4",
+                m_stats.numQueries, m_stats.numHits, m_stats.numProverCalls, m_stats.maxDepth);
+
+    std::vector<std::pair<const Function *, uint64>> procs(m_numProverCalls.begin(),
+                                                           m_numProverCalls.end());
+
+    const std::size_t numShown = std::min(procs.size(), static_cast<std::size_t>(numProcs));
+    std::partial_sort(procs.begin(), procs.begin() + numShown, procs.end(),
+                      [](const std::pair<const Function *, uint64> &a,
+                         const std::pair<const Function *, uint64> &b) {
+                          return a.second > b.second;
+                      });
+
+    for (std::size_t i = 0; i < numShown; ++i) {
+        LOG_VERBOSE("    %1 prover calls in '%2'", procs[i].second, procs[i].first->getName());
+    }
+}
+
+
+SharedExp ProofCache::makeQuery(const SharedConstExp &left, const SharedConstExp &right)
+{
+    return Binary::get(opEquals, left->clone(), right->clone()->simplify());
+}
+
+
+void ProofCache::removeFailed()
+{
+    if (m_numFailed == 0) {
+        return;
+    }
+
+    for (auto &val : m_results) {
+        QueryResults &results = val.second;
+
+        for (auto it = results.begin(); it != results.end();) {
+            if (!it->second) {
+                it = results.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+    }
+
+    m_numFailed = 0;
+}
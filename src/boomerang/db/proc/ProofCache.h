@@ -0,0 +1,120 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include "boomerang/core/BoomerangAPI.h"
+#include "boomerang/ssl/exp/ExpHelp.h"
+#include "boomerang/util/Types.h"
+
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+
+class Function;
+
+
+/**
+ * Remembers the results of UserProc::proveEqual for all procedures of a program,
+ * so that questions like "is r28 preserved by proc X" are only answered once.
+ *
+ * Results are keyed by procedure and query (left = right, with right simplified).
+ * Since the result of a proof depends on the statements of the procedure, the results of
+ * a procedure are dropped whenever the procedure might have changed (see invalidate).
+ * Failed proofs are also dropped when something new has been proven for any procedure,
+ * because the new fact might make the proof succeed.
+ *
+ * Proofs that depend on recursion premises are not cached.
+ */
+class BOOMERANG_API ProofCache
+{
+public:
+    struct Stats
+    {
+        uint64 numQueries     = 0; ///< number of calls to UserProc::proveEqual
+        uint64 numHits        = 0; ///< number of queries answered by the cache
+        uint64 numProverCalls = 0; ///< number of calls to UserProc::prover
+        int maxDepth          = 0; ///< maximum nesting depth of UserProc::prover
+    };
+
+public:
+    ProofCache();
+    ProofCache(const ProofCache &other) = delete;
+    ProofCache(ProofCache &&other)      = delete;
+
+    ~ProofCache();
+
+    ProofCache &operator=(const ProofCache &other) = delete;
+    ProofCache &operator=(ProofCache &&other) = delete;
+
+public:
+    /// Update the statistics for a call to UserProc::proveEqual.
+    void addQuery();
+
+    /**
+     * Look up the result of proving \p left = \p right in \p proc.
+     * \param result set to the result of the proof if it is in the cache.
+     * \returns true if the result is in the cache.
+     */
+    bool lookup(const Function *proc, const SharedConstExp &left, const SharedConstExp &right,
+                bool &result);
+
+    /// Remember that \p left = \p right is (not) true in \p proc.
+    void store(const Function *proc, const SharedConstExp &left, const SharedConstExp &right,
+               bool result);
+
+    /// Drop all results of \p proc and all failed proofs.
+    /// Must be called when anything a proof in \p proc depends on has changed.
+    void invalidate(const Function *proc);
+
+    /// Drop everything known about \p proc, e.g. because it is about to be deleted.
+    void removeFunction(const Function *proc);
+
+    /// Drop all failed proofs of all procedures.
+    void invalidateFailed();
+
+    /// Drop all results.
+    void clear();
+
+    /// Results must not be cached while premises are active.
+    void addPremise();
+    void removePremise();
+    bool hasPremises() const;
+
+    /// Update the statistics for a call to UserProc::prover in \p proc at nesting level \p depth.
+    void addProverCall(const Function *proc, int depth);
+
+    Stats getStats() const;
+
+    /// \returns the number of calls to UserProc::prover for \p proc
+    uint64 getNumProverCalls(const Function *proc) const;
+
+    /// Log the statistics and the \p numProcs procedures that spent most time in the prover.
+    void logStats(int numProcs = 10) const;
+
+private:
+    /// Key is the normalized query
+    typedef std::map<SharedConstExp, bool, lessExpStar> QueryResults;
+
+    /// \returns the normalized query for \p left = \p right
+    static SharedExp makeQuery(const SharedConstExp &left, const SharedConstExp &right);
+
+    void removeFailed();
+
+private:
+    mutable std::mutex m_mutex;
+
+    std::unordered_map<const Function *, QueryResults> m_results;
+    std::unordered_map<const Function *, uint64> m_numProverCalls;
+    int m_numFailed   = 0;
+    int m_numPremises = 0;
+    Stats m_stats;
+};
@@ -13,6 +13,7 @@
 #include "boomerang/core/Settings.h"
 #include "boomerang/db/Prog.h"
 #include "boomerang/db/module/Module.h"
+#include "boomerang/db/proc/ProofCache.h"
 #include "boomerang/db/signature/Signature.h"
 #include "boomerang/decomp/ProcDecompiler.h"
 #include "boomerang/passes/PassManager.h"
@@ -151,7 +152,7 @@ void UserProc::numberStatements() const
 
     for (BasicBlock *bb : *m_cfg) {
         BasicBlock::RTLIterator rit;
-        StatementList::iterator sit;
+        RTL::iterator sit;
         for (Statement *s = bb->getFirstStmt(rit, sit); s; s = bb->getNextStmt(rit, sit)) {
             s->setNumber(++stmtNumber);
         }
@@ -161,15 +162,41 @@ void UserProc::numberStatements() const
 
 void UserProc::getStatements(StatementList &stmts) const
 {
-    for (const BasicBlock *bb : *m_cfg) {
-        bb->appendStatementsTo(stmts);
+    for (Statement *s : getStatements()) {
+        stmts.append(s);
     }
+}
+
+
+const std::vector<Statement *> &UserProc::getStatements() const
+{
+    if (m_stmtIndexVersion == m_stmtVersion) {
+        return m_stmtIndex;
+    }
+
+    m_stmtIndex.clear();
+
+    for (const BasicBlock *bb : *m_cfg) {
+        const RTLList *rtls = bb->getRTLs();
+        if (!rtls) {
+            continue;
+        }
+
+        for (const auto &rtl : *rtls) {
+            for (Statement *s : *rtl) {
+                assert(s->getBB() == bb);
+
+                if (s->getProc() == nullptr) {
+                    s->setProc(const_cast<UserProc *>(this));
+                }
 
-    for (Statement *s : stmts) {
-        if (s->getProc() == nullptr) {
-            s->setProc(const_cast<UserProc *>(this));
+                m_stmtIndex.push_back(s);
+            }
         }
     }
+
+    m_stmtIndexVersion = m_stmtVersion;
+    return m_stmtIndex;
 }
 
 
@@ -201,6 +228,10 @@ bool UserProc::removeStatement(Statement *stmt)
         ++provenIt;
     }
 
+    if (m_prog) {
+        m_prog->getProofCache()->invalidate(this);
+    }
+
     // remove from BB/RTL
     BasicBlock *bb = stmt->getBB(); // Get our enclosing BB
     if (!bb) {
@@ -211,6 +242,11 @@ bool UserProc::removeStatement(Statement *stmt)
         for (RTL::iterator it = rtl->begin(); it != rtl->end(); ++it) {
             if (*it == stmt) {
                 rtl->erase(it);
+
+                if (stmt->isPhi() && m_prog) {
+                    m_prog->getPhiStats().numRemoved++;
+                }
+
                 return true;
             }
         }
@@ -452,6 +488,20 @@ void UserProc::setRetStmt(ReturnStatement *s, Address r)
     assert(m_retStatement == nullptr);
     m_retStatement = s;
     m_retStatement->setRetAddr(r);
+
+    if (m_prog) {
+        m_prog->getProofCache()->invalidate(this);
+    }
+}
+
+
+void UserProc::removeRetStmt()
+{
+    m_retStatement = nullptr;
+
+    if (m_prog) {
+        m_prog->getProofCache()->invalidate(this);
+    }
 }
 
 
@@ -787,7 +837,7 @@ void UserProc::markAsNonChildless(const std::shared_ptr<ProcSet> &cs)
     assert(cs);
 
     BasicBlock::RTLRIterator rrit;
-    StatementList::reverse_iterator srit;
+    RTL::reverse_iterator srit;
 
     for (BasicBlock *bb : *m_cfg) {
         CallStatement *c = dynamic_cast<CallStatement *>(bb->getLastStmt(rrit, srit));
@@ -850,10 +900,8 @@ QString UserProc::findFirstSymbol(const SharedConstExp &exp) const
 bool UserProc::searchAndReplace(const Exp &search, SharedExp replace)
 {
     bool ch = false;
-    StatementList stmts;
-    getStatements(stmts);
 
-    for (Statement *s : stmts) {
+    for (Statement *s : getStatements()) {
         ch |= s->searchAndReplace(search, replace);
     }
 
@@ -869,10 +917,7 @@ void UserProc::markAsInitialParam(const SharedExp &loc)
 
 bool UserProc::allPhisHaveDefs() const
 {
-    StatementList stmts;
-    getStatements(stmts);
-
-    for (const Statement *stmt : stmts) {
+    for (const Statement *stmt : getStatements()) {
         if (!stmt->isPhi()) {
             continue; // Might be able to optimise this a bit
         }
@@ -1115,9 +1160,21 @@ SharedConstType UserProc::getTypeForLocation(const SharedConstExp &e) const
 
 static const SharedExp defAll = Terminal::get(opDefineAll);
 
+/// Current nesting level of UserProc::prover (for statistics only)
+static thread_local int g_proverDepth = 0;
+
+struct ProverDepthGuard
+{
+    ProverDepthGuard() { g_proverDepth++; }
+    ~ProverDepthGuard() { g_proverDepth--; }
+};
+
 
 bool UserProc::proveEqual(const SharedExp &queryLeft, const SharedExp &queryRight, bool conditional)
 {
+    ProofCache *proofCache = m_prog->getProofCache();
+    proofCache->addQuery();
+
     if ((m_provenTrue.find(queryLeft) != m_provenTrue.end()) &&
         (*m_provenTrue[queryLeft] == *queryRight)) {
         if (m_prog->getProject()->getSettings()->debugProof) {
@@ -1128,6 +1185,19 @@ bool UserProc::proveEqual(const SharedExp &queryLeft, const SharedExp &queryRigh
         return true;
     }
 
+    // The results of conditional proofs and of proofs using premises cannot be reused.
+    const bool useCache = !conditional && !proofCache->hasPremises();
+    bool cachedResult   = false;
+
+    if (useCache && proofCache->lookup(this, queryLeft, queryRight, cachedResult)) {
+        if (m_prog->getProject()->getSettings()->debugProof) {
+            LOG_MSG("found %1 in proof cache %2 in %3", (cachedResult ? "true" : "false"),
+                    Binary::get(opEquals, queryLeft, queryRight), getName());
+        }
+
+        return cachedResult;
+    }
+
     const SharedExp origLeft  = queryLeft;
     const SharedExp origRight = queryRight;
 
@@ -1169,6 +1239,14 @@ bool UserProc::proveEqual(const SharedExp &queryLeft, const SharedExp &queryRigh
                 }
 
                 m_provenTrue[origLeft->clone()] = right;
+
+                if (useCache) {
+                    proofCache->store(this, origLeft, origRight, true);
+                }
+                else {
+                    proofCache->invalidateFailed();
+                }
+
                 return true;
             }
 
@@ -1177,13 +1255,19 @@ bool UserProc::proveEqual(const SharedExp &queryLeft, const SharedExp &queryRigh
                 LOG_MSG("Prove returns false");
             }
 
+            if (useCache) {
+                proofCache->store(this, origLeft, origRight, false);
+            }
+
             return false;
         }
     }
 
     if (m_recursionGroup) { // If in involved in a recursion cycle
         //    then save the original query as a premise for bypassing calls
-        m_recurPremises[origLeft->clone()] = origRight;
+        if (m_recurPremises.insert_or_assign(origLeft->clone(), origRight).second) {
+            proofCache->addPremise();
+        }
     }
 
     std::set<PhiAssign *> lastPhis;
@@ -1203,6 +1287,13 @@ bool UserProc::proveEqual(const SharedExp &queryLeft, const SharedExp &queryRigh
         m_provenTrue[origLeft] = origRight; // Save the now proven equation
     }
 
+    if (useCache) {
+        proofCache->store(this, origLeft, origRight, result);
+    }
+    else if (result && !conditional) {
+        proofCache->invalidateFailed();
+    }
+
     return result;
 }
 
@@ -1210,6 +1301,9 @@ bool UserProc::proveEqual(const SharedExp &queryLeft, const SharedExp &queryRigh
 bool UserProc::prover(SharedExp query, std::set<PhiAssign *> &lastPhis,
                       std::map<PhiAssign *, SharedExp> &cache, PhiAssign *lastPhi /* = nullptr */)
 {
+    ProverDepthGuard depthGuard;
+    m_prog->getProofCache()->addProverCall(this, g_proverDepth);
+
     // A map that seems to be used to detect loops in the call graph:
     std::map<CallStatement *, SharedExp> called;
     auto phiInd = query->getSubExp2()->clone();
@@ -1484,10 +1578,7 @@ bool UserProc::prover(SharedExp query, std::set<PhiAssign *> &lastPhis,
             // find a memory def for the right if there is a memof on the left
             // FIXME: this seems pretty much like a bad hack!
             if (!change && (query->getSubExp1()->getOper() == opMemOf)) {
-                StatementList stmts;
-                getStatements(stmts);
-
-                for (Statement *s : stmts) {
+                for (Statement *s : getStatements()) {
                     Assign *as = dynamic_cast<Assign *>(s);
 
                     if (as && (*as->getRight() == *query->getSubExp2()) &&
@@ -1557,12 +1648,15 @@ SharedExp UserProc::getSymbolFor(const SharedConstExp &from, const SharedConstTy
 
 void UserProc::setPremise(const SharedExp &e)
 {
-    SharedExp premise  = e->clone();
-    m_recurPremises[e] = e;
+    if (m_recurPremises.insert_or_assign(e, e).second && m_prog) {
+        m_prog->getProofCache()->addPremise();
+    }
 }
 
 
 void UserProc::killPremise(const SharedExp &e)
 {
-    m_recurPremises.erase(e);
+    if (m_recurPremises.erase(e) > 0 && m_prog) {
+        m_prog->getProofCache()->removePremise();
+    }
 }
@@ -16,6 +16,8 @@
 #include "boomerang/db/proc/ProcCFG.h"
 #include "boomerang/util/StatementList.h"
 
+#include <vector>
+
 
 class Binary;
 class UserProc;
@@ -143,9 +145,24 @@ public:
     /// Update statement numbers
     void numberStatements() const;
 
-    /// \returns all statements in this UserProc
+    /// Append all statements in this UserProc to \p stmts
     void getStatements(StatementList &stmts) const;
 
+    /**
+     * \returns all statements in this UserProc, in the order of the basic blocks of the CFG.
+     * The list is cached and only rebuilt after statements have been added or removed.
+     * \note The returned reference is invalidated when statements are added or removed.
+     * Callers that add or remove statements while iterating must iterate over a copy.
+     */
+    const std::vector<Statement *> &getStatements() const;
+
+    /**
+     * Invalidate the cached list of statements (see getStatements).
+     * Called by RTL, BasicBlock and ProcCFG whenever statements of this procedure
+     * are added, removed or replaced.
+     */
+    void statementsChanged() { ++m_stmtVersion; }
+
     /// Remove (but not delete) \p stmt from this UserProc
     /// \returns true iff successfully removed
     bool removeStatement(Statement *stmt);
@@ -202,7 +219,7 @@ public:
     ReturnStatement *getRetStmt() { return m_retStatement; }
     const ReturnStatement *getRetStmt() const { return m_retStatement; }
 
-    void removeRetStmt() { m_retStatement = nullptr; }
+    void removeRetStmt();
 
     /**
      * Filter out locations not possible as return locations.
@@ -388,6 +405,11 @@ private:
 
     std::unique_ptr<ProcCFG> m_cfg; ///< The control flow graph.
 
+    /// Cached list of all statements (see getStatements)
+    mutable std::vector<Statement *> m_stmtIndex;
+    mutable uint64 m_stmtIndexVersion = 0; ///< Value of m_stmtVersion m_stmtIndex was built for
+    uint64 m_stmtVersion              = 1; ///< Changes whenever statements are added or removed
+
     /// DataFlow object. Holds information relevant to transforming to and from SSA form.
     DataFlow m_df;
 
@@ -0,0 +1,142 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "DecompilationBudget.h"
+
+#include "boomerang/core/Settings.h"
+#include "boomerang/db/proc/UserProc.h"
+#include "boomerang/util/log/Log.h"
+
+
+DecompilationBudget::DecompilationBudget(const Settings *settings)
+    : m_settings(settings)
+{
+}
+
+
+void DecompilationBudget::start()
+{
+    reset();
+    m_cancelled = false;
+    m_timer.start();
+}
+
+
+void DecompilationBudget::reset()
+{
+    m_procs.clear();
+    m_passStack.clear();
+}
+
+
+void DecompilationBudget::cancel()
+{
+    m_cancelled = true;
+}
+
+
+bool DecompilationBudget::isDeadlineExceeded() const
+{
+    if (m_cancelled) {
+        return true;
+    }
+
+    return m_settings->decompileTimeLimit > 0 && m_timer.isValid() &&
+           m_timer.elapsed() >= 1000LL * m_settings->decompileTimeLimit;
+}
+
+
+bool DecompilationBudget::chargePass(const UserProc *proc)
+{
+    if (isExhausted(proc)) {
+        return false;
+    }
+
+    m_procs[proc].numPasses++;
+    return true;
+}
+
+
+void DecompilationBudget::beginPass(const UserProc *proc)
+{
+    pauseInnermostPass();
+    m_passStack.push_back(proc);
+    m_procs[proc].timer.start();
+}
+
+
+void DecompilationBudget::endPass(const UserProc *proc)
+{
+    if (m_passStack.empty() || m_passStack.back() != proc) {
+        return; // budgets were reset while the pass was executed
+    }
+
+    pauseInnermostPass();
+    m_passStack.pop_back();
+
+    if (!m_passStack.empty()) {
+        m_procs[m_passStack.back()].timer.start();
+    }
+}
+
+
+void DecompilationBudget::pauseInnermostPass()
+{
+    if (m_passStack.empty()) {
+        return;
+    }
+
+    ProcBudget &budget = m_procs[m_passStack.back()];
+    if (budget.timer.isValid()) {
+        budget.nsecsSpent += budget.timer.nsecsElapsed();
+        budget.timer.invalidate();
+    }
+}
+
+
+qint64 DecompilationBudget::getTimeSpent(const ProcBudget &budget)
+{
+    return budget.nsecsSpent + (budget.timer.isValid() ? budget.timer.nsecsElapsed() : 0);
+}
+
+
+bool DecompilationBudget::isExhausted(const UserProc *proc)
+{
+    ProcBudget &budget = m_procs[proc];
+
+    if (budget.exhausted) {
+        return true;
+    }
+
+    if (isDeadlineExceeded()) {
+        LOG_WARN("Decompilation %1, skipping further analysis of '%2'",
+                 m_cancelled ? "cancelled" : "time limit exceeded", proc->getName());
+        budget.exhausted = true;
+    }
+    else if (m_settings->procPassLimit > 0 && budget.numPasses >= m_settings->procPassLimit) {
+        LOG_WARN("Procedure '%1' exceeded its limit of %2 passes, skipping further analysis",
+                 proc->getName(), m_settings->procPassLimit);
+        budget.exhausted = true;
+    }
+    else if (m_settings->procTimeLimit > 0 &&
+             getTimeSpent(budget) >= 1000000000LL * m_settings->procTimeLimit) {
+        LOG_WARN("Procedure '%1' exceeded its time limit of %2 seconds, skipping further analysis",
+                 proc->getName(), m_settings->procTimeLimit);
+        budget.exhausted = true;
+    }
+
+    return budget.exhausted;
+}
+
+
+bool DecompilationBudget::isDegraded(const UserProc *proc) const
+{
+    auto it = m_procs.find(proc);
+    return it != m_procs.end() && it->second.exhausted;
+}
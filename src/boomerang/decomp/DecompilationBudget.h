@@ -0,0 +1,102 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include "boomerang/core/BoomerangAPI.h"
+
+#include <QElapsedTimer>
+
+#include <atomic>
+#include <unordered_map>
+#include <vector>
+
+
+class Settings;
+class UserProc;
+
+
+/**
+ * Limits the effort spent on decompiling a program.
+ *
+ * Each procedure may spend a limited amount of time and execute a limited number of passes
+ * (see Settings::procTimeLimit and Settings::procPassLimit). The time of a procedure is the
+ * time spent in passes executed on it (see beginPass and endPass). Once the budget of a procedure
+ * is exhausted, only passes that are required to generate code for it are executed,
+ * so the procedure is emitted at a lower analysis level instead of stalling the whole program.
+ *
+ * Additionally, the whole decompilation has an overall deadline (Settings::decompileTimeLimit)
+ * and can be cancelled at any time. After that, all procedures are treated as exhausted,
+ * so decompilation finishes quickly and output is still generated.
+ */
+class BOOMERANG_API DecompilationBudget
+{
+public:
+    explicit DecompilationBudget(const Settings *settings);
+
+public:
+    /// Start the overall deadline and forget the budgets of all procedures.
+    void start();
+
+    /// Forget the budgets of all procedures, e.g. when they are deleted.
+    void reset();
+
+    /// Request decompilation to stop as soon as possible. May be called from any thread.
+    void cancel();
+
+    /// \returns true if cancel() was called since the last start().
+    bool isCancelled() const { return m_cancelled.load(); }
+
+    /// \returns true if decompilation was cancelled or the overall deadline has passed.
+    bool isDeadlineExceeded() const;
+
+    /**
+     * Account for one pass execution on \p proc.
+     * \returns false if the budget of \p proc is exhausted; the pass should then be skipped
+     * unless it is required.
+     */
+    bool chargePass(const UserProc *proc);
+
+    /**
+     * Start measuring the time of a pass executed on \p proc.
+     * Passes may be nested; while a nested pass is executed, only its procedure is charged.
+     */
+    void beginPass(const UserProc *proc);
+
+    /// Stop measuring the time of the innermost pass, which was executed on \p proc.
+    void endPass(const UserProc *proc);
+
+    /// \returns true if \p proc has exhausted its budget, or the overall deadline has passed.
+    bool isExhausted(const UserProc *proc);
+
+    /// \returns true if \p proc could not be analysed completely because its budget was exhausted.
+    bool isDegraded(const UserProc *proc) const;
+
+private:
+    struct ProcBudget
+    {
+        QElapsedTimer timer;   ///< running while the procedure is charged for a pass
+        qint64 nsecsSpent = 0; ///< time spent in passes before the timer was last started
+        int numPasses     = 0;
+        bool exhausted    = false;
+    };
+
+    /// Add the time since the timer of the innermost pass was started to its procedure.
+    void pauseInnermostPass();
+
+    /// \returns the time in nanoseconds spent in passes on the procedure of \p budget
+    static qint64 getTimeSpent(const ProcBudget &budget);
+
+    const Settings *m_settings;
+    QElapsedTimer m_timer; ///< started by start()
+    std::atomic<bool> m_cancelled{ false };
+    std::unordered_map<const UserProc *, ProcBudget> m_procs;
+    std::vector<const UserProc *> m_passStack; ///< procedures of the currently executed passes
+};
@@ -26,6 +26,10 @@
 #include "boomerang/util/log/Log.h"
 #include "boomerang/visitor/expmodifier/ConstGlobalConverter.h"
 
+#include <iterator>
+#include <map>
+#include <vector>
+
 
 // Switch High Level patterns
 
@@ -119,6 +123,63 @@ static const SharedConstExp vfc_none = Location::memOf(Location::memOf(Terminal:
 static const SharedConstExp hlVfc[] = { vfc_funcptr, vfc_both, vfc_vto, vfc_vfo, vfc_none };
 
 
+/**
+ * Finds the first of a list of patterns that matches an expression (ignoring subscripts).
+ * The patterns are indexed by the operator at their top, so an expression is only
+ * compared against the patterns that have the same operator at the top,
+ * instead of against all patterns.
+ */
+class PatternIndex
+{
+public:
+    template<typename Iterator, typename GetPattern>
+    PatternIndex(Iterator begin, Iterator end, GetPattern getPattern)
+    {
+        for (int idx = 0; begin != end; ++begin, ++idx) {
+            const SharedConstExp &pattern = getPattern(*begin);
+            assert(getTopOper(*pattern) != opWild);
+
+            m_patterns.push_back(pattern);
+            m_index[getTopOper(*pattern)].push_back(idx);
+        }
+    }
+
+    /// \returns the index of the first pattern that matches \p e, or -1 if none matches.
+    int findMatch(const Exp &e) const
+    {
+        auto it = m_index.find(getTopOper(e));
+        if (it == m_index.end()) {
+            return -1;
+        }
+
+        for (int idx : it->second) {
+            if (e *= *m_patterns[idx]) { // *= compare ignores subscripts
+                return idx;
+            }
+        }
+
+        return -1;
+    }
+
+private:
+    static OPER getTopOper(const Exp &e)
+    {
+        return e.isSubscript() ? e.getSubExp1()->getOper() : e.getOper();
+    }
+
+private:
+    std::vector<SharedConstExp> m_patterns;
+    std::map<OPER, std::vector<int>> m_index; ///< indices of the patterns with the operator
+};
+
+
+static const PatternIndex hlFormIndex(std::begin(hlForms), std::end(hlForms),
+                                      [](const SwitchForm &form) { return form.pattern; });
+
+static const PatternIndex hlVfcIndex(std::begin(hlVfc), std::end(hlVfc),
+                                     [](const SharedConstExp &pattern) { return pattern; });
+
+
 /// Find all the possible constant values that the location defined by s could be assigned with
 static void findConstantValues(const Statement *s, std::list<int> &dests)
 {
@@ -257,7 +318,7 @@ bool IndirectJumpAnalyzer::decodeIndirectJmp(BasicBlock *bb, UserProc *proc)
 {
 #if CHECK_REAL_PHI_LOOPS
     rtlit rit;
-    StatementList::iterator sit;
+    RTL::iterator sit;
     Statement *s = getFirstStmt(rit, sit);
 
     for (s = getFirstStmt(rit, sit); s; s = getNextStmt(rit, sit)) {
@@ -320,16 +381,13 @@ bool IndirectJumpAnalyzer::decodeIndirectJmp(BasicBlock *bb, UserProc *proc)
         SharedExp jumpDest = lastStmt->getDest();
 
         SwitchType switchType = SwitchType::Invalid;
+        const int formIdx     = hlFormIndex.findMatch(*jumpDest);
 
-        for (auto &val : hlForms) {
-            if (*jumpDest *= *val.pattern) { // *= compare ignores subscripts
-                switchType = val.type;
-
-                if (proc->getProg()->getProject()->getSettings()->debugSwitch) {
-                    LOG_MSG("Indirect jump matches form %1", static_cast<char>(switchType));
-                }
+        if (formIdx != -1) {
+            switchType = hlForms[formIdx].type;
 
-                break;
+            if (proc->getProg()->getProject()->getSettings()->debugSwitch) {
+                LOG_MSG("Indirect jump matches form %1", static_cast<char>(switchType));
             }
         }
 
@@ -350,9 +408,17 @@ bool IndirectJumpAnalyzer::decodeIndirectJmp(BasicBlock *bb, UserProc *proc)
                 if (switchType == SwitchType::A) {
                     const Prog *prog = proc->getProg();
 
+                    std::vector<DWord> entries;
+                    const int numEntries = prog->readNative4Array(
+                        swi->tableAddr, swi->numTableEntries, entries);
+
+                    if (numEntries < swi->numTableEntries) {
+                        // The rest of the table is not part of the image
+                        swi->numTableEntries = numEntries;
+                    }
+
                     for (int entryIdx = 0; entryIdx < swi->numTableEntries; ++entryIdx) {
-                        Address switchEntryAddr = Address(
-                            prog->readNative4(swi->tableAddr + entryIdx * 4));
+                        Address switchEntryAddr = Address(entries[entryIdx]);
 
                         if (!Util::inRange(switchEntryAddr, prog->getLimitTextLow(),
                                            prog->getLimitTextHigh())) {
@@ -463,25 +529,14 @@ bool IndirectJumpAnalyzer::decodeIndirectJmp(BasicBlock *bb, UserProc *proc)
                     e);
         }
 
-        int n           = sizeof(hlVfc) / sizeof(SharedExp);
-        bool recognised = false;
-        int i;
+        const int i = hlVfcIndex.findMatch(*e);
 
-        for (i = 0; i < n; i++) {
-            if (*e *= *hlVfc[i]) { // *= compare ignores subscripts
-                recognised = true;
-
-                if (proc->getProg()->getProject()->getSettings()->debugSwitch) {
-                    LOG_MSG("Indirect call matches form %1", i);
-                }
-
-                break;
-            }
-        }
-
-        if (!recognised) {
+        if (i == -1) {
             return false;
         }
+        else if (proc->getProg()->getProject()->getSettings()->debugSwitch) {
+            LOG_MSG("Indirect call matches form %1", i);
+        }
 
         lastStmt->setDest(e); // Keep the changes to the indirect call expression
         int K1, K2;
@@ -735,9 +790,21 @@ void IndirectJumpAnalyzer::processSwitch(BasicBlock *bb, UserProc *proc)
     // be a goto to the code for case 3, but a smarter back end could group them
     std::list<Address> dests;
 
+    // Read tables of 32 bit entries in one go.
+    std::vector<DWord> tableEntries;
+    int numTableEntries = numCases;
+
+    if (si->switchType != SwitchType::H && si->switchType != SwitchType::F) {
+        numTableEntries = prog->readNative4Array(si->tableAddr, numCases, tableEntries);
+    }
+
     for (int i = 0; i < numCases; i++) {
         // Get the destination address from the switch table.
-        if (si->switchType == SwitchType::H) {
+        if (i >= numTableEntries) {
+            // The table extends past the end of its section
+            switchDestination = Address::INVALID;
+        }
+        else if (si->switchType == SwitchType::H) {
             const int switchValue = prog->readNative4(si->tableAddr + i * 2);
 
             if (switchValue == -1) {
@@ -752,11 +819,12 @@ void IndirectJumpAnalyzer::processSwitch(BasicBlock *bb, UserProc *proc)
             switchDestination = Address(entry[i]);
         }
         else {
-            switchDestination = Address(prog->readNative4(si->tableAddr + i * 4));
+            switchDestination = Address(tableEntries[i]);
         }
 
-        if ((si->switchType == SwitchType::O) || (si->switchType == SwitchType::R) ||
-            (si->switchType == SwitchType::r)) {
+        if (switchDestination != Address::INVALID &&
+            ((si->switchType == SwitchType::O) || (si->switchType == SwitchType::R) ||
+             (si->switchType == SwitchType::r))) {
             // Offset: add table address to make a real pointer to code.  For type R, the table is
             // relative to the branch, so take offsetFromJumpTbl. For others, offsetFromJumpTbl is
             // 0, so no harm
@@ -767,7 +835,7 @@ void IndirectJumpAnalyzer::processSwitch(BasicBlock *bb, UserProc *proc)
             switchDestination += si->tableAddr - si->offsetFromJumpTbl;
         }
 
-        if (switchDestination < prog->getLimitTextHigh()) {
+        if (switchDestination < prog->getLimitTextHigh()) { // also false for Address::INVALID
             cfg->addEdge(bb, switchDestination);
 
             // Remember to decode the newly discovered switch code arms, if necessary
@@ -13,6 +13,8 @@
 #include "boomerang/core/Settings.h"
 #include "boomerang/db/BasicBlock.h"
 #include "boomerang/db/Prog.h"
+#include "boomerang/db/proc/ProofCache.h"
+#include "boomerang/decomp/DecompilationBudget.h"
 #include "boomerang/decomp/IndirectJumpAnalyzer.h"
 #include "boomerang/ifc/IFrontEnd.h"
 #include "boomerang/passes/PassManager.h"
@@ -370,7 +372,8 @@ void ProcDecompiler::earlyDecompile(UserProc *proc)
 void ProcDecompiler::middleDecompile(UserProc *proc)
 {
     assert(m_callStack.back() == proc);
-    Project *project = proc->getProg()->getProject();
+    Project *project            = proc->getProg()->getProject();
+    DecompilationBudget *budget = project->getDecompilationBudget();
 
     project->alertDecompileDebugPoint(proc, "Before Middle");
     LOG_VERBOSE("### Beginning middleDecompile for '%1' ###", proc->getName());
@@ -447,6 +450,7 @@ void ProcDecompiler::middleDecompile(UserProc *proc)
             proc->getRetStmt()
                 ->updateModifieds(); // Everything including new arguments reaching the exit
             proc->getRetStmt()->updateReturns();
+            proc->getProg()->getProofCache()->invalidate(proc);
         }
 
         // Print if requested
@@ -466,7 +470,8 @@ void ProcDecompiler::middleDecompile(UserProc *proc)
         // FIXME: Check if this is needed any more. At least fib seems to need it at present.
         if (project->getSettings()->changeSignatures) {
             // addNewReturns(depth);
-            for (int i = 0; i < 3; i++) { // FIXME: should be iterate until no change
+            // FIXME: should be iterate until no change
+            for (int i = 0; i < 3 && !budget->isExhausted(proc); i++) {
                 LOG_VERBOSE("### update returns loop iteration %1 ###", i);
 
                 if (proc->getStatus() != PROC_INCYCLE) {
@@ -502,7 +507,7 @@ void ProcDecompiler::middleDecompile(UserProc *proc)
 
         // this is just to make it readable, do NOT rely on these statements being removed
         PassManager::get()->executePass(PassID::AssignRemoval, proc);
-    } while (change && ++pass < 12);
+    } while (change && ++pass < 12 && !budget->isExhausted(proc));
 
     // At this point, there will be some memofs that have still not been renamed. They have been
     // prevented from getting renamed so that they didn't get renamed incorrectly (usually as {-}),
@@ -531,12 +536,17 @@ void ProcDecompiler::middleDecompile(UserProc *proc)
         // mapExpressionsToParameters();
     }
 
-    // Check for indirect jumps or calls not already removed by propagation of constants
+    // Check for indirect jumps or calls not already removed by propagation of constants.
+    // Don't bother if the procedure is out of budget; restarting would be pointless.
     bool changed = false;
     IndirectJumpAnalyzer analyzer;
 
-    for (BasicBlock *bb : *proc->getCFG()) {
-        changed |= analyzer.decodeIndirectJmp(bb, proc);
+    if (!budget->isExhausted(proc)) {
+        for (BasicBlock *bb : *proc->getCFG()) {
+            changed |= analyzer.decodeIndirectJmp(bb, proc);
+        }
+
+        proc->getProg()->getProofCache()->invalidate(proc);
     }
 
     if (changed) {
@@ -674,10 +684,12 @@ void ProcDecompiler::recursionGroupAnalysis(const std::shared_ptr<ProcSet> &grou
     bool changed    = false;
     int numRepeats  = 0;
 
+    const DecompilationBudget *budget = entry->getProg()->getProject()->getDecompilationBudget();
+
     do {
         ProcSet visited;
         changed = decompileProcInRecursionGroup(entry, visited);
-    } while (changed && numRepeats++ < 2);
+    } while (changed && numRepeats++ < 2 && !budget->isDeadlineExceeded());
 
     // while no change
     for (int i = 0; i < 2; i++) {
@@ -753,7 +765,7 @@ void ProcDecompiler::saveDecodedICTs(UserProc *proc)
 {
     for (BasicBlock *bb : *proc->getCFG()) {
         BasicBlock::RTLRIterator rrit;
-        StatementList::reverse_iterator srit;
+        RTL::reverse_iterator srit;
         Statement *last = bb->getLastStmt(rrit, srit);
 
         if (last == nullptr) {
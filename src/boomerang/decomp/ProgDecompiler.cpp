@@ -14,11 +14,14 @@
 #include "boomerang/db/Global.h"
 #include "boomerang/db/Prog.h"
 #include "boomerang/db/module/Module.h"
+#include "boomerang/db/proc/ProofCache.h"
 #include "boomerang/db/proc/UserProc.h"
+#include "boomerang/decomp/DecompilationBudget.h"
 #include "boomerang/decomp/UnusedReturnRemover.h"
 #include "boomerang/passes/PassManager.h"
 #include "boomerang/ssl/exp/Const.h"
 #include "boomerang/ssl/exp/Location.h"
+#include "boomerang/ssl/type/TypeContext.h"
 #include "boomerang/util/log/Log.h"
 
 
@@ -33,6 +36,11 @@ void ProgDecompiler::decompile()
     assert(!m_prog->getModuleList().empty());
     LOG_VERBOSE("%1 procedures", m_prog->getNumFunctions(false));
 
+    // Once the budget is exhausted, procedures are still decompiled, but only the passes
+    // required for code generation are executed.
+    DecompilationBudget *budget = m_prog->getProject()->getDecompilationBudget();
+    budget->start();
+
     // Start decompiling each entry point
     for (UserProc *up : m_prog->getEntryProcs()) {
         LOG_MSG("Decompiling entry point '%1'", up->getName());
@@ -68,9 +76,9 @@ void ProgDecompiler::decompile()
 
     globalTypeAnalysis();
 
-    if (m_prog->getProject()->getSettings()->removeReturns) {
+    if (m_prog->getProject()->getSettings()->removeReturns && !budget->isDeadlineExceeded()) {
         // Repeat until no change. Not 100% sure if needed.
-        while (removeUnusedParamsAndReturns()) {
+        while (removeUnusedParamsAndReturns() && !budget->isDeadlineExceeded()) {
             for (auto &module : m_prog->getModuleList()) {
                 for (Function *proc : *module) {
                     if (proc->isLib()) {
@@ -89,6 +97,13 @@ void ProgDecompiler::decompile()
     // Now it is OK to transform out of SSA form
     fromSSAForm();
     removeUnusedGlobals();
+
+    m_prog->getProofCache()->logStats();
+    m_prog->getTypeContext()->logStats();
+
+    const Prog::PhiStats &phiStats = m_prog->getPhiStats();
+    LOG_VERBOSE("Phi statistics: %1 placed, %2 not placed because dead, %3 removed",
+                phiStats.numPlaced, phiStats.numPruned, phiStats.numRemoved);
     LOG_MSG("Decompilation finished.");
 }
 
@@ -139,11 +154,7 @@ void ProgDecompiler::removeUnusedGlobals()
             Location search(opGlobal, Terminal::get(opWild), proc);
             // Search each statement in u, excepting implicit assignments (their uses don't count,
             // since they don't really exist in the program representation)
-            StatementList stmts;
-            StatementList::iterator ss;
-            proc->getStatements(stmts);
-
-            for (Statement *s : stmts) {
+            for (Statement *s : proc->getStatements()) {
                 if (s->isImplicit()) {
                     continue; // Ignore the uses in ImplicitAssigns
                 }
@@ -153,8 +153,9 @@ bool UnusedReturnRemover::removeUnusedParamsAndReturns(UserProc *proc)
             }
 #endif
             // Union in the set of locations live at this call
-            UseCollector *useCol = cc->getUseCollector();
-            unionOfCallerLiveLocs.makeUnion(useCol->getLocSet());
+            for (const SharedExp &loc : *cc->getUseCollector()) {
+                unionOfCallerLiveLocs.insert(loc);
+            }
         }
     }
 
@@ -237,7 +238,7 @@ void UnusedReturnRemover::updateForUseChange(UserProc *proc)
 
     for (BasicBlock *bb : *proc->getCFG()) {
         BasicBlock::RTLRIterator rrit;
-        StatementList::reverse_iterator srit;
+        RTL::reverse_iterator srit;
         CallStatement *c = dynamic_cast<CallStatement *>(bb->getLastStmt(rrit, srit));
 
         // Note: we may have removed some statements, so there may no longer be a last statement!
@@ -23,6 +23,7 @@
 #include "boomerang/db/signature/Signature.h"
 #include "boomerang/decomp/IndirectJumpAnalyzer.h"
 #include "boomerang/frontend/DecodeResult.h"
+#include "boomerang/frontend/LinearSweepDecoder.h"
 #include "boomerang/ifc/IDecoder.h"
 #include "boomerang/ssl/RTL.h"
 #include "boomerang/ssl/exp/Const.h"
@@ -152,44 +153,60 @@ bool DefaultFrontEnd::decodeRecursive(Address addr)
 
 bool DefaultFrontEnd::decodeUndecoded()
 {
-    bool change = true;
     LOG_MSG("Looking for undecoded procedures to decode...");
+    const bool decodeChildren = m_program->getProject()->getSettings()->decodeChildren;
 
-    while (change) {
-        change = false;
+    // Callees discovered by processProc are queued when they are found. Procedures created
+    // by other means (e.g. from symbols or by the decoder) are found by scanning the program
+    // once the queue is empty. Usually, a single scan is enough.
+    // If not decoding children, only decode the first undecoded procedure of each module.
+    std::deque<Address> pending;
 
+    do {
         for (const auto &m : m_program->getModuleList()) {
             for (Function *function : *m) {
-                if (function->isLib()) {
-                    continue;
+                if (!function->isLib() && !static_cast<UserProc *>(function)->isDecoded()) {
+                    pending.push_back(function->getEntryAddress());
+
+                    if (!decodeChildren) {
+                        break;
+                    }
                 }
+            }
+        }
 
-                UserProc *userProc = static_cast<UserProc *>(function);
+        if (decodeChildren) {
+            m_undecodedProcs.insert(m_undecodedProcs.end(), pending.begin(), pending.end());
+            pending.clear();
+        }
 
-                if (userProc->isDecoded()) {
-                    continue;
-                }
+        std::deque<Address> &workList = decodeChildren ? m_undecodedProcs : pending;
+        bool change                   = false;
 
-                // undecoded userproc.. decode it
-                change = true;
+        while (!workList.empty()) {
+            const Address entryAddr = workList.front();
+            workList.pop_front();
 
-                if (!processProc(userProc, userProc->getEntryAddress())) {
-                    return false;
-                }
+            // The procedure may have been removed or decoded since it was queued.
+            Function *function = m_program->getFunctionByAddr(entryAddr);
+            if (!function || function->isLib() || static_cast<UserProc *>(function)->isDecoded()) {
+                continue;
+            }
 
-                userProc->setDecoded();
+            UserProc *userProc = static_cast<UserProc *>(function);
 
-                // Break out of the loops if not decoding children
-                if (!m_program->getProject()->getSettings()->decodeChildren) {
-                    break;
-                }
+            if (!processProc(userProc, userProc->getEntryAddress())) {
+                return false;
             }
+
+            userProc->setDecoded();
+            change = true;
         }
 
-        if (!m_program->getProject()->getSettings()->decodeChildren) {
+        if (!change) {
             break;
         }
-    }
+    } while (decodeChildren);
 
     return m_program->isWellFormed();
 }
@@ -320,7 +337,7 @@ bool DefaultFrontEnd::processProc(UserProc *proc, Address addr)
             // instructions (and their native address).
             // FIXME: However, this workaround breaks logic below where a GOTO is changed to a CALL
             // followed by a return if it points to the start of a known procedure
-            std::list<Statement *> sl(inst.rtl->getStatements());
+            RTL::StmtList sl(inst.rtl->getStatements());
 
             for (auto ss = sl.begin(); ss != sl.end(); ++ss) {
                 Statement *s = *ss;
@@ -758,6 +775,7 @@ bool DefaultFrontEnd::processProc(UserProc *proc, Address addr)
 
         if (np != nullptr) {
             proc->addCallee(np);
+            queueForDecoding(np);
         }
     }
 
@@ -785,16 +803,92 @@ bool DefaultFrontEnd::decodeSingleInstruction(Address pc, DecodeResult &result)
         return false;
     }
 
+    if (!m_preDecodeDone) {
+        preDecodeSections();
+    }
+
+    if (m_linearSweep && m_linearSweep->take(pc, result)) {
+        createCallDestinations(result);
+        return true;
+    }
+
     ptrdiff_t host_native_diff = (section->getHostAddr() - section->getSourceAddr()).value();
 
     try {
-        return m_decoder->decodeInstruction(pc, host_native_diff, result);
+        if (!m_decoder->decodeInstruction(pc, host_native_diff, result)) {
+            return false;
+        }
     }
     catch (std::runtime_error &e) {
         LOG_ERROR("%1", e.what());
         result.valid = false;
         return false;
     }
+
+    createCallDestinations(result);
+    return true;
+}
+
+
+void DefaultFrontEnd::createCallDestinations(DecodeResult &result)
+{
+    if (!result.valid || !result.rtl) {
+        return;
+    }
+
+    for (Statement *stmt : *result.rtl) {
+        if (!stmt->isCall()) {
+            continue;
+        }
+
+        CallStatement *call = static_cast<CallStatement *>(stmt);
+        if (call->isComputed() || call->getDestProc() != nullptr) {
+            continue;
+        }
+
+        const Address dest = call->getFixedDest();
+        if (dest == Address::INVALID) {
+            continue;
+        }
+
+        Function *destProc = m_program->getOrCreateFunction(dest);
+
+        if (destProc == reinterpret_cast<Function *>(-1)) {
+            destProc = nullptr; // In case a deleted Proc
+        }
+
+        call->setDestProc(destProc);
+    }
+}
+
+
+void DefaultFrontEnd::preDecodeSections()
+{
+    m_preDecodeDone = true;
+
+    const Settings *settings = m_program->getProject()->getSettings();
+    if (!settings->preDecode) {
+        return;
+    }
+    else if (!m_decoder || !m_decoder->canDecodeConcurrently()) {
+        LOG_WARN("Pre-decoding is not supported for this machine, decoding recursively only");
+        return;
+    }
+    else if (settings->debugDecoder) {
+        // Do not print disassembly of instructions that might never be reached
+        LOG_MSG("Pre-decoding is disabled while debugging the decoder");
+        return;
+    }
+
+    LOG_MSG("Pre-decoding code sections...");
+
+    m_linearSweep.reset(new LinearSweepDecoder(m_decoder.get(),
+                                               m_program->getBinaryFile()->getImage()));
+    m_linearSweep->sweep();
+
+    LOG_MSG("Pre-decoded %1 instructions, covering %2 of %3 code bytes",
+            m_linearSweep->getNumInstructions(), m_linearSweep->getNumDecodedBytes(),
+            m_linearSweep->getNumCodeBytes());
 }
 
 
@@ -991,8 +1085,8 @@ void DefaultFrontEnd::appendSyntheticReturn(BasicBlock *callBB, UserProc *proc,
 }
 
 
-void DefaultFrontEnd::preprocessProcGoto(std::list<Statement *>::iterator ss, Address dest,
-                                         const std::list<Statement *> &sl, RTL *originalRTL)
+void DefaultFrontEnd::preprocessProcGoto(RTL::iterator ss, Address dest, const RTL::StmtList &sl,
+                                         RTL *originalRTL)
 {
     Q_UNUSED(sl);
     assert(sl.back() == *ss);
@@ -1027,6 +1121,19 @@ void DefaultFrontEnd::preprocessProcGoto(std::list<Statement *>::iterator ss, Ad
 }
 
 
+void DefaultFrontEnd::queueForDecoding(Function *function)
+{
+    // Callees are not decoded unless decoding children, so there is no need to remember them.
+    if (!m_program->getProject()->getSettings()->decodeChildren) {
+        return;
+    }
+
+    if (!function->isLib() && !static_cast<UserProc *>(function)->isDecoded()) {
+        m_undecodedProcs.push_back(function->getEntryAddress());
+    }
+}
+
+
 UserProc *DefaultFrontEnd::createFunctionForEntryPoint(Address entryAddr,
                                                        const QString &functionType)
 {
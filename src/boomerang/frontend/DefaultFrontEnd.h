@@ -13,14 +13,15 @@
 #include "boomerang/frontend/SigEnum.h"
 #include "boomerang/frontend/TargetQueue.h"
 #include "boomerang/ifc/IFrontEnd.h"
+#include "boomerang/ssl/RTL.h"
 
+#include <deque>
 #include <map>
 #include <memory>
 
 
 class Function;
 class UserProc;
-class RTL;
 class IDecoder;
 class Exp;
 class Prog;
@@ -29,6 +30,7 @@ class Signature;
 class Statement;
 class CallStatement;
 class BinaryFile;
+class LinearSweepDecoder;
 
 class QString;
 
@@ -73,6 +75,13 @@ public:
     /// Decode a single instruction at address \p addr
     virtual bool decodeSingleInstruction(Address pc, DecodeResult &result);
 
+    /**
+     * Create the procedures called by the static calls in \p result and set them as the
+     * call destinations. This is done here rather than in the decoders so that decoders
+     * do not modify the program and can decode concurrently.
+     */
+    void createCallDestinations(DecodeResult &result);
+
     /// Do extra processing of call instructions.
     /// Does nothing by default.
     virtual void extraProcessCall(CallStatement *call, const RTLList &BB_rtls);
@@ -112,6 +121,10 @@ protected:
      */
     virtual bool isHelperFunc(Address dest, Address addr, RTLList &lrtl);
 
+    /// Remember \p function to be decoded by decodeUndecoded if it is an undecoded user proc.
+    /// Called by processProc for the callees of the decoded procedure.
+    void queueForDecoding(Function *function);
+
 private:
     /// \returns true iff \p exp is a memof that references the address of an imported function.
     bool refersToImportedFunction(const SharedExp &exp);
@@ -131,13 +144,17 @@ private:
      * Change a jump to a call if the jump destination is an impoted function.
      * \sa refersToImportedFunction
      */
-    void preprocessProcGoto(std::list<Statement *>::iterator ss, Address dest,
-                            const std::list<Statement *> &sl, RTL *originalRTL);
+    void preprocessProcGoto(RTL::iterator ss, Address dest, const RTL::StmtList &sl,
+                            RTL *originalRTL);
 
     /// Creates a UserProc for the entry point at address \p addr.
     /// Returns nullptr on failure.
     UserProc *createFunctionForEntryPoint(Address entryAddr, const QString &functionType);
 
+    /// Linearly sweep all code sections if requested by Settings::preDecode.
+    /// Called before the first instruction is decoded.
+    void preDecodeSections();
+
 protected:
     std::unique_ptr<IDecoder> m_decoder;
     BinaryFile *m_binaryFile;
@@ -151,4 +168,12 @@ protected:
     /// Map from address to previously decoded RTLs for decoded indirect control transfer
     /// instructions
     std::map<Address, RTL *> m_previouslyDecoded;
+
+    /// Entry addresses of procedures that were discovered, but might not be decoded yet.
+    /// Addresses are used instead of procedures since procedures may be removed while decoding.
+    std::deque<Address> m_undecodedProcs;
+
+    /// Instructions decoded ahead of the recursive traversal (see Settings::preDecode)
+    std::unique_ptr<LinearSweepDecoder> m_linearSweep;
+    bool m_preDecodeDone = false;
 };
@@ -0,0 +1,215 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "LinearSweepDecoder.h"
+
+#include "boomerang/db/binary/BinaryImage.h"
+#include "boomerang/db/binary/BinarySection.h"
+#include "boomerang/ifc/IDecoder.h"
+#include "boomerang/ssl/RTL.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <stdexcept>
+#include <thread>
+
+
+LinearSweepDecoder::LinearSweepDecoder(IDecoder *decoder, const BinaryImage *image)
+    : m_decoder(decoder)
+    , m_image(image)
+{
+    assert(m_decoder != nullptr);
+    assert(m_decoder->canDecodeConcurrently());
+}
+
+
+LinearSweepDecoder::~LinearSweepDecoder()
+{
+}
+
+
+void LinearSweepDecoder::sweep(int numThreads, int chunkSize)
+{
+    m_decoded.clear();
+    m_numInstructions = 0;
+    m_numDecodedBytes = 0;
+    m_numCodeBytes    = 0;
+
+    if (!m_image) {
+        return;
+    }
+
+    chunkSize = std::max(1, chunkSize);
+
+    // Chunks of the same section are consecutive and ordered by address.
+    std::vector<Chunk> chunks;
+
+    for (const BinarySection *section : *m_image) {
+        if (!section->isCode() || section->getHostAddr() == HostAddress::INVALID ||
+            section->getSize() <= 0) {
+            continue;
+        }
+
+        m_numCodeBytes += section->getSize();
+        const Address sectionEnd = section->getSourceAddr() + section->getSize();
+
+        for (Address from = section->getSourceAddr(); from < sectionEnd; from += chunkSize) {
+            Chunk chunk;
+            chunk.section = section;
+            chunk.from    = from;
+            chunk.to      = std::min(sectionEnd, from + chunkSize);
+            chunk.end     = chunk.from;
+            chunks.push_back(std::move(chunk));
+        }
+    }
+
+    if (numThreads <= 0) {
+        numThreads = static_cast<int>(std::max(1U, std::thread::hardware_concurrency()));
+    }
+
+    numThreads = std::min(numThreads, static_cast<int>(chunks.size()));
+
+    if (numThreads <= 1) {
+        for (Chunk &chunk : chunks) {
+            decodeChunk(chunk);
+        }
+    }
+    else {
+        std::atomic<std::size_t> nextChunk(0);
+        std::vector<std::thread> workers;
+        workers.reserve(numThreads);
+
+        for (int i = 0; i < numThreads; ++i) {
+            workers.emplace_back([this, &chunks, &nextChunk]() {
+                std::size_t idx;
+                while ((idx = nextChunk++) < chunks.size()) {
+                    decodeChunk(chunks[idx]);
+                }
+            });
+        }
+
+        for (std::thread &worker : workers) {
+            worker.join();
+        }
+    }
+
+    // The chunks were decoded independently of each other. The first instructions of a chunk
+    // may therefore overlap with the last instruction of the previous chunk.
+    for (std::size_t i = 1; i < chunks.size(); ++i) {
+        if (chunks[i].section == chunks[i - 1].section) {
+            resync(chunks[i - 1], chunks[i]);
+        }
+    }
+
+    std::size_t numDecoded = 0;
+    for (const Chunk &chunk : chunks) {
+        numDecoded += chunk.decoded.size();
+    }
+
+    m_decoded.reserve(numDecoded);
+
+    for (Chunk &chunk : chunks) {
+        for (Instruction &inst : chunk.decoded) {
+            m_numDecodedBytes += inst.result.numBytes;
+            m_decoded.push_back(std::move(inst));
+        }
+
+        chunk.decoded.clear();
+    }
+
+    // Sections are not necessarily ordered by address
+    std::stable_sort(m_decoded.begin(), m_decoded.end(),
+                     [](const Instruction &a, const Instruction &b) { return a.addr < b.addr; });
+
+    m_numInstructions = static_cast<int>(m_decoded.size());
+}
+
+
+bool LinearSweepDecoder::take(Address pc, DecodeResult &result)
+{
+    auto it = std::lower_bound(
+        m_decoded.begin(), m_decoded.end(), pc,
+        [](const Instruction &inst, const Address &addr) { return inst.addr < addr; });
+
+    if (it == m_decoded.end() || it->addr != pc || !it->result.valid || !it->result.rtl) {
+        return false;
+    }
+
+    result = std::move(it->result);
+    it->result.reset();
+    return true;
+}
+
+
+void LinearSweepDecoder::decodeChunk(Chunk &chunk) const
+{
+    Address pc = chunk.from;
+
+    while (pc < chunk.to) {
+        pc = decodeOne(chunk, pc);
+    }
+
+    chunk.end = pc;
+}
+
+
+Address LinearSweepDecoder::decodeOne(Chunk &chunk, Address pc) const
+{
+    const BinarySection *section = chunk.section;
+    const Address sectionEnd     = section->getSourceAddr() + section->getSize();
+    const ptrdiff_t delta        = (section->getHostAddr() - section->getSourceAddr()).value();
+
+    DecodeResult result;
+    bool ok = false;
+
+    try {
+        ok = m_decoder->decodeInstruction(pc, delta, result);
+    }
+    catch (const std::runtime_error &) {
+        // Logging is not thread safe. The front end will report the error
+        // when it decodes the instruction itself.
+        ok = false;
+    }
+
+    if (!ok || !result.valid || !result.rtl || result.numBytes <= 0 ||
+        pc + result.numBytes > sectionEnd) {
+        // skip over the invalid byte
+        return pc + 1;
+    }
+
+    const int numBytes = result.numBytes;
+    chunk.decoded.push_back({ pc, std::move(result) });
+    return pc + numBytes;
+}
+
+
+void LinearSweepDecoder::resync(Chunk &prev, Chunk &next) const
+{
+    Address pc = prev.end;
+    auto it    = next.decoded.begin();
+
+    while (true) {
+        while (it != next.decoded.end() && it->addr < pc) {
+            ++it;
+        }
+
+        if (it != next.decoded.end() && it->addr == pc) {
+            break; // back in sync
+        }
+        else if (pc >= next.end) {
+            break; // none of the instructions of next were aligned
+        }
+
+        pc = decodeOne(prev, pc);
+    }
+
+    next.decoded.erase(next.decoded.begin(), it);
+    next.end = std::max(next.end, pc);
+}
@@ -0,0 +1,114 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include "boomerang/frontend/DecodeResult.h"
+
+#include <vector>
+
+
+class BinaryImage;
+class BinarySection;
+class IDecoder;
+
+
+/**
+ * Decodes all code sections of a binary image ahead of the recursive traversal.
+ *
+ * Each code section is linearly swept from start to end. Bytes that cannot be decoded
+ * are skipped one at a time. The sections are split into chunks which are decoded
+ * concurrently; afterwards the instructions at the chunk boundaries are re-synchronized,
+ * so the result is the same as if each section had been swept by a single thread.
+ *
+ * The decoded instructions can then be taken out of the table by the front end
+ * instead of decoding them again. Instructions that are not in the table (e.g. because
+ * the linear sweep got out of sync with the control flow) must be decoded normally.
+ *
+ * \note The decoder must support concurrent decoding (see IDecoder::canDecodeConcurrently).
+ */
+class BOOMERANG_API LinearSweepDecoder
+{
+public:
+    static constexpr int DEFAULT_CHUNK_SIZE = 0x10000;
+
+public:
+    LinearSweepDecoder(IDecoder *decoder, const BinaryImage *image);
+    LinearSweepDecoder(const LinearSweepDecoder &other) = delete;
+    LinearSweepDecoder(LinearSweepDecoder &&other)      = default;
+
+    ~LinearSweepDecoder();
+
+    LinearSweepDecoder &operator=(const LinearSweepDecoder &other) = delete;
+    LinearSweepDecoder &operator=(LinearSweepDecoder &&other) = default;
+
+public:
+    /**
+     * Decode all code sections of the image.
+     * \param numThreads number of threads to use. If <= 0, one thread per CPU core is used.
+     * \param chunkSize  number of bytes decoded by a thread at once.
+     */
+    void sweep(int numThreads = 0, int chunkSize = DEFAULT_CHUNK_SIZE);
+
+    /**
+     * Move the pre-decoded instruction at address \p pc into \p result.
+     * Each instruction can only be taken once.
+     * \returns false if there is no (more) valid instruction at \p pc.
+     */
+    bool take(Address pc, DecodeResult &result);
+
+    /// \returns the number of valid instructions found by the sweep
+    int getNumInstructions() const { return m_numInstructions; }
+
+    /// \returns the number of code bytes covered by valid instructions
+    int getNumDecodedBytes() const { return m_numDecodedBytes; }
+
+    /// \returns the total number of bytes in the swept code sections
+    int getNumCodeBytes() const { return m_numCodeBytes; }
+
+private:
+    struct Instruction
+    {
+        Address addr;
+        DecodeResult result;
+    };
+
+    struct Chunk
+    {
+        const BinarySection *section = nullptr;
+        Address from;                      ///< first address to decode
+        Address to;                        ///< stop decoding at this address
+        Address end;                       ///< address after the last decoded byte
+        std::vector<Instruction> decoded;  ///< valid instructions, ordered by address
+    };
+
+    /// Linearly decode all instructions between \p chunk.from and \p chunk.to
+    void decodeChunk(Chunk &chunk) const;
+
+    /**
+     * Decode a single instruction at \p pc and append it to \p chunk if it is valid.
+     * \returns the address of the next instruction.
+     */
+    Address decodeOne(Chunk &chunk, Address pc) const;
+
+    /// Drop the misaligned instructions at the start of \p next
+    /// and fill the gap between \p prev and \p next.
+    void resync(Chunk &prev, Chunk &next) const;
+
+private:
+    IDecoder *m_decoder;
+    const BinaryImage *m_image;
+
+    std::vector<Instruction> m_decoded; ///< ordered by address
+
+    int m_numInstructions = 0;
+    int m_numDecodedBytes = 0;
+    int m_numCodeBytes    = 0;
+};
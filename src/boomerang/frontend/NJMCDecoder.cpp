@@ -29,12 +29,12 @@
 
 
 NJMCDecoder::NJMCDecoder(Prog *prog, const QString &sslFilePath)
-    : m_rtlDict(prog->getProject()->getSettings()->debugDecoder)
-    , m_prog(prog)
+    : m_prog(prog)
 {
     QDir dataDir = prog->getProject()->getSettings()->getDataDirectory();
+    m_rtlDict = prog->getProject()->getSSLDictionary(dataDir.absoluteFilePath(sslFilePath));
 
-    if (!m_rtlDict.readSSLFile(dataDir.absoluteFilePath(sslFilePath))) {
+    if (!m_rtlDict) {
         LOG_ERROR("Cannot read SSL file '%1'", sslFilePath);
         throw std::runtime_error("Failed to read SSL file");
     }
@@ -45,14 +45,14 @@ std::unique_ptr<RTL> NJMCDecoder::instantiate(Address pc, const char *name,
                                               const std::initializer_list<SharedExp> &args)
 {
     // Get the signature of the instruction and extract its parts
-    std::pair<QString, int> sig = m_rtlDict.getSignature(name);
+    std::pair<QString, int> sig = m_rtlDict->getSignature(name);
     QString opcode              = sig.first;
     int numOperands             = sig.second;
 
     if (numOperands == -1) {
         LOG_ERROR("Could not find semantics for instruction '%1', treating instruction as NOP",
                   name);
-        return m_rtlDict.instantiateRTL("NOP", pc, {});
+        return m_rtlDict->instantiateRTL("NOP", pc, {});
     }
     else if (numOperands != (int)args.size()) {
         QString msg = QString("Disassembled instruction '%1' has %2 arguments, "
@@ -92,7 +92,7 @@ std::unique_ptr<RTL> NJMCDecoder::instantiate(Address pc, const char *name,
         q_cout << '\n';
     }
 
-    return m_rtlDict.instantiateRTL(opcode, pc, actuals);
+    return m_rtlDict->instantiateRTL(opcode, pc, actuals);
 }
 
 
@@ -149,17 +149,23 @@ void NJMCDecoder::processComputedCall(const char *name, int size, SharedExp dest
 
 QString NJMCDecoder::getRegName(int idx) const
 {
-    return m_rtlDict.getRegNameByID(idx);
+    return m_rtlDict->getRegNameByID(idx);
 }
 
 
 int NJMCDecoder::getRegSize(int idx) const
 {
-    return m_rtlDict.getRegSizeByID(idx);
+    return m_rtlDict->getRegSizeByID(idx);
 }
 
 
 int NJMCDecoder::getRegIdx(const QString &name) const
 {
-    return m_rtlDict.getRegIDByName(name);
+    return m_rtlDict->getRegIDByName(name);
+}
+
+
+int NJMCDecoder::getRegParent(int idx, int &offset) const
+{
+    return m_rtlDict->getRegParentByID(idx, offset);
 }
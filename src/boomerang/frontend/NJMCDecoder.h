@@ -36,7 +36,7 @@ public:
     NJMCDecoder &operator=(NJMCDecoder &&other) = default;
 
 public:
-    RTLInstDict &getRTLDict() { return m_rtlDict; }
+    const RTLInstDict &getRTLDict() const { return *m_rtlDict; }
 
     /**
      * Process an indirect jump instruction.
@@ -70,6 +70,9 @@ public:
     /// \copydoc IDecoder::getRegIdx
     int getRegIdx(const QString &name) const override;
 
+    /// \copydoc IDecoder::getRegParent
+    int getRegParent(int idx, int &offset) const override;
+
 protected:
     /**
      * Given an instruction name and a variable list of expressions
@@ -116,8 +119,8 @@ protected:
 
 protected:
     // Dictionary of instruction patterns, and other information summarised from the SSL file
-    // (e.g. source machine's endianness)
-    RTLInstDict m_rtlDict;
+    // (e.g. source machine's endianness). Shared between all decoders of the same project.
+    std::shared_ptr<const RTLInstDict> m_rtlDict;
     Prog *m_prog         = nullptr;
     BinaryImage *m_image = nullptr;
 };
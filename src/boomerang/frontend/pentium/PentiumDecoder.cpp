@@ -13571,16 +13571,9 @@ bool PentiumDecoder::decodeInstruction(Address pc, ptrdiff_t delta, DecodeResult
                             }
                             else {
                                 CallStatement *call = new CallStatement;
-                                // Set the destination
+                                // Set the destination. The front end creates the callee.
                                 call->setDest(nativeDest);
                                 result.rtl->append(call);
-                                Function *destProc = m_prog->getOrCreateFunction(nativeDest);
-
-                                if (destProc == reinterpret_cast<Function *>(-1)) {
-                                    destProc = nullptr; // In case a deleted Proc
-                                }
-
-                                call->setDestProc(destProc);
                             }
                         }
                         break;
@@ -9,6 +9,8 @@
 #pragma endregion License
 #include "PentiumFrontEnd.h"
 
+#include "boomerang/core/Project.h"
+#include "boomerang/core/Settings.h"
 #include "boomerang/db/BasicBlock.h"
 #include "boomerang/db/Prog.h"
 #include "boomerang/db/binary/BinaryImage.h"
@@ -20,6 +22,7 @@
 #include "boomerang/frontend/pentium/PentiumDecoder.h"
 #include "boomerang/frontend/pentium/StringInstructionProcessor.h"
 #include "boomerang/ssl/RTL.h"
+#include "boomerang/ssl/exp/Binary.h"
 #include "boomerang/ssl/exp/Const.h"
 #include "boomerang/ssl/exp/Location.h"
 #include "boomerang/ssl/exp/Terminal.h"
@@ -30,8 +33,15 @@
 #include "boomerang/ssl/type/FuncType.h"
 #include "boomerang/ssl/type/IntegerType.h"
 #include "boomerang/ssl/type/PointerType.h"
+#include "boomerang/util/BitSet.h"
 #include "boomerang/util/log/Log.h"
 
+#include <algorithm>
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
 
 void PentiumFrontEnd::bumpRegisterAll(SharedExp e, int min, int max, int delta, int mask)
 {
@@ -108,39 +118,39 @@ void PentiumFrontEnd::processFloatCode(ProcCFG *cfg)
                         Location::tempOf(Const::get(const_cast<char *>("tmpD9"))),
                         Location::regOf(REG_PENT_ST7));
                     asgn->setBB(bb);
-                    rtl->insert(iter, asgn);
+                    iter = std::next(rtl->insert(iter, asgn));
                     asgn = new Assign(FloatType::get(80), Location::regOf(REG_PENT_ST7),
                                       Location::regOf(REG_PENT_ST6));
                     asgn->setBB(bb);
-                    rtl->insert(iter, asgn);
+                    iter = std::next(rtl->insert(iter, asgn));
                     asgn = new Assign(FloatType::get(80), Location::regOf(REG_PENT_ST6),
                                       Location::regOf(REG_PENT_ST5));
                     asgn->setBB(bb);
-                    rtl->insert(iter, asgn);
+                    iter = std::next(rtl->insert(iter, asgn));
                     asgn = new Assign(FloatType::get(80), Location::regOf(REG_PENT_ST5),
                                       Location::regOf(REG_PENT_ST4));
                     asgn->setBB(bb);
-                    rtl->insert(iter, asgn);
+                    iter = std::next(rtl->insert(iter, asgn));
                     asgn = new Assign(FloatType::get(80), Location::regOf(REG_PENT_ST4),
                                       Location::regOf(REG_PENT_ST3));
                     asgn->setBB(bb);
-                    rtl->insert(iter, asgn);
+                    iter = std::next(rtl->insert(iter, asgn));
                     asgn = new Assign(FloatType::get(80), Location::regOf(REG_PENT_ST3),
                                       Location::regOf(REG_PENT_ST2));
                     asgn->setBB(bb);
-                    rtl->insert(iter, asgn);
+                    iter = std::next(rtl->insert(iter, asgn));
                     asgn = new Assign(FloatType::get(80), Location::regOf(REG_PENT_ST2),
                                       Location::regOf(REG_PENT_ST1));
                     asgn->setBB(bb);
-                    rtl->insert(iter, asgn);
+                    iter = std::next(rtl->insert(iter, asgn));
                     asgn = new Assign(FloatType::get(80), Location::regOf(REG_PENT_ST1),
                                       Location::regOf(REG_PENT_ST0));
                     asgn->setBB(bb);
-                    rtl->insert(iter, asgn);
+                    iter = std::next(rtl->insert(iter, asgn));
                     asgn = new Assign(FloatType::get(80), Location::regOf(REG_PENT_ST0),
                                       Location::tempOf(Const::get(const_cast<char *>("tmpD9"))));
                     asgn->setBB(bb);
-                    rtl->insert(iter, asgn);
+                    iter = std::next(rtl->insert(iter, asgn));
 
                     // Remove the FPUSH
                     iter = rtl->erase(iter);
@@ -152,39 +162,39 @@ void PentiumFrontEnd::processFloatCode(ProcCFG *cfg)
                         Location::tempOf(Const::get(const_cast<char *>("tmpD9"))),
                         Location::regOf(REG_PENT_ST0));
                     asgn->setBB(bb);
-                    rtl->insert(iter, asgn);
+                    iter = std::next(rtl->insert(iter, asgn));
                     asgn = new Assign(FloatType::get(80), Location::regOf(REG_PENT_ST0),
                                       Location::regOf(REG_PENT_ST1));
                     asgn->setBB(bb);
-                    rtl->insert(iter, asgn);
+                    iter = std::next(rtl->insert(iter, asgn));
                     asgn = new Assign(FloatType::get(80), Location::regOf(REG_PENT_ST1),
                                       Location::regOf(REG_PENT_ST2));
                     asgn->setBB(bb);
-                    rtl->insert(iter, asgn);
+                    iter = std::next(rtl->insert(iter, asgn));
                     asgn = new Assign(FloatType::get(80), Location::regOf(REG_PENT_ST2),
                                       Location::regOf(REG_PENT_ST3));
                     asgn->setBB(bb);
-                    rtl->insert(iter, asgn);
+                    iter = std::next(rtl->insert(iter, asgn));
                     asgn = new Assign(FloatType::get(80), Location::regOf(REG_PENT_ST3),
                                       Location::regOf(REG_PENT_ST4));
                     asgn->setBB(bb);
-                    rtl->insert(iter, asgn);
+                    iter = std::next(rtl->insert(iter, asgn));
                     asgn = new Assign(FloatType::get(80), Location::regOf(REG_PENT_ST4),
                                       Location::regOf(REG_PENT_ST5));
                     asgn->setBB(bb);
-                    rtl->insert(iter, asgn);
+                    iter = std::next(rtl->insert(iter, asgn));
                     asgn = new Assign(FloatType::get(80), Location::regOf(REG_PENT_ST5),
                                       Location::regOf(REG_PENT_ST6));
                     asgn->setBB(bb);
-                    rtl->insert(iter, asgn);
+                    iter = std::next(rtl->insert(iter, asgn));
                     asgn = new Assign(FloatType::get(80), Location::regOf(REG_PENT_ST6),
                                       Location::regOf(REG_PENT_ST7));
                     asgn->setBB(bb);
-                    rtl->insert(iter, asgn);
+                    iter = std::next(rtl->insert(iter, asgn));
                     asgn = new Assign(FloatType::get(80), Location::regOf(REG_PENT_ST7),
                                       Location::tempOf(Const::get(const_cast<char *>("tmpD9"))));
                     asgn->setBB(bb);
-                    rtl->insert(iter, asgn);
+                    iter = std::next(rtl->insert(iter, asgn));
 
                     // Remove the FPOP
                     iter = rtl->erase(iter);
@@ -518,6 +528,116 @@ void PentiumFrontEnd::processStringInst(UserProc *proc)
 }
 
 
+/// A register overlapping a register defined by a statement, see processOverlapped
+struct OverlappedReg
+{
+    int reg;      ///< the overlapping register
+    int offset;   ///< bit offset of the smaller register in the larger register
+    bool isSuper; ///< true if \ref reg contains the defined register
+};
+
+
+/**
+ * Find the registers overlapping \p reg according to the SHARES declarations
+ * of the register table of the decoder, e.g. %ax, %al and %ah for %eax.
+ * Only registers in \p usedRegs are considered; containing registers come first (largest first),
+ * then the contained registers.
+ * The stack pointer is excluded; for now, let's hope we never encounter %sp. :-)
+ */
+static std::vector<OverlappedReg> findOverlappedRegs(const IDecoder *decoder, int reg,
+                                                     const std::set<int> &usedRegs)
+{
+    std::vector<OverlappedReg> result;
+    if (reg == REG_PENT_ESP) {
+        return result;
+    }
+
+    int offset = 0;
+    for (int r = reg;;) {
+        int parentOffset = 0;
+        r                = decoder->getRegParent(r, parentOffset);
+
+        if (r == -1) {
+            break;
+        }
+        else if (r == REG_PENT_ESP) {
+            return {};
+        }
+
+        offset += parentOffset;
+        if (usedRegs.find(r) != usedRegs.end()) {
+            result.insert(result.begin(), { r, offset, true });
+        }
+    }
+
+    for (int used : usedRegs) {
+        int usedOffset = 0;
+        int r          = used;
+
+        while (r != -1 && r != reg) {
+            int parentOffset = 0;
+            r                = decoder->getRegParent(r, parentOffset);
+            usedOffset += parentOffset;
+        }
+
+        if (r == reg && used != reg) {
+            result.push_back({ used, usedOffset, false });
+        }
+    }
+
+    return result;
+}
+
+
+/// Create the assignment that updates the overlapping register \p overlap
+/// after \p reg has been assigned to.
+static Assign *createOverlappedAssign(const IDecoder *decoder, int reg,
+                                      const OverlappedReg &overlap)
+{
+    const int regSize     = decoder->getRegSize(reg);
+    const int overlapSize = decoder->getRegSize(overlap.reg);
+    SharedExp rhs;
+
+    if (!overlap.isSuper) {
+        if (overlap.offset == 0) {
+            // Emit e.g. *8* r8 := trunc(32, 8, r24)
+            rhs = Ternary::get(opTruncu, Const::get(regSize), Const::get(overlapSize),
+                               Location::regOf(reg));
+        }
+        else {
+            // Emit e.g. *8* r12 := r24@[15:8]
+            rhs = Ternary::get(opAt, Location::regOf(reg),
+                               Const::get(overlap.offset + overlapSize - 1),
+                               Const::get(overlap.offset));
+        }
+    }
+    else {
+        // Emit e.g. *32* r24 := (r24 & 0xFFFFFF00) | zfill(8, 32, r8)
+        //      or   *32* r24 := (r24 & 0xFFFF00FF) | (r12 << 8)
+        const QWord overlapMask = overlapSize >= 64 ? ~QWord(0)
+                                                    : (QWord(1) << overlapSize) - 1;
+        const QWord keepMask = overlapMask & ~(((QWord(1) << regSize) - 1) << overlap.offset);
+
+        SharedExp keep = Binary::get(opBitAnd, Location::regOf(overlap.reg),
+                                     overlapSize <= 32 ? Const::get(uint32_t(keepMask))
+                                                       : Const::get(keepMask));
+        SharedExp insert;
+
+        if (overlap.offset == 0) {
+            insert = Ternary::get(opZfill, Const::get(regSize), Const::get(overlapSize),
+                                  Location::regOf(reg));
+        }
+        else {
+            insert = Binary::get(opShiftL, Location::regOf(reg), Const::get(overlap.offset));
+        }
+
+        rhs = Binary::get(opBitOr, keep, insert);
+    }
+
+    return new Assign(IntegerType::get(overlapSize), Location::regOf(overlap.reg), rhs);
+}
+
+
 void PentiumFrontEnd::processOverlapped(UserProc *proc)
 {
     // first, lets look for any uses of the registers
@@ -539,209 +659,189 @@ void PentiumFrontEnd::processOverlapped(UserProc *proc)
         }
     }
 
-    std::set<BasicBlock *> bbs;
-
-    // For each statement, we are looking for assignments to registers in
-    //     these ranges:
-    //   eax - ebx (24-27) (eax, ecx, edx, ebx)
-    //    ax -  bx ( 0- 3) ( ax,    cx,     dx,  bx)
-    //    al -  bl ( 8-11) ( al,    cl,     dl,  bl)
-    //    ah -  bh (12-15) ( ah,    ch,     dh,  bh)
-    // if found we want to generate assignments to the overlapping registers,
-    // but only if they are used in this procedure.
-    //
-    // TMN: 2006-007-31. This code had been completely forgotten about:
-    // esi/si, edi/di and ebp/bp. For now, let's hope we never encounter esp/sp. :-)
-    // ebp (29)  bp (5)
-    // esi (30)  si (6)
-    // edi (31)  di (7)
-    for (Statement *s : stmts) {
-        if (isOverlappedRegsProcessed(s->getBB())) { // never redo processing
-            continue;
-        }
-
-        bbs.insert(s->getBB());
-
+    // \returns the register assigned to by \p s, or -1 if none
+    auto getDefinedReg = [](const Statement *s) {
         if (!s->isAssignment()) {
-            continue;
+            return -1;
         }
 
-        SharedExp lhs = static_cast<Assignment *>(s)->getLeft();
-
+        SharedConstExp lhs = static_cast<const Assignment *>(s)->getLeft();
         if (!lhs->isRegOf()) {
-            continue;
+            return -1;
         }
 
         auto c = lhs->access<Const, 1>();
         assert(c->isIntConst());
-        const int r        = c->getInt();
-        const int off      = r & 3; // Offset into the array of 4 registers
-        const int off_mod8 = r & 7; // Offset into the array of 8 registers; for ebp, esi, edi
-
-        switch (r) {
-        case REG_PENT_EAX:
-        case REG_PENT_ECX:
-        case REG_PENT_EDX:
-        case REG_PENT_EBX:
-            // Emit *16* r<off> := trunc(32, 16, r<24+off>)
-            if (usedRegs.find(REG_PENT_AX + off) != usedRegs.end()) {
-                Assign *a = new Assign(IntegerType::get(16), Location::regOf(REG_PENT_AX + off),
-                                       Ternary::get(opTruncu, Const::get(32), Const::get(16),
-                                                    Location::regOf(REG_PENT_EAX + off)));
-                proc->insertStatementAfter(s, a);
-            }
+        return c->getInt();
+    };
 
-            // Emit *8* r<8+off> := trunc(32, 8, r<24+off>)
-            if (usedRegs.find(REG_PENT_AL + off) != usedRegs.end()) {
-                Assign *a = new Assign(IntegerType::get(8), Location::regOf(REG_PENT_AL + off),
-                                       Ternary::get(opTruncu, Const::get(32), Const::get(8),
-                                                    Location::regOf(REG_PENT_EAX + off)));
-                proc->insertStatementAfter(s, a);
-            }
+    // For each register assigned to, the overlapping registers used in this procedure.
+    // E.g. after an assignment to %eax, %ax, %al and %ah need to be updated
+    // (if they are used), and after an assignment to %al, %ax and %eax.
+    std::map<int, std::vector<OverlappedReg>> overlaps;
+    int numRegs = usedRegs.empty() ? 0 : *usedRegs.rbegin() + 1;
 
-            // Emit *8* r<12+off> := r<24+off>@[15:8]
-            if (usedRegs.find(REG_PENT_AH + off) != usedRegs.end()) {
-                Assign *a = new Assign(IntegerType::get(8), Location::regOf(REG_PENT_AH + off),
-                                       Ternary::get(opAt, Location::regOf(REG_PENT_EAX + off),
-                                                    Const::get(15), Const::get(8)));
-                proc->insertStatementAfter(s, a);
-            }
-            break;
+    for (Statement *s : stmts) {
+        const int r = getDefinedReg(s);
 
-        case REG_PENT_AX:
-        case REG_PENT_CX:
-        case REG_PENT_DX:
-        case REG_PENT_BX:
-            // Emit *32* r<24+off> := (r<24+off> & 0xFFFF0000) | zfill(16, 32, r<off>)
-            if (usedRegs.find(REG_PENT_EAX + off) != usedRegs.end()) {
-                Assign *a = new Assign(
-                    IntegerType::get(32), Location::regOf(REG_PENT_EAX + off),
-                    Binary::get(opBitOr,
-                                Binary::get(opBitAnd, Location::regOf(REG_PENT_EAX + off),
-                                            Const::get(0xFFFF0000)),
-                                Ternary::get(opZfill, Const::get(16), Const::get(32),
-                                             Location::regOf(REG_PENT_AX + off))));
-                proc->insertStatementAfter(s, a);
-            }
+        if (r != -1 && overlaps.find(r) == overlaps.end()) {
+            overlaps[r] = findOverlappedRegs(getDecoder(), r, usedRegs);
+            numRegs     = std::max(numRegs, r + 1);
+        }
+    }
 
-            // Emit *8* r<8+off> := trunc(16, 8, r<off>)
-            if (usedRegs.find(REG_PENT_AL + off) != usedRegs.end()) {
-                Assign *a = new Assign(IntegerType::get(8), Location::regOf(REG_PENT_AL + off),
-                                       Ternary::get(opTruncu, Const::get(16), Const::get(8),
-                                                    Location::regOf(REG_PENT_EAX + off)));
-                proc->insertStatementAfter(s, a);
-            }
+    // Assignments to overlapping registers are only inserted where the overlapping register
+    // is live, i.e. where it might be used before it is assigned to again.
+    // Since the inserted assignments are uses and definitions themselves, they are taken into
+    // account while calculating liveness for blocks that have not been processed before.
+    // Calls and returns use every register (their collectors take the reaching definitions
+    // of all registers), and so does the unknown code after blocks without successors.
+    const bool pruneOverlaps = m_program->getProject()->getSettings()->prunedOverlaps;
+    typedef BitSet RegSet;
+
+    auto updateLive = [&](Statement *s, RegSet &live, bool isProcessed,
+                          std::vector<std::pair<Statement *, OverlappedReg>> *toInsert) {
+        const int r = getDefinedReg(s);
+
+        if (r != -1) {
+            if (!isProcessed) {
+                for (const OverlappedReg &overlap : overlaps[r]) {
+                    if (pruneOverlaps && !live.test(overlap.reg)) {
+                        continue;
+                    }
 
-            // Emit *8* r<12+off> := r<off>@[15:8]
-            if (usedRegs.find(REG_PENT_AH + off) != usedRegs.end()) {
-                Assign *a = new Assign(IntegerType::get(8), Location::regOf(REG_PENT_AH + off),
-                                       Ternary::get(opAt, Location::regOf(REG_PENT_AX + off),
-                                                    Const::get(15), Const::get(8)));
-                proc->insertStatementAfter(s, a);
-            }
+                    if (toInsert) {
+                        toInsert->push_back({ s, overlap });
+                    }
 
-            break;
+                    // Containing registers keep the bits not overlapped by r
+                    if (overlap.isSuper) {
+                        live.set(overlap.reg);
+                    }
+                    else {
+                        live.reset(overlap.reg);
+                    }
 
-        case REG_PENT_AL:
-        case REG_PENT_CL:
-        case REG_PENT_DL:
-        case REG_PENT_BL:
-            // Emit *32* r<24+off> := (r<24+off> & 0xFFFFFF00) | zfill(8, 32, r<8+off>)
-            if (usedRegs.find(REG_PENT_EAX + off) != usedRegs.end()) {
-                Assign *a = new Assign(
-                    IntegerType::get(32), Location::regOf(REG_PENT_EAX + off),
-                    Binary::get(opBitOr,
-                                Binary::get(opBitAnd, Location::regOf(REG_PENT_EAX + off),
-                                            Const::get(0xFFFFFF00)),
-                                Ternary::get(opZfill, Const::get(8), Const::get(32),
-                                             Location::regOf(REG_PENT_AL + off))));
-                proc->insertStatementAfter(s, a);
+                    live.set(r);
+                }
             }
 
-            // Emit *16* r<off> := (r<off> & 0xFF00) | zfill(8, 16, r<8+off>)
-            if (usedRegs.find(REG_PENT_AX + off) != usedRegs.end()) {
-                Assign *a = new Assign(
-                    IntegerType::get(16), Location::regOf(REG_PENT_AX + off),
-                    Binary::get(opBitOr,
-                                Binary::get(opBitAnd, Location::regOf(REG_PENT_AX + off),
-                                            Const::get(0xFF00)),
-                                Ternary::get(opZfill, Const::get(8), Const::get(16),
-                                             Location::regOf(REG_PENT_AL + off))));
-                proc->insertStatementAfter(s, a);
+            live.reset(r);
+        }
+
+        if (s->isCall() || s->isReturn()) {
+            live.setAll();
+            return;
+        }
+
+        LocationSet locs;
+        s->addUsedLocs(locs);
+
+        for (const SharedExp &l : locs) {
+            if (l->isRegOfConst()) {
+                live.set(l->access<Const, 1>()->getInt());
             }
+        }
+    };
 
-            break;
+    std::vector<BasicBlock *> bbs;
+    std::unordered_map<const BasicBlock *, RegSet> liveIn;
+
+    for (BasicBlock *bb : *proc->getCFG()) {
+        if (bb->getRTLs()) {
+            bbs.push_back(bb);
+            liveIn[bb] = RegSet(numRegs);
+        }
+    }
+
+    auto getLiveOut = [&liveIn, numRegs](const BasicBlock *bb) {
+        // Nothing is known about the code after a block without successors
+        RegSet liveOut(numRegs, bb->getNumSuccessors() == 0);
 
-        case REG_PENT_AH:
-        case REG_PENT_CH:
-        case REG_PENT_DH:
-        case REG_PENT_BH:
-            // Emit *32* r<24+off> := (r<24+off> & 0xFFFF00FF) | (r<12+off> << 8)
-            if (usedRegs.find(REG_PENT_EAX + off) != usedRegs.end()) {
-                Assign *a = new Assign(
-                    IntegerType::get(32), Location::regOf(REG_PENT_EAX + off),
-                    Binary::get(
-                        opBitOr,
-                        Binary::get(opBitAnd, Location::regOf(REG_PENT_EAX + off),
-                                    Const::get(0xFFFF00FF)),
-                        Binary::get(opShiftL, Location::regOf(REG_PENT_AH + off), Const::get(8))));
-                proc->insertStatementAfter(s, a);
+        for (const BasicBlock *succ : bb->getSuccessors()) {
+            auto it = liveIn.find(succ);
+
+            if (it != liveIn.end()) {
+                liveOut |= it->second;
+            }
+            else {
+                // not decoded yet
+                liveOut.setAll();
             }
+        }
+
+        return liveOut;
+    };
+
+    bool change = true;
+    while (change) {
+        change = false;
+
+        for (auto bbIt = bbs.rbegin(); bbIt != bbs.rend(); ++bbIt) {
+            BasicBlock *bb         = *bbIt;
+            RegSet live            = getLiveOut(bb);
+            const bool isProcessed = isOverlappedRegsProcessed(bb);
 
-            // Emit *16* r<off> := r<off> & 0x00FF
-            //      *16* r<off> := r<off> | r<12+off> << 8
-            if (usedRegs.find(REG_PENT_AX + off) != usedRegs.end()) {
-                Assign *a = new Assign(
-                    IntegerType::get(16), Location::regOf(REG_PENT_AX + off),
-                    Binary::get(
-                        opBitOr,
-                        Binary::get(opShiftL, Location::regOf(REG_PENT_AH + off), Const::get(8)),
-                        Ternary::get(opAt, Location::regOf(REG_PENT_AX + off), Const::get(7),
-                                     Const::get(0))));
-                proc->insertStatementAfter(s, a);
+            BasicBlock::RTLRIterator rrit;
+            RTL::reverse_iterator srit;
+
+            for (Statement *s = bb->getLastStmt(rrit, srit); s; s = bb->getPrevStmt(rrit, srit)) {
+                updateLive(s, live, isProcessed, nullptr);
             }
-            break;
 
-        case REG_PENT_BP:
-        case REG_PENT_SI:
-        case REG_PENT_DI:
-            // Emit *32* r<24+off_mod8> := (r<24+off_mod8>@[31:16] << 8) | zfill(16, 32,
-            // r<off_mod8>)
-            if (usedRegs.find(REG_PENT_EAX + off_mod8) != usedRegs.end()) {
-                Assign *a = new Assign(
-                    IntegerType::get(32), Location::regOf(REG_PENT_EAX + off_mod8),
-                    Binary::get(
-                        opBitOr,
-                        Binary::get(opShiftL,
-                                    Ternary::get(opAt, Location::regOf(REG_PENT_EAX + off_mod8),
-                                                 Const::get(31), Const::get(16)),
-                                    Const::get(8)),
-                        Ternary::get(opZfill, Const::get(16), Const::get(32),
-                                     Location::regOf(REG_PENT_AX + off_mod8))));
-                proc->insertStatementAfter(s, a);
+            if (live != liveIn[bb]) {
+                liveIn[bb] = live;
+                change     = true;
             }
+        }
+    }
 
-            break;
+    // Now find the assignments to insert. This is never redone for blocks processed before.
+    std::vector<std::pair<Statement *, OverlappedReg>> toInsert;
+    int numOverlapping = 0;
 
-        case REG_PENT_EBP:
-        case REG_PENT_ESI:
-        case REG_PENT_EDI:
-            //    ebp         esi      edi
-            // Emit *16* r<off_mod8> := trunc(32, 16, r<24+off_mod8>)
-            if (usedRegs.find(REG_PENT_AX + off_mod8) != usedRegs.end()) {
-                Assign *a = new Assign(IntegerType::get(16),
-                                       Location::regOf(REG_PENT_AX + off_mod8),
-                                       Ternary::get(opTruncu, Const::get(32), Const::get(16),
-                                                    Location::regOf(REG_PENT_EAX + off_mod8)));
-                proc->insertStatementAfter(s, a);
+    for (BasicBlock *bb : bbs) {
+        if (isOverlappedRegsProcessed(bb)) {
+            continue;
+        }
+
+        RegSet live                 = getLiveOut(bb);
+        const std::size_t numBefore = toInsert.size();
+
+        BasicBlock::RTLRIterator rrit;
+        RTL::reverse_iterator srit;
+
+        for (Statement *s = bb->getLastStmt(rrit, srit); s; s = bb->getPrevStmt(rrit, srit)) {
+            const int r = getDefinedReg(s);
+            if (r != -1) {
+                numOverlapping += static_cast<int>(overlaps[r].size());
             }
 
-            break;
+            updateLive(s, live, false, &toInsert);
         }
+
+        // The statements were visited backwards; restore the forward order
+        std::reverse(toInsert.begin() + numBefore, toInsert.end());
+    }
+
+    for (const auto &[s, overlap] : toInsert) {
+        proc->insertStatementAfter(s, createOverlappedAssign(getDecoder(), getDefinedReg(s),
+                                                             overlap));
+    }
+
+    Prog::OverlapStats &stats = m_program->getOverlapStats();
+    stats.numInserted += toInsert.size();
+    stats.numPruned += numOverlapping - static_cast<int>(toInsert.size());
+
+    if (numOverlapping > 0) {
+        LOG_VERBOSE("Inserted %1 of %2 assignments to overlapping registers in %3",
+                    static_cast<int>(toInsert.size()), numOverlapping, proc->getName());
     }
 
     // set a flag for every BB we've processed so we don't do them again
-    m_overlappedRegsProcessed.insert(bbs.begin(), bbs.end());
+    for (BasicBlock *bb : bbs) {
+        m_overlappedRegsProcessed.insert(bb);
+    }
 }
 
 
@@ -75,7 +75,10 @@ private:
     void processStringInst(UserProc *proc);
 
     /**
-     * Process for overlapped registers
+     * Process for overlapped registers.
+     * After an assignment to a register (e.g. %eax), assign the registers overlapping it
+     * (e.g. %ax, %al, %ah) as given by the register table, but only where the overlapping
+     * register is live. Blocks are only processed once.
      */
     void processOverlapped(UserProc *proc);
 
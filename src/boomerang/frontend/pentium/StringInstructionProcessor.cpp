@@ -74,7 +74,7 @@ bool StringInstructionProcessor::processStringInstructions()
         assert(skipRTL->size() >= 4); // They vary; at least 5 or 6
 
         Statement *s1 = *skipRTL->begin();
-        Statement *s6 = *(--skipRTL->end());
+        Statement *s6 = skipRTL->back();
         if (s1->isAssign()) {
             skipBranch->setCondExpr(static_cast<Assign *>(s1)->getRight());
         }
@@ -142,11 +142,16 @@ BasicBlock *StringInstructionProcessor::splitForBranch(BasicBlock *bb, RTL *stri
     std::unique_ptr<RTLList> skipBBRTLs(new RTLList);
     std::unique_ptr<RTLList> rptBBRTLs(new RTLList);
     skipBBRTLs->push_back(std::unique_ptr<RTL>(new RTL(stringAddr, { skipBranch })));
-    rptBBRTLs->push_back(std::unique_ptr<RTL>(new RTL(**stringIt)));
-
-    rptBBRTLs->front()->setAddress(stringAddr + 1);
-    rptBBRTLs->front()->pop_front();
-    rptBBRTLs->front()->back() = rptBranch;
+    // The original string instruction is removed below, so take its statements
+    // instead of copying them.
+    rptBBRTLs->push_back(std::unique_ptr<RTL>(new RTL(std::move(**stringIt))));
+
+    RTL *rptRTL = rptBBRTLs->front().get();
+    rptRTL->setAddress(stringAddr + 1);
+    delete rptRTL->front();
+    rptRTL->pop_front();
+    delete rptRTL->back();
+    rptRTL->back() = rptBranch;
 
     // remove the original string instruction from the CFG.
     bb->removeAllPredecessors();
@@ -874,15 +874,6 @@ bool PPCDecoder::decodeInstruction(Address pc, ptrdiff_t delta, DecodeResult &re
                         newCall->setDest(dest);
 
                         result.rtl->append(newCall);
-
-                        Function *destProc = m_prog->getOrCreateFunction(
-                            Address(reladdr.value() - delta));
-
-                        if (destProc == reinterpret_cast<Function *>(-1)) {
-                            destProc = nullptr;
-                        }
-
-                        newCall->setDestProc(destProc);
                     }
                 } /*opt-block*/
                 else {
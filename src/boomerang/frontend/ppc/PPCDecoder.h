@@ -39,6 +39,9 @@ public:
     /// \copydoc NJMCDecoder::decodeInstruction
     virtual bool decodeInstruction(Address pc, ptrdiff_t delta, DecodeResult &result) override;
 
+    /// \copydoc IDecoder::canDecodeConcurrently
+    virtual bool canDecodeConcurrently() const override { return true; }
+
 private:
     Exp *dis_RegImm(Address pc);
 
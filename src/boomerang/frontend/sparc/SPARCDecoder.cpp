@@ -553,17 +553,10 @@ bool SPARCDecoder::decodeInstruction(Address pc, ptrdiff_t delta, DecodeResult &
                  */
 
                 CallStatement *newCall = new CallStatement;
-                // Set the destination
+                // Set the destination. The front end creates the callee.
 
                 Address nativeDest = Address(addr.value() - delta);
                 newCall->setDest(nativeDest);
-                Function *destProc = m_prog->getOrCreateFunction(nativeDest);
-
-                if (destProc == reinterpret_cast<Function *>(-1)) {
-                    destProc = nullptr;
-                }
-
-                newCall->setDestProc(destProc);
                 inst.rtl->append(newCall);
                 inst.type = SD;
                 SHOW_ASM("call__ " << (nativeDest))
@@ -1036,6 +1036,7 @@ bool SPARCFrontEnd::processProc(UserProc *proc, Address pc)
             Function *callee = proc->getProg()->getOrCreateFunction(dest);
             if (callee) {
                 proc->addCallee(callee);
+                queueForDecoding(callee);
             }
         }
     }
@@ -42,6 +42,9 @@ public:
      */
     virtual bool decodeInstruction(Address pc, ptrdiff_t delta, DecodeResult &result) override;
 
+    /// \copydoc IDecoder::canDecodeConcurrently
+    virtual bool canDecodeConcurrently() const override { return true; }
+
 private:
     DWord getDword(intptr_t lc); // TODO: switch back to using ADDRESS objects
     SWord getWord(intptr_t lc);
@@ -35,6 +35,13 @@ public:
      */
     virtual bool decodeInstruction(Address pc, ptrdiff_t delta, DecodeResult &result) = 0;
 
+    /**
+     * \returns true if decodeInstruction does not modify the program or the decoder,
+     * so that multiple instructions may be decoded concurrently from different threads.
+     * Decoders must not create procedures for call destinations; the front end does that.
+     */
+    virtual bool canDecodeConcurrently() const { return false; }
+
     /// \returns machine-specific register name given it's index
     virtual QString getRegName(int idx) const = 0;
 
@@ -46,4 +53,17 @@ public:
 
     /// \returns the size of the register with name \p name, in bits
     int getRegSize(const QString &name) const { return getRegSize(getRegIdx(name)); }
+
+    /**
+     * Get the register that register \p idx is part of, e.g. %ax for %al on x86.
+     * \param offset set to the bit offset of register \p idx in the containing register
+     * \returns the index of the containing register,
+     *          or -1 if register \p idx is not part of another register.
+     */
+    virtual int getRegParent(int idx, int &offset) const
+    {
+        Q_UNUSED(idx);
+        Q_UNUSED(offset);
+        return -1;
+    }
 };
@@ -14,10 +14,22 @@
 #include "boomerang/db/binary/BinaryFile.h"
 #include "boomerang/db/binary/BinaryImage.h"
 
+#include <QByteArray>
+
+#include <vector>
+
 
 class QIODevice;
 
 
+/// Bytes at a fixed position that identify a file format, see IFileLoader::getSignatures
+struct FileSignature
+{
+    int offset;       ///< offset of the signature from the start of the file
+    QByteArray bytes; ///< contents of the file at \ref offset
+};
+
+
 /**
  * Abstract class for loading binary and text files for analysis and decompilation.
  * The derived classes define the actual functionality of loading files and are
@@ -43,6 +55,14 @@ public:
     /// If the file cannot be loaded, this function returns 0.
     virtual int canLoad(QIODevice &data) const = 0;
 
+    /**
+     * \returns the signatures (magic bytes) of the files this loader might be able to load.
+     * canLoad is only called for files matching at least one of the signatures,
+     * so most loaders do not need to look at files of other formats at all.
+     * If no signatures are returned, canLoad is called for all files.
+     */
+    virtual std::vector<FileSignature> getSignatures() const { return {}; }
+
     /// Load the file with path \p path into memory.
     virtual bool loadFromFile(BinaryFile *file)
     {
@@ -52,6 +52,9 @@ enum class PassID
 /**
  * Passes run during the decompilation process
  * and update statements in a UserProc.
+ *
+ * Passes are shared by all projects of the process and might be executed
+ * for different procedures concurrently. They must not keep any state between executions.
  */
 class IPass
 {
@@ -67,6 +70,14 @@ public:
     /// This means that procLocal passes can be executed for each function in parallel.
     virtual bool isProcLocal() const { return false; }
 
+    /// \returns true iff the pass must be executed even if the decompilation budget
+    /// of the function is exhausted, because later passes or code generation rely on it.
+    virtual bool isRequired() const { return false; }
+
+    /// \returns true iff the pass does not change anything the proofs of the function depend on,
+    /// so the results of earlier proofs (see ProofCache) can be reused after executing it.
+    virtual bool keepsProofs() const { return false; }
+
     /// Run this pass, updating \p proc
     /// \returns true iff any change
     virtual bool execute(UserProc *proc) = 0;
@@ -11,7 +11,9 @@
 
 #include "boomerang/core/Project.h"
 #include "boomerang/db/Prog.h"
+#include "boomerang/db/proc/ProofCache.h"
 #include "boomerang/db/proc/UserProc.h"
+#include "boomerang/decomp/DecompilationBudget.h"
 #include "boomerang/passes/call/CallArgumentUpdatePass.h"
 #include "boomerang/passes/call/CallDefineUpdatePass.h"
 #include "boomerang/passes/dataflow/BlockVarRenamePass.h"
@@ -38,6 +40,7 @@
 #include "boomerang/passes/middle/PreservationAnalysisPass.h"
 #include "boomerang/passes/middle/SPPreservationPass.h"
 #include "boomerang/passes/middle/StrengthReductionReversalPass.h"
+#include "boomerang/ssl/type/TypeContext.h"
 #include "boomerang/util/Util.h"
 #include "boomerang/util/log/Log.h"
 
@@ -99,6 +102,8 @@ PassManager *PassManager::get()
 
 bool PassManager::createPassGroup(const QString &name, const std::initializer_list<IPass *> &passes)
 {
+    std::lock_guard<std::mutex> lock(m_passGroupsMutex);
+
     auto it = m_passGroups.find(name);
     if (it != m_passGroups.end()) {
         LOG_WARN("Cannot create pass group with name '%1': "
@@ -121,9 +126,26 @@ bool PassManager::executePass(PassID passID, UserProc *proc)
 bool PassManager::executePass(IPass *pass, UserProc *proc)
 {
     assert(pass != nullptr);
+
+    DecompilationBudget *budget = proc->getProg()->getProject()->getDecompilationBudget();
+    if (!budget->chargePass(proc) && !pass->isRequired()) {
+        LOG_VERBOSE("Skipping pass '%1' for '%2': Decompilation budget exhausted",
+                    pass->getName(), proc->getName());
+        return false;
+    }
+
     LOG_VERBOSE("Executing pass '%1' for '%2'", pass->getName(), proc->getName());
 
+    if (!pass->keepsProofs()) {
+        proc->getProg()->getProofCache()->invalidate(proc);
+    }
+
+    // memoize type meets in the context of the program
+    TypeContext::Scope typeScope(proc->getProg()->getTypeContext());
+
+    budget->beginPass(proc);
     const bool changed = pass->execute(proc);
+    budget->endPass(proc);
 
     QString msg = QString("after executing pass '%1'").arg(pass->getName());
     proc->debugPrintAll(qPrintable(msg));
@@ -135,14 +157,19 @@ bool PassManager::executePass(IPass *pass, UserProc *proc)
 
 bool PassManager::executePassGroup(const QString &name, UserProc *proc)
 {
-    auto it = m_passGroups.find(name);
-    if (it == m_passGroups.end()) {
+    std::unique_lock<std::mutex> lock(m_passGroupsMutex);
+
+    auto it = m_passGroups.constFind(name);
+    if (it == m_passGroups.constEnd()) {
         throw std::invalid_argument(
             QString("Pass group '%1' does not exist").arg(name).toStdString());
     }
 
-    const PassGroup &group = it.value();
-    bool changed           = false;
+    // Do not hold the lock while executing the passes
+    const PassGroup group = it.value();
+    lock.unlock();
+
+    bool changed = false;
 
     LOG_VERBOSE("Executing pass group '%1' for '%2'", name, proc->getName());
     for (IPass *pass : group) {
@@ -17,11 +17,16 @@
 #include <QMap>
 
 #include <memory>
+#include <mutex>
 
 
 class Prog;
 
 
+/**
+ * Owns the passes of the process.
+ * Passes and pass groups can be executed from multiple threads concurrently.
+ */
 class BOOMERANG_API PassManager
 {
 public:
@@ -59,4 +64,5 @@ private:
 private:
     std::vector<std::unique_ptr<IPass>> m_passes;
     QMap<QString, PassGroup> m_passGroups;
+    std::mutex m_passGroupsMutex;
 };
@@ -31,7 +31,7 @@ bool CallArgumentUpdatePass::execute(UserProc *proc)
 
     for (BasicBlock *bb : *proc->getCFG()) {
         BasicBlock::RTLRIterator rrit;
-        StatementList::reverse_iterator srit;
+        RTL::reverse_iterator srit;
         CallStatement *c = dynamic_cast<CallStatement *>(bb->getLastStmt(rrit, srit));
 
         // Note: we may have removed some statements, so there may no longer be a last statement!
@@ -93,7 +93,7 @@ bool CallDefineUpdatePass::updateCallDefines(UserProc *proc, CallStatement *call
     }
     else {
         // Ensure that everything in the UseCollector has an entry in oldDefines
-        LocationSet::iterator ll;
+        UseCollector::iterator ll;
 
         for (ll = callStmt->getUseCollector()->begin(); ll != callStmt->getUseCollector()->end();
              ++ll) {
@@ -11,6 +11,7 @@
 
 #include "boomerang/core/Project.h"
 #include "boomerang/core/Settings.h"
+#include "boomerang/db/DataFlow.h"
 #include "boomerang/db/Prog.h"
 #include "boomerang/db/proc/UserProc.h"
 #include "boomerang/ssl/exp/Const.h"
@@ -18,7 +19,11 @@
 #include "boomerang/ssl/statements/CallStatement.h"
 #include "boomerang/ssl/statements/PhiAssign.h"
 #include "boomerang/ssl/statements/ReturnStatement.h"
-#include "boomerang/util/log/Log.h"
+
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 
 BlockVarRenamePass::BlockVarRenamePass()
@@ -35,25 +40,146 @@ static SharedExp defineAll = Terminal::get(opDefineAll); // An expression repres
 // stacks[defineAll] does not apply for variable x. This is needed to get correct
 // operation of the use collectors in calls.
 
-// Care with the Stacks object (a map from expression to stack);
-// using Stacks[q].empty() can needlessly insert an empty stack
-#define STACKS_EMPTY(q) (stacks.find(q) == stacks.end() || stacks[q].empty())
-
 
-// Subscript dataflow variables
-bool BlockVarRenamePass::renameBlockVars(
-    UserProc *proc, int n, std::map<SharedExp, std::deque<Statement *>, lessExpStar> &stacks)
+/**
+ * The definition stacks of all locations defined so far.
+ *
+ * Each location gets a dense ID when it is defined for the first time, so the stack
+ * of a location is looked up only once per use or definition (by hash), and define-alls can
+ * push onto all stacks without traversing a tree.
+ * All pushes are recorded in an undo log, so leaving a block pops exactly
+ * the definitions that were pushed while renaming the block.
+ */
+class DefStacks
 {
-    if (proc->getCFG()->getNumBBs() == 0) {
-        return false;
+public:
+    typedef int LocID;
+    static constexpr LocID INVALID_ID = -1;
+
+public:
+    /// \returns the ID of \p loc, or INVALID_ID if \p loc has no stack yet.
+    LocID find(const SharedExp &loc) const
+    {
+        auto it = m_ids.find(loc);
+        return it != m_ids.end() ? it->second : INVALID_ID;
+    }
+
+    /// \returns the ID of \p loc. Creates an empty stack for \p loc if necessary.
+    LocID findOrInsert(const SharedExp &loc)
+    {
+        auto it = m_ids.find(loc);
+        if (it != m_ids.end()) {
+            return it->second;
+        }
+
+        // Note: we clone loc because otherwise it could be an expression
+        // that gets modified or deleted through various modifications.
+        const LocID id       = static_cast<LocID>(m_stacks.size());
+        const SharedExp copy = loc->clone();
+        m_ids.emplace(copy, id);
+        m_locs.push_back(copy);
+        m_stacks.emplace_back();
+        return id;
+    }
+
+    /// \returns the latest definition of the location with ID \p id,
+    /// or nullptr if no definition reaches the current block.
+    Statement *getTop(LocID id) const
+    {
+        if (id == INVALID_ID || m_stacks[id].empty()) {
+            return nullptr;
+        }
+
+        return m_stacks[id].back();
+    }
+
+    void push(LocID id, Statement *def)
+    {
+        m_stacks[id].push_back(def);
+        m_undoLog.push_back(id);
+    }
+
+    /// Push \p def onto the stacks of all locations defined so far.
+    void pushAll(Statement *def)
+    {
+        for (LocID id = 0; id < static_cast<LocID>(m_stacks.size()); ++id) {
+            push(id, def);
+        }
+    }
+
+    /// \returns the current position in the undo log, see popTo
+    std::size_t getUndoMark() const { return m_undoLog.size(); }
+
+    /// Pop all definitions pushed after \p mark was retrieved.
+    void popTo(std::size_t mark)
+    {
+        while (m_undoLog.size() > mark) {
+            m_stacks[m_undoLog.back()].pop_back();
+            m_undoLog.pop_back();
+        }
+    }
+
+    /// Get the latest definitions of all locations that have one, sorted by location.
+    void getReachingDefs(std::vector<std::pair<SharedExp, Statement *>> &reachingDefs)
+    {
+        reachingDefs.clear();
+        sortLocations();
+
+        for (LocID id : m_sortedIDs) {
+            if (!m_stacks[id].empty()) {
+                reachingDefs.push_back({ m_locs[id], m_stacks[id].back() });
+            }
+        }
     }
 
+private:
+    /// Add the IDs of all locations created since the last call to m_sortedIDs,
+    /// keeping m_sortedIDs sorted by location.
+    void sortLocations()
+    {
+        const std::size_t numSorted = m_sortedIDs.size();
+        if (numSorted == m_locs.size()) {
+            return;
+        }
+
+        // IDs are dense, so the new locations are the ones with the highest IDs
+        for (std::size_t id = numSorted; id < m_locs.size(); ++id) {
+            m_sortedIDs.push_back(static_cast<LocID>(id));
+        }
+
+        auto byLocation = [this](LocID a, LocID b) {
+            return lessExpStar()(m_locs[a], m_locs[b]);
+        };
+
+        std::sort(m_sortedIDs.begin() + numSorted, m_sortedIDs.end(), byLocation);
+        std::inplace_merge(m_sortedIDs.begin(), m_sortedIDs.begin() + numSorted, m_sortedIDs.end(),
+                           byLocation);
+    }
+
+private:
+    std::unordered_map<SharedExp, LocID, hashExpStar, equalExpStar> m_ids;
+    std::vector<SharedExp> m_locs;                  ///< Locations, indexed by LocID
+    std::vector<std::vector<Statement *>> m_stacks; ///< Definition stacks, indexed by LocID
+    std::vector<LocID> m_undoLog;                   ///< IDs of all pushed stacks, in push order
+    std::vector<LocID> m_sortedIDs;                 ///< IDs of all locations, sorted by location
+};
+
+
+/**
+ * Subscript the uses of all statements in block \p n, push the definitions of block \p n
+ * and subscript the phi operands of the successors of block \p n.
+ * The definitions are popped by the caller after the dominator subtree of \p n
+ * has been renamed.
+ */
+static bool renameBlock(UserProc *proc, int n, DefStacks &stacks,
+                        std::vector<std::pair<SharedExp, Statement *>> &reachingDefs)
+{
     bool changed                   = false;
     const bool assumeABICompliance = proc->getProg()->getProject()->getSettings()->assumeABI;
 
     // For each statement S in block n
     BasicBlock::RTLIterator rit;
-    StatementList::iterator sit;
+    RTL::iterator sit;
     BasicBlock *bb = proc->getDataFlow()->nodeToBB(n);
 
     for (Statement *S = bb->getFirstStmt(rit, sit); S; S = bb->getNextStmt(rit, sit)) {
@@ -113,23 +239,21 @@ bool BlockVarRenamePass::renameBlockVars(
                     continue; // Don't re-rename the renamed variable
                 }
 
-                if (!STACKS_EMPTY(location)) {
-                    def = stacks[location].back();
-                }
-                else if (!STACKS_EMPTY(defineAll)) {
-                    def = stacks[defineAll].back();
+                def = stacks.getTop(stacks.find(location));
+
+                if (!def) {
+                    def = stacks.getTop(stacks.find(defineAll));
                 }
-                else {
+
+                if (!def) {
                     // If the both stacks are empty, use a nullptr definition. This will be changed
                     // into a pointer to an implicit definition at the start of type analysis, but
                     // not until all the m[...] have stopped changing their expressions (complicates
                     // implicit assignments considerably).
-                    def = nullptr;
                     // Update the collector at the start of the UserProc
                     proc->markAsInitialParam(location->clone());
                 }
 
-
                 if (def && def->isCall()) {
                     // Calls have UseCollectors for locations that are used before definition at the
                     // call
@@ -161,7 +285,8 @@ bool BlockVarRenamePass::renameBlockVars(
                 col = static_cast<ReturnStatement *>(S)->getCollector();
             }
 
-            col->updateDefs(stacks, proc);
+            stacks.getReachingDefs(reachingDefs);
+            col->updateDefs(reachingDefs, proc);
         }
 
         // For each definition of some variable a in S
@@ -174,16 +299,7 @@ bool BlockVarRenamePass::renameBlockVars(
 
             if (suitable) {
                 // Push i onto Stacks[a]
-                // Note: we clone a because otherwise it could be an expression
-                // that gets deleted through various modifications.
-                // This is necessary because we do several passes of this algorithm
-                // to sort out the memory expressions.
-                if (stacks.find(a) != stacks.end()) { // expression exists, no need for clone ?
-                    stacks[a].push_back(S);
-                }
-                else {
-                    stacks[a->clone()].push_back(S);
-                }
+                stacks.push(stacks.findOrInsert(a), S);
 
                 // Replace definition of 'a' with definition of a_i in S (we don't do this)
             }
@@ -195,7 +311,7 @@ bool BlockVarRenamePass::renameBlockVars(
 
                 // Stacks already has a definition for a (as just the bare local)
                 if (suitable) {
-                    stacks[a1->clone()].push_back(S);
+                    stacks.push(stacks.findOrInsert(a1->clone()), S);
                 }
             }
         }
@@ -203,14 +319,10 @@ bool BlockVarRenamePass::renameBlockVars(
         // Special processing for define-alls (presently, only childless calls).
         // But note that only 'everythings' at the current memory level are defined!
         if (S->isCall() && static_cast<const CallStatement *>(S)->isChildless() &&
-            !proc->getProg()->getProject()->getSettings()->assumeABI) {
+            !assumeABICompliance) {
             // S is a childless call (and we're not assuming ABI compliance)
-            stacks[defineAll]; // Ensure that there is an entry for defineAll
-
-            for (auto &elem : stacks) {
-                // if (dd->first->isMemDepth(memDepth))
-                elem.second.push_back(S); // Add a definition for all vars
-            }
+            stacks.findOrInsert(defineAll); // Ensure that there is an entry for defineAll
+            stacks.pushAll(S);              // Add a definition for all vars
         }
     }
 
@@ -233,71 +345,64 @@ bool BlockVarRenamePass::renameBlockVars(
                 continue;
             }
 
-            Statement *def = nullptr; // assume No reaching definition
-
-            if (!STACKS_EMPTY(a)) {
-                def = stacks[a].back();
-            }
-
-            // "Replace jth operand with a_i"
-            pa->putAt(bb, def, a);
+            // "Replace jth operand with a_i" (nullptr if there is no reaching definition)
+            pa->putAt(bb, stacks.getTop(stacks.find(a)), a);
         }
     }
 
-    // For each child X of n
-    // Note: linear search!
+    return changed;
+}
+
+
+bool BlockVarRenamePass::execute(UserProc *proc)
+{
     const int numBB = proc->getCFG()->getNumBBs();
+    if (numBB == 0) {
+        return false;
+    }
+
+    const DataFlow *df = proc->getDataFlow();
 
+    // Children of each node in the dominator tree, in ascending order
+    std::vector<std::vector<int>> domChildren(numBB);
     for (int X = 0; X < numBB; X++) {
-        if (proc->getDataFlow()->getIdom(X) == n) { // if 'n' is immediate dominator of X
-            renameBlockVars(proc, X, stacks);
+        const int idom = df->getIdom(X);
+
+        if (idom >= 0 && idom != X) {
+            domChildren[idom].push_back(X);
         }
     }
 
-    // For each statement S in block n
-    // NOTE: Because of the need to pop childless calls from the Stacks, it is important in my
-    // algorithm to process the statments in the BB *backwards*. (It is not important in Appel's
-    // algorithm, since he always pushes a definition for every variable defined on the Stacks).
-    BasicBlock::RTLRIterator rrit;
-    StatementList::reverse_iterator srit;
+    struct Frame
+    {
+        int node;             ///< the block being renamed
+        std::size_t child;    ///< index of the next dominator tree child to rename
+        std::size_t undoMark; ///< undo position before the definitions of the block were pushed
+    };
 
-    for (Statement *S = bb->getLastStmt(rrit, srit); S; S = bb->getPrevStmt(rrit, srit)) {
-        // For each definition of some variable a in S
-        LocationSet defs;
-        S->getDefinitions(defs, assumeABICompliance);
+    DefStacks stacks;
+    std::vector<std::pair<SharedExp, Statement *>> reachingDefs;
+    std::vector<Frame> frames;
 
-        for (const auto &def : defs) {
-            if (!proc->canRename(def)) {
-                continue;
-            }
+    // Rename the dominator tree in pre-order; when all children of a block have been renamed,
+    // pop the definitions of the block.
+    frames.push_back({ 0, 0, stacks.getUndoMark() });
+    bool changed = renameBlock(proc, 0, stacks, reachingDefs);
 
-            // if ((*dd)->getMemDepth() == memDepth)
-            auto ss = stacks.find(def);
+    while (!frames.empty()) {
+        Frame &frame = frames.back();
 
-            if (ss == stacks.end()) {
-                LOG_FATAL("Tried to pop '%1' from Stacks; does not exist", def);
-            }
+        if (frame.child < domChildren[frame.node].size()) {
+            const int child = domChildren[frame.node][frame.child++];
 
-            ss->second.pop_back();
+            frames.push_back({ child, 0, stacks.getUndoMark() });
+            changed |= renameBlock(proc, child, stacks, reachingDefs);
         }
-
-        // Pop all defs due to childless calls
-        if (S->isCall() && static_cast<const CallStatement *>(S)->isChildless()) {
-            for (auto &stack : stacks) {
-                if (!stack.second.empty() && (stack.second.back() == S)) {
-                    stack.second.pop_back();
-                }
-            }
+        else {
+            stacks.popTo(frame.undoMark);
+            frames.pop_back();
         }
     }
 
     return changed;
 }
-
-
-bool BlockVarRenamePass::execute(UserProc *proc)
-{
-    /// The stack which remembers the last definition of an expression.
-    std::map<SharedExp, std::deque<Statement *>, lessExpStar> stacks;
-    return renameBlockVars(proc, 0, stacks);
-}
@@ -11,17 +11,13 @@
 
 
 #include "boomerang/passes/Pass.h"
-#include "boomerang/ssl/exp/ExpHelp.h"
-
-#include <deque>
-#include <map>
-
-
-class Statement;
 
 
 /**
  * Rewrites Statements in BasicBlocks into SSA form.
+ *
+ * The dominator tree is walked with an explicit stack instead of recursion,
+ * so deeply nested dominator trees cannot overflow the native stack.
  */
 class BlockVarRenamePass : public IPass
 {
@@ -29,10 +25,9 @@ public:
     BlockVarRenamePass();
 
 public:
+    /// \copydoc IPass::isRequired
+    bool isRequired() const override { return true; }
+
     /// \copydoc IPass::execute
     bool execute(UserProc *proc) override;
-
-private:
-    bool renameBlockVars(UserProc *proc, int n,
-                         std::map<SharedExp, std::deque<Statement *>, lessExpStar> &stacks);
 };
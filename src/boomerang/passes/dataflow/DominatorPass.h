@@ -22,6 +22,9 @@ public:
     DominatorPass();
 
 public:
+    /// \copydoc IPass::isRequired
+    bool isRequired() const override { return true; }
+
     /// \copydoc IPass::execute
     bool execute(UserProc *proc) override;
 };
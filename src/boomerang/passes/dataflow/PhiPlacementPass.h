@@ -19,6 +19,9 @@ public:
     PhiPlacementPass();
 
 public:
+    /// \copydoc IPass::isRequired
+    bool isRequired() const override { return true; }
+
     /// \copydoc IPass::execute
     bool execute(UserProc *proc) override;
 };
@@ -24,12 +24,9 @@ GlobalConstReplacePass::GlobalConstReplacePass()
 
 bool GlobalConstReplacePass::execute(UserProc *proc)
 {
-    StatementList stmts;
-    proc->getStatements(stmts);
-
     const BinaryImage *image = proc->getProg()->getBinaryFile()->getImage();
 
-    for (Statement *st : stmts) {
+    for (Statement *st : proc->getStatements()) {
         Assign *assgn = dynamic_cast<Assign *>(st);
 
         if (assgn == nullptr) {
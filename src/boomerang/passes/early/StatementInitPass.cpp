@@ -23,7 +23,7 @@ StatementInitPass::StatementInitPass()
 bool StatementInitPass::execute(UserProc *proc)
 {
     BasicBlock::RTLIterator rit;
-    StatementList::iterator sit;
+    RTL::iterator sit;
 
     for (BasicBlock *bb : *proc->getCFG()) {
         for (Statement *stmt = bb->getFirstStmt(rit, sit); stmt != nullptr;
@@ -19,6 +19,9 @@ class StatementInitPass : public IPass
 public:
     StatementInitPass();
 
+    /// \copydoc IPass::isRequired
+    bool isRequired() const override { return true; }
+
 private:
     bool execute(UserProc *proc) override;
 };
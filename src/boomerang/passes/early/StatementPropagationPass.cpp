@@ -28,15 +28,15 @@ StatementPropagationPass::StatementPropagationPass()
 
 bool StatementPropagationPass::execute(UserProc *proc)
 {
-    StatementList stmts;
-    proc->getStatements(stmts);
+    // Propagation may convert indirect calls, which adds implicit assignments
+    const std::vector<Statement *> stmts = proc->getStatements();
 
     // Find the locations that are used by a live, dominating phi-function
     LocationSet usedByDomPhi;
     findLiveAtDomPhi(proc, usedByDomPhi);
 
     // Next pass: count the number of times each assignment LHS would be propagated somewhere
-    std::map<SharedExp, int, lessExpStar> destCounts;
+    ExpDestCounter::ExpCountMap destCounts;
 
     // Also maintain a set of locations which are used by phi statements
     for (Statement *s : stmts) {
@@ -99,13 +99,16 @@ void StatementPropagationPass::findLiveAtDomPhi(UserProc *proc, LocationSet &use
 void StatementPropagationPass::propagateToCollector(UseCollector *collector)
 {
     // TODO propagateToCollector(proc->getUseCollector());
+    bool changed = false;
+
     for (auto it = collector->begin(); it != collector->end();) {
         if (!(*it)->isMemOf()) {
             ++it;
             continue;
         }
 
-        auto addr = (*it)->getSubExp1();
+        bool removed = false;
+        auto addr    = (*it)->getSubExp1();
         LocationSet used;
         addr->addUsedLocs(used);
 
@@ -132,18 +135,24 @@ void StatementPropagationPass::propagateToCollector(UseCollector *collector)
 
             // First check to see if memOfRes is already in the set
             if (collector->exists(memOfRes)) {
-                // Take care not to use an iterator to the newly erased element.
-                /* it = */
-                collector->remove(it++); // Already exists; just remove the old one
-                continue;
+                it      = collector->remove(it); // Already exists; just remove the old one
+                removed = true;
+                break;
             }
             else {
                 LOG_VERBOSE("Propagating %1 to %2 in collector; result %3", r, as->getRight(),
                             memOfRes);
                 (*it)->setSubExp1(res); // Change the child of the memof
+                changed = true;
             }
         }
 
-        ++it;
+        if (!removed) {
+            ++it;
+        }
+    }
+
+    if (changed) {
+        collector->sort(); // The locations were modified in place
     }
 }
@@ -35,7 +35,7 @@ bool BranchAnalysisPass::execute(UserProc *proc)
         // recalculate phi assignments of referencing BBs.
         for (BasicBlock *bb : *proc->getCFG()) {
             BasicBlock::RTLIterator rtlIt;
-            StatementList::iterator stmtIt;
+            RTL::iterator stmtIt;
 
             for (Statement *stmt = bb->getFirstStmt(rtlIt, stmtIt); stmt;
                  stmt            = bb->getNextStmt(rtlIt, stmtIt)) {
@@ -23,6 +23,9 @@ public:
     FromSSAFormPass();
 
 public:
+    /// \copydoc IPass::isRequired
+    bool isRequired() const override { return true; }
+
     bool execute(UserProc *proc) override;
 
 private:
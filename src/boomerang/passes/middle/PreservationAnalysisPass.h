@@ -19,5 +19,9 @@ public:
     PreservationAnalysisPass();
 
 public:
+    /// \copydoc IPass::keepsProofs
+    bool keepsProofs() const override { return true; }
+
+    /// \copydoc IPass::execute
     bool execute(UserProc *proc) override;
 };
@@ -20,5 +20,9 @@ public:
     SPPreservationPass();
 
 public:
+    /// \copydoc IPass::keepsProofs
+    bool keepsProofs() const override { return true; }
+
+    /// \copydoc IPass::execute
     bool execute(UserProc *proc) override;
 };
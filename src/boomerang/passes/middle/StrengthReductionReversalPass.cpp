@@ -26,10 +26,7 @@ StrengthReductionReversalPass::StrengthReductionReversalPass()
 
 bool StrengthReductionReversalPass::execute(UserProc *proc)
 {
-    StatementList stmts;
-    proc->getStatements(stmts);
-
-    for (Statement *s : stmts) {
+    for (Statement *s : proc->getStatements()) {
         if (!s->isAssign()) {
             continue;
         }
@@ -61,10 +58,7 @@ bool StrengthReductionReversalPass::execute(UserProc *proc)
                         static_cast<Assign *>(first)->getRight()->access<Const>()->getInt() == 0) {
                         // ok, fun, now we need to find every reference to p and
                         // replace with x{p} * c
-                        StatementList stmts2;
-                        proc->getStatements(stmts2);
-
-                        for (Statement *stmt2 : stmts2) {
+                        for (Statement *stmt2 : proc->getStatements()) {
                             if (stmt2 != as) {
                                 stmt2->searchAndReplace(
                                     *r, Binary::get(opMult, r->clone(), Const::get(c)));
@@ -9,6 +9,7 @@
 #pragma endregion License
 #include "RTL.h"
 
+#include "boomerang/db/BasicBlock.h"
 #include "boomerang/ssl/exp/Const.h"
 #include "boomerang/ssl/exp/Operator.h"
 #include "boomerang/ssl/statements/Assign.h"
@@ -29,7 +30,7 @@ RTL::RTL(Address instrAddr, const std::list<Statement *> *listStmt /*= nullptr*/
     : m_nativeAddr(instrAddr)
 {
     if (listStmt) {
-        m_stmts = *listStmt;
+        m_stmts.assign(listStmt->begin(), listStmt->end());
     }
 }
 
@@ -67,12 +68,15 @@ RTL &RTL::operator=(const RTL &other)
     clear();
 
     other.deepCopyList(m_stmts);
+    statementsChanged();
     return *this;
 }
 
 
-void RTL::deepCopyList(std::list<Statement *> &dest) const
+void RTL::deepCopyList(StmtList &dest) const
 {
+    dest.reserve(dest.size() + size());
+
     for (const Statement *it : *this) {
         dest.push_back(it->clone());
     }
@@ -89,14 +93,19 @@ void RTL::append(Statement *s)
     }
 
     m_stmts.push_back(s);
+    statementsChanged();
 }
 
 
-void RTL::append(const std::list<Statement *> &stmts)
+void RTL::append(const StmtList &stmts)
 {
+    m_stmts.reserve(m_stmts.size() + stmts.size());
+
     for (Statement *stmt : stmts) {
         m_stmts.push_back(stmt->clone());
     }
+
+    statementsChanged();
 }
 
 
@@ -161,6 +170,7 @@ void RTL::simplify()
                 BasicBlock *bb = (*it)->getBB();
                 *it = new GotoStatement(static_cast<BranchStatement *>(s)->getFixedDest());
                 (*it)->setBB(bb);
+                statementsChanged();
             }
         }
         else if (s->isAssign()) {
@@ -203,7 +213,52 @@ Statement *RTL::getHlStmt() const
 }
 
 
-void RTL::insert(RTL::iterator where, const RTL::value_type &val)
+RTL::iterator RTL::insert(RTL::iterator where, const RTL::value_type &val)
+{
+    statementsChanged();
+    return m_stmts.insert(where, val);
+}
+
+
+void RTL::pop_front()
+{
+    assert(!empty());
+    m_stmts.erase(m_stmts.begin());
+    statementsChanged();
+}
+
+
+void RTL::pop_back()
+{
+    m_stmts.pop_back();
+    statementsChanged();
+}
+
+
+void RTL::push_front(const value_type &val)
+{
+    m_stmts.insert(m_stmts.begin(), val);
+    statementsChanged();
+}
+
+
+void RTL::clear()
+{
+    m_stmts.clear();
+    statementsChanged();
+}
+
+
+RTL::iterator RTL::erase(RTL::iterator it)
 {
-    m_stmts.insert(where, val);
+    statementsChanged();
+    return m_stmts.erase(it);
+}
+
+
+void RTL::statementsChanged()
+{
+    if (m_bb) {
+        m_bb->statementsChanged();
+    }
 }
@@ -11,11 +11,14 @@
 
 
 #include "boomerang/util/Address.h"
+#include "boomerang/util/SmallVector.h"
+#include "boomerang/util/Types.h"
 
 #include <list>
 #include <memory>
 
 
+class BasicBlock;
 class Statement;
 class OStream;
 
@@ -28,9 +31,10 @@ class OStream;
  */
 class BOOMERANG_API RTL
 {
-    typedef std::list<Statement *> StmtList;
-
 public:
+    /// Most RTLs contain only 1 to 4 statements, so store them without heap allocation.
+    typedef SmallVector<Statement *, 4> StmtList;
+
     typedef StmtList::size_type size_type;
     typedef StmtList::value_type value_type;
     typedef StmtList::reference reference;
@@ -73,10 +77,10 @@ public:
     void append(Statement *s);
 
     /// Append a deep copy of \p le to this RTL.
-    void append(const std::list<Statement *> &le);
+    void append(const StmtList &le);
 
     /// Deep copy the elements of this RTL into the given list.
-    void deepCopyList(std::list<Statement *> &dest) const;
+    void deepCopyList(StmtList &dest) const;
 
     /**
      * Prints this object to a stream in text form.
@@ -98,9 +102,22 @@ public:
     /// unnecessary statements (like branches with constant conditions)
     void simplify();
 
-    const std::list<Statement *> &getStatements() const { return m_stmts; }
+    const StmtList &getStatements() const { return m_stmts; }
+
+    /// \returns the basic block containing this RTL, or nullptr if the RTL is not part of a BB.
+    BasicBlock *getBB() const { return m_bb; }
+
+    /// Set the basic block containing this RTL. Called by BasicBlock when it takes the RTL.
+    void setBB(BasicBlock *bb) { m_bb = bb; }
+
+    /**
+     * Invalidate the cached statements of the procedure containing this RTL.
+     * Must be called when statements of this RTL are replaced via iterators or references.
+     * \sa UserProc::getStatements
+     */
+    void statementsChanged();
 
-    // delegates to std::list
+    // delegates to StmtList
 public:
     bool empty() const { return m_stmts.empty(); }
 
@@ -121,19 +138,23 @@ public:
     const_reverse_iterator rbegin() const { return m_stmts.rbegin(); }
     const_reverse_iterator rend() const { return m_stmts.rend(); }
 
-    void pop_front() { m_stmts.pop_front(); }
-    void pop_back() { m_stmts.pop_back(); }
+    void pop_front();
+    void pop_back();
 
-    void push_front(const value_type &val) { m_stmts.push_front(val); }
+    void push_front(const value_type &val);
 
-    void insert(iterator where, const value_type &val);
-    void clear() { m_stmts.clear(); }
+    /// Insert \p val before \p where.
+    /// \note Unlike std::list, this invalidates all iterators into this RTL.
+    /// \returns an iterator to the inserted statement.
+    iterator insert(iterator where, const value_type &val);
+    void clear();
 
-    iterator erase(iterator it) { return m_stmts.erase(it); }
+    iterator erase(iterator it);
 
 private:
-    std::list<Statement *> m_stmts;
-    Address m_nativeAddr; ///< RTL's source program instruction address
+    StmtList m_stmts;
+    Address m_nativeAddr;     ///< RTL's source program instruction address
+    BasicBlock *m_bb = nullptr; ///< The BB containing this RTL
 };
 
 using SharedRTL = std::shared_ptr<RTL>;
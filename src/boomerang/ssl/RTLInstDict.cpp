@@ -91,7 +91,7 @@ void RTLInstDict::addRegister(const QString &name, int id, int size, bool flt)
 }
 
 
-void RTLInstDict::print(OStream &os /*= std::cout*/)
+void RTLInstDict::print(OStream &os /*= std::cout*/) const
 {
     for (auto &elem : m_instructions) {
         // print the instruction name
@@ -108,7 +108,7 @@ void RTLInstDict::print(OStream &os /*= std::cout*/)
         os << "\n";
 
         // print the RTL
-        RTL &rtlist = (elem).second.m_rtl;
+        const RTL &rtlist = (elem).second.m_rtl;
         rtlist.print(os);
         os << "\n";
     }
@@ -131,7 +131,7 @@ std::pair<QString, int> RTLInstDict::getSignature(const QString &instructionName
 
 
 std::unique_ptr<RTL> RTLInstDict::instantiateRTL(const QString &name, Address natPC,
-                                                 const std::vector<SharedExp> &actuals)
+                                                 const std::vector<SharedExp> &actuals) const
 {
     // TODO try to retrieve fast instruction mappings
     // before trying the verbose instructions
@@ -140,7 +140,7 @@ std::unique_ptr<RTL> RTLInstDict::instantiateRTL(const QString &name, Address na
         return nullptr; // instruction not found
     }
 
-    TableEntry &entry(dict_entry->second);
+    const TableEntry &entry(dict_entry->second);
     std::unique_ptr<RTL> rtl = instantiateRTL(entry.m_rtl, natPC, entry.m_params, actuals);
     if (rtl) {
         return rtl;
@@ -180,9 +180,28 @@ int RTLInstDict::getRegSizeByID(int regID) const
 }
 
 
-std::unique_ptr<RTL> RTLInstDict::instantiateRTL(RTL &existingRTL, Address natPC,
-                                                 std::list<QString> &params,
-                                                 const std::vector<SharedExp> &actuals)
+int RTLInstDict::getRegParentByID(int regID, int &offset) const
+{
+    const auto iter = m_regInfo.find(regID);
+    if (iter == m_regInfo.end() || iter->second.getMappedIndex() == -1) {
+        return -1;
+    }
+
+    // COVERS registers are mapped to the first of the smaller registers they consist of,
+    // SHARES registers are mapped to the larger register containing them.
+    const auto parent = m_regInfo.find(iter->second.getMappedIndex());
+    if (parent == m_regInfo.end() || parent->second.getSize() <= iter->second.getSize()) {
+        return -1;
+    }
+
+    offset = iter->second.getMappedOffset();
+    return parent->first;
+}
+
+
+std::unique_ptr<RTL> RTLInstDict::instantiateRTL(const RTL &existingRTL, Address natPC,
+                                                 const std::list<QString> &params,
+                                                 const std::vector<SharedExp> &actuals) const
 {
     if (params.size() != actuals.size()) {
         return nullptr;
@@ -192,18 +211,19 @@ std::unique_ptr<RTL> RTLInstDict::instantiateRTL(RTL &existingRTL, Address natPC
     std::unique_ptr<RTL> newList(new RTL(existingRTL));
     newList->setAddress(natPC);
 
+    // Construct the formals to search for only once for all statements
+    std::vector<Location> formals;
+    formals.reserve(params.size());
+
+    for (const QString &param : params) {
+        formals.emplace_back(opParam, Const::get(param), nullptr);
+    }
+
     // Iterate through each Statement of the new list of stmts
     for (Statement *ss : *newList) {
         // Search for the formals and replace them with the actuals
-        auto param                                    = params.begin();
-        std::vector<SharedExp>::const_iterator actual = actuals.begin();
-
-        for (; param != params.end(); ++param, ++actual) {
-            /* Simple parameter - just construct the formal to search for */
-            Location formal(opParam, Const::get(*param),
-                            nullptr); // Location::param(param->c_str());
-            ss->searchAndReplace(formal, *actual);
-            // delete formal;
+        for (std::size_t i = 0; i < formals.size(); ++i) {
+            ss->searchAndReplace(formals[i], actuals[i]);
         }
 
         ss->fixSuccessor();
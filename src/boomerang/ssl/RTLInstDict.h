@@ -38,6 +38,7 @@ using SharedExp = std::shared_ptr<Exp>;
 class BOOMERANG_API RTLInstDict
 {
     friend class SSLParser;
+    friend class RTLInstDictCache;
 
 public:
     RTLInstDict(bool verboseOutput = false);
@@ -71,7 +72,7 @@ public:
      * \param actuals the actual values of the instruction parameters
      */
     std::unique_ptr<RTL> instantiateRTL(const QString &name, Address pc,
-                                        const std::vector<SharedExp> &actuals);
+                                        const std::vector<SharedExp> &actuals) const;
 
     /// Get the name of the register by its index.
     /// Returns the empty string when \p regID == -1 or the register was not found.
@@ -85,6 +86,17 @@ public:
     /// Returns 32 (the default register size) if the register was not found.
     int getRegSizeByID(int regID) const;
 
+    /**
+     * Get the register that shares its bits with the register \p regID
+     * (declared with SHARES in the SSL file), e.g. %ax for %al.
+     * \param offset set to the bit offset of \p regID in the containing register
+     * \returns the index of the containing register, or -1 if there is none.
+     */
+    int getRegParentByID(int regID, int &offset) const;
+
+    /// Print a textual representation of the dictionary.
+    void print(OStream &os) const;
+
 private:
     /// Reset the object to "undo" a readSSLFile()
     void reset();
@@ -99,8 +111,9 @@ private:
      * \param   actuals the actual parameter values
      * \returns the instantiated list of Exps
      */
-    std::unique_ptr<RTL> instantiateRTL(RTL &rtls, Address pc, std::list<QString> &params,
-                                        const std::vector<SharedExp> &actuals);
+    std::unique_ptr<RTL> instantiateRTL(const RTL &rtls, Address pc,
+                                        const std::list<QString> &params,
+                                        const std::vector<SharedExp> &actuals) const;
 
     /**
      * Appends one RTL to the dictionary, or adds it to idict if an
@@ -113,9 +126,6 @@ private:
      */
     int insert(const QString &name, std::list<QString> &parameters, const RTL &rtl);
 
-    /// Print a textual representation of the dictionary.
-    void print(OStream &os);
-
     /**
      * Add a new register definition to the dictionary
      * \param name register's name
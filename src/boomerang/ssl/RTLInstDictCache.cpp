@@ -0,0 +1,571 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "RTLInstDictCache.h"
+
+#include "boomerang/ssl/RTL.h"
+#include "boomerang/ssl/RTLInstDict.h"
+#include "boomerang/ssl/exp/Binary.h"
+#include "boomerang/ssl/exp/Const.h"
+#include "boomerang/ssl/exp/FlagDef.h"
+#include "boomerang/ssl/exp/Location.h"
+#include "boomerang/ssl/exp/RefExp.h"
+#include "boomerang/ssl/exp/Terminal.h"
+#include "boomerang/ssl/exp/Ternary.h"
+#include "boomerang/ssl/exp/TypedExp.h"
+#include "boomerang/ssl/statements/Assign.h"
+#include "boomerang/ssl/type/BooleanType.h"
+#include "boomerang/ssl/type/CharType.h"
+#include "boomerang/ssl/type/FloatType.h"
+#include "boomerang/ssl/type/IntegerType.h"
+#include "boomerang/ssl/type/SizeType.h"
+#include "boomerang/ssl/type/VoidType.h"
+#include "boomerang/util/log/Log.h"
+
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+
+#include <map>
+#include <mutex>
+
+
+/// Increment when the layout of cache files changes.
+static const quint32 CACHE_FORMAT_VERSION = 1;
+static const quint32 CACHE_MAGIC          = 0x42535343; // "BSSC"
+
+
+/// Dictionaries in use by this process, by SSL file path and verbosity.
+static std::map<std::pair<QString, bool>, std::weak_ptr<const RTLInstDict>> g_dicts;
+static std::mutex g_dictsMutex;
+
+
+/// Kind of serialized expression
+enum class ExpKind : quint8
+{
+    Null,
+    Const,
+    Terminal,
+    Unary,
+    Binary,
+    Ternary,
+    Location,
+    TypedExp,
+    FlagDef
+};
+
+
+static bool writeRTL(QDataStream &os, const RTL &rtl);
+static std::unique_ptr<RTL> readRTL(QDataStream &is);
+
+
+static bool writeType(QDataStream &os, const SharedConstType &ty)
+{
+    if (!ty) {
+        os << static_cast<qint8>(-1);
+        return true;
+    }
+
+    os << static_cast<qint8>(ty->getId());
+
+    switch (ty->getId()) {
+    case TypeClass::Void:
+    case TypeClass::Boolean:
+    case TypeClass::Char: return true;
+
+    case TypeClass::Integer:
+        os << static_cast<quint32>(ty->getSize())
+           << static_cast<qint8>(ty->as<IntegerType>()->getSign());
+        return true;
+
+    case TypeClass::Float:
+    case TypeClass::Size: os << static_cast<quint32>(ty->getSize()); return true;
+
+    default:
+        // Types of other kinds do not occur in SSL files
+        return false;
+    }
+}
+
+
+static SharedType readType(QDataStream &is, bool &ok)
+{
+    qint8 id = 0;
+    is >> id;
+
+    if (id == -1) {
+        return nullptr;
+    }
+
+    quint32 size = 0;
+    qint8 sign   = 0;
+
+    switch (static_cast<TypeClass>(id)) {
+    case TypeClass::Void: return VoidType::get();
+    case TypeClass::Boolean: return BooleanType::get();
+    case TypeClass::Char: return CharType::get();
+
+    case TypeClass::Integer:
+        is >> size >> sign;
+        return IntegerType::get(size, static_cast<Sign>(sign));
+
+    case TypeClass::Float: is >> size; return FloatType::get(static_cast<int>(size));
+    case TypeClass::Size: is >> size; return SizeType::get(size);
+
+    default: ok = false; return nullptr;
+    }
+}
+
+
+static bool writeExp(QDataStream &os, const SharedConstExp &exp)
+{
+    if (!exp) {
+        os << static_cast<quint8>(ExpKind::Null);
+        return true;
+    }
+
+    if (std::dynamic_pointer_cast<const RefExp>(exp)) {
+        return false; // SSA form does not occur in SSL files
+    }
+    else if (auto flagDef = std::dynamic_pointer_cast<const FlagDef>(exp)) {
+        os << static_cast<quint8>(ExpKind::FlagDef) << static_cast<qint32>(exp->getOper());
+        return writeExp(os, exp->getSubExp1()) && writeRTL(os, *flagDef->getRTL());
+    }
+    else if (auto loc = std::dynamic_pointer_cast<const Location>(exp)) {
+        if (loc->getProc() != nullptr) {
+            return false;
+        }
+
+        os << static_cast<quint8>(ExpKind::Location) << static_cast<qint32>(exp->getOper());
+        return writeExp(os, exp->getSubExp1());
+    }
+    else if (auto typedExp = std::dynamic_pointer_cast<const TypedExp>(exp)) {
+        os << static_cast<quint8>(ExpKind::TypedExp) << static_cast<qint32>(exp->getOper());
+        return writeType(os, typedExp->getType()) && writeExp(os, exp->getSubExp1());
+    }
+    else if (std::dynamic_pointer_cast<const Ternary>(exp)) {
+        os << static_cast<quint8>(ExpKind::Ternary) << static_cast<qint32>(exp->getOper());
+        return writeExp(os, exp->getSubExp1()) && writeExp(os, exp->getSubExp2()) &&
+               writeExp(os, exp->getSubExp3());
+    }
+    else if (std::dynamic_pointer_cast<const Binary>(exp)) {
+        os << static_cast<quint8>(ExpKind::Binary) << static_cast<qint32>(exp->getOper());
+        return writeExp(os, exp->getSubExp1()) && writeExp(os, exp->getSubExp2());
+    }
+    else if (std::dynamic_pointer_cast<const Unary>(exp)) {
+        os << static_cast<quint8>(ExpKind::Unary) << static_cast<qint32>(exp->getOper());
+        return writeExp(os, exp->getSubExp1());
+    }
+    else if (auto c = std::dynamic_pointer_cast<const Const>(exp)) {
+        os << static_cast<quint8>(ExpKind::Const) << static_cast<qint32>(exp->getOper());
+
+        switch (exp->getOper()) {
+        case opStrConst: os << c->getStr(); break;
+        case opFuncConst: return false;
+        default:
+            // integer, address and floating point constants share the same 64 bits
+            os << static_cast<quint64>(c->getLong());
+            break;
+        }
+
+        return writeType(os, c->getType());
+    }
+    else if (std::dynamic_pointer_cast<const Terminal>(exp)) {
+        os << static_cast<quint8>(ExpKind::Terminal) << static_cast<qint32>(exp->getOper());
+        return true;
+    }
+
+    return false;
+}
+
+
+static SharedExp readExp(QDataStream &is, bool &ok)
+{
+    quint8 kind = 0;
+    qint32 op   = 0;
+    is >> kind;
+
+    if (kind == static_cast<quint8>(ExpKind::Null)) {
+        return nullptr;
+    }
+
+    is >> op;
+
+    if (!ok || is.status() != QDataStream::Ok || op < 0 || op >= static_cast<qint32>(opNumOf)) {
+        ok = false;
+        return nullptr;
+    }
+
+    const OPER oper = static_cast<OPER>(op);
+
+    switch (static_cast<ExpKind>(kind)) {
+    case ExpKind::Const: {
+        std::shared_ptr<Const> c;
+
+        if (oper == opStrConst) {
+            QString str;
+            is >> str;
+            c = Const::get(str);
+        }
+        else {
+            quint64 value = 0;
+            is >> value;
+            c = Const::get(static_cast<QWord>(value));
+            c->setOper(oper);
+        }
+
+        c->setType(readType(is, ok));
+        return c;
+    }
+
+    case ExpKind::Terminal: return Terminal::get(oper);
+
+    case ExpKind::Unary: {
+        SharedExp e1 = readExp(is, ok);
+        return ok ? Unary::get(oper, e1) : nullptr;
+    }
+
+    case ExpKind::Binary: {
+        SharedExp e1 = readExp(is, ok);
+        SharedExp e2 = readExp(is, ok);
+        return ok ? Binary::get(oper, e1, e2) : nullptr;
+    }
+
+    case ExpKind::Ternary: {
+        SharedExp e1 = readExp(is, ok);
+        SharedExp e2 = readExp(is, ok);
+        SharedExp e3 = readExp(is, ok);
+        return ok ? Ternary::get(oper, e1, e2, e3) : nullptr;
+    }
+
+    case ExpKind::Location: {
+        SharedExp e1 = readExp(is, ok);
+        return ok ? Location::get(oper, e1, nullptr) : nullptr;
+    }
+
+    case ExpKind::TypedExp: {
+        SharedType ty = readType(is, ok);
+        SharedExp e1  = readExp(is, ok);
+        return ok ? std::make_shared<TypedExp>(ty, e1) : nullptr;
+    }
+
+    case ExpKind::FlagDef: {
+        SharedExp params = readExp(is, ok);
+        std::shared_ptr<RTL> rtl(readRTL(is));
+        if (!rtl) {
+            ok = false;
+        }
+
+        return ok ? std::make_shared<FlagDef>(params, rtl) : nullptr;
+    }
+
+    default: ok = false; return nullptr;
+    }
+}
+
+
+static bool writeRTL(QDataStream &os, const RTL &rtl)
+{
+    os << static_cast<quint64>(rtl.getAddress().value()) << static_cast<quint32>(rtl.size());
+
+    for (const Statement *stmt : rtl) {
+        // SSL files only contain assignments
+        if (!stmt->isAssign()) {
+            return false;
+        }
+
+        const Assign *asgn = static_cast<const Assign *>(stmt);
+        if (!writeType(os, asgn->getType()) || !writeExp(os, asgn->getLeft()) ||
+            !writeExp(os, asgn->getRight()) || !writeExp(os, asgn->getGuard())) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+static std::unique_ptr<RTL> readRTL(QDataStream &is)
+{
+    quint64 addr     = 0;
+    quint32 numStmts = 0;
+    is >> addr >> numStmts;
+
+    std::unique_ptr<RTL> rtl(new RTL(Address(static_cast<Address::value_type>(addr))));
+    bool ok = true;
+
+    for (quint32 i = 0; i < numStmts && ok && is.status() == QDataStream::Ok; ++i) {
+        SharedType ty   = readType(is, ok);
+        SharedExp lhs   = readExp(is, ok);
+        SharedExp rhs   = readExp(is, ok);
+        SharedExp guard = readExp(is, ok);
+
+        if (ok) {
+            rtl->append(new Assign(ty, lhs, rhs, guard));
+        }
+    }
+
+    if (!ok || is.status() != QDataStream::Ok) {
+        return nullptr;
+    }
+
+    return rtl;
+}
+
+
+static void writeRegister(QDataStream &os, const Register &reg)
+{
+    os << reg.getName() << reg.getSize() << reg.isFloat()
+       << static_cast<qint32>(reg.getMappedIndex()) << static_cast<qint32>(reg.getMappedOffset());
+}
+
+
+static Register readRegister(QDataStream &is)
+{
+    QString name;
+    quint16 size       = 0;
+    bool isFloat       = false;
+    qint32 mappedIndex = 0, mappedOffset = 0;
+    is >> name >> size >> isFloat >> mappedIndex >> mappedOffset;
+
+    Register reg(name, size, isFloat);
+    reg.setMappedIndex(mappedIndex);
+    reg.setMappedOffset(mappedOffset);
+    return reg;
+}
+
+
+static void writeStringSet(QDataStream &os, const std::set<QString> &strings)
+{
+    os << static_cast<quint32>(strings.size());
+    for (const QString &str : strings) {
+        os << str;
+    }
+}
+
+
+static bool readStringSet(QDataStream &is, std::set<QString> &strings)
+{
+    quint32 count = 0;
+    is >> count;
+
+    for (quint32 i = 0; i < count && is.status() == QDataStream::Ok; ++i) {
+        QString str;
+        is >> str;
+        strings.insert(str);
+    }
+
+    return is.status() == QDataStream::Ok;
+}
+
+
+std::shared_ptr<const RTLInstDict> RTLInstDictCache::getDictionary(const QString &sslFilePath,
+                                                                   bool verboseOutput,
+                                                                   const QString &cacheDir)
+{
+    const QString canonicalPath = QFileInfo(sslFilePath).absoluteFilePath();
+    const auto key              = std::make_pair(canonicalPath, verboseOutput);
+
+    std::lock_guard<std::mutex> lock(g_dictsMutex);
+
+    auto it = g_dicts.find(key);
+    if (it != g_dicts.end()) {
+        if (std::shared_ptr<const RTLInstDict> dict = it->second.lock()) {
+            return dict;
+        }
+    }
+
+    std::shared_ptr<RTLInstDict> dict = std::make_shared<RTLInstDict>(verboseOutput);
+    const QByteArray sslHash          = cacheDir.isEmpty() ? QByteArray()
+                                                           : hashSSLFile(canonicalPath);
+
+    QString cacheFilePath;
+    if (!sslHash.isEmpty()) {
+        cacheFilePath = QDir(cacheDir).absoluteFilePath(
+            QString("%1-%2.sslcache")
+                .arg(QFileInfo(canonicalPath).completeBaseName())
+                .arg(QString::fromLatin1(sslHash.toHex().left(16))));
+    }
+
+    if (cacheFilePath.isEmpty() || !readCacheFile(*dict, cacheFilePath, sslHash)) {
+        if (!dict->readSSLFile(canonicalPath)) {
+            return nullptr;
+        }
+
+        if (!cacheFilePath.isEmpty() && QDir().mkpath(cacheDir) &&
+            !writeCacheFile(*dict, cacheFilePath, sslHash)) {
+            LOG_VERBOSE("Could not write SSL cache file '%1'", cacheFilePath);
+        }
+    }
+
+    g_dicts[key] = dict;
+    return dict;
+}
+
+
+QByteArray RTLInstDictCache::hashSSLFile(const QString &sslFilePath)
+{
+    QFile file(sslFilePath);
+    if (!file.open(QFile::ReadOnly)) {
+        return QByteArray();
+    }
+
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    if (!hash.addData(&file)) {
+        return QByteArray();
+    }
+
+    return hash.result();
+}
+
+
+bool RTLInstDictCache::writeCacheFile(const RTLInstDict &dict, const QString &cacheFilePath,
+                                      const QByteArray &sslHash)
+{
+    // Write to a temporary file first, so concurrent readers never see a partial cache file
+    QSaveFile file(cacheFilePath);
+    if (!file.open(QFile::WriteOnly)) {
+        return false;
+    }
+
+    QDataStream os(&file);
+    os.setVersion(QDataStream::Qt_5_0);
+
+    os << CACHE_MAGIC << CACHE_FORMAT_VERSION << QString(BOOMERANG_VERSION)
+       << static_cast<qint32>(opNumOf) << sslHash;
+
+    os << static_cast<qint8>(dict.m_endianness);
+
+    os << static_cast<quint32>(dict.m_regIDs.size());
+    for (auto &[name, id] : dict.m_regIDs) {
+        os << name << static_cast<qint32>(id);
+    }
+
+    os << static_cast<quint32>(dict.m_regInfo.size());
+    for (auto &[id, reg] : dict.m_regInfo) {
+        os << static_cast<qint32>(id);
+        writeRegister(os, reg);
+    }
+
+    os << static_cast<quint32>(dict.m_specialRegInfo.size());
+    for (auto &[name, reg] : dict.m_specialRegInfo) {
+        os << name;
+        writeRegister(os, reg);
+    }
+
+    writeStringSet(os, dict.m_definedParams);
+    writeStringSet(os, dict.m_flagFuncs);
+
+    os << static_cast<quint32>(dict.m_instructions.size());
+    for (auto &[name, entry] : dict.m_instructions) {
+        os << name << static_cast<quint32>(entry.m_params.size());
+
+        for (const QString &param : entry.m_params) {
+            os << param;
+        }
+
+        if (!writeRTL(os, entry.m_rtl)) {
+            file.cancelWriting();
+            return false;
+        }
+    }
+
+    return os.status() == QDataStream::Ok && file.commit();
+}
+
+
+bool RTLInstDictCache::readCacheFile(RTLInstDict &dict, const QString &cacheFilePath,
+                                     const QByteArray &sslHash)
+{
+    QFile file(cacheFilePath);
+    if (!file.open(QFile::ReadOnly)) {
+        return false;
+    }
+
+    QDataStream is(&file);
+    is.setVersion(QDataStream::Qt_5_0);
+
+    quint32 magic = 0, formatVersion = 0;
+    QString boomerangVersion;
+    qint32 numOpers = 0;
+    QByteArray fileHash;
+
+    is >> magic >> formatVersion >> boomerangVersion >> numOpers >> fileHash;
+
+    if (is.status() != QDataStream::Ok || magic != CACHE_MAGIC ||
+        formatVersion != CACHE_FORMAT_VERSION || boomerangVersion != BOOMERANG_VERSION ||
+        numOpers != static_cast<qint32>(opNumOf) || fileHash != sslHash) {
+        return false;
+    }
+
+    dict.reset();
+
+    qint8 endianness = 0;
+    is >> endianness;
+    dict.m_endianness = static_cast<Endian>(endianness);
+
+    quint32 count = 0;
+    is >> count;
+    for (quint32 i = 0; i < count && is.status() == QDataStream::Ok; ++i) {
+        QString name;
+        qint32 id = 0;
+        is >> name >> id;
+        dict.m_regIDs[name] = id;
+    }
+
+    is >> count;
+    for (quint32 i = 0; i < count && is.status() == QDataStream::Ok; ++i) {
+        qint32 id = 0;
+        is >> id;
+        dict.m_regInfo.insert({ id, readRegister(is) });
+    }
+
+    is >> count;
+    for (quint32 i = 0; i < count && is.status() == QDataStream::Ok; ++i) {
+        QString name;
+        is >> name;
+        dict.m_specialRegInfo.insert({ name, readRegister(is) });
+    }
+
+    bool ok = readStringSet(is, dict.m_definedParams) && readStringSet(is, dict.m_flagFuncs);
+
+    is >> count;
+    for (quint32 i = 0; i < count && ok && is.status() == QDataStream::Ok; ++i) {
+        QString name;
+        quint32 numParams = 0;
+        is >> name >> numParams;
+
+        TableEntry entry;
+        for (quint32 j = 0; j < numParams && is.status() == QDataStream::Ok; ++j) {
+            QString param;
+            is >> param;
+            entry.m_params.push_back(param);
+        }
+
+        std::unique_ptr<RTL> rtl = readRTL(is);
+        if (!rtl) {
+            ok = false;
+            break;
+        }
+
+        entry.m_rtl = std::move(*rtl);
+        dict.m_instructions.emplace(name, std::move(entry));
+    }
+
+    if (!ok || is.status() != QDataStream::Ok) {
+        LOG_WARN("SSL cache file '%1' is corrupt, ignoring", cacheFilePath);
+        dict.reset();
+        return false;
+    }
+
+    return true;
+}
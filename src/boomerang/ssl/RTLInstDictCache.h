@@ -0,0 +1,68 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include "boomerang/core/BoomerangAPI.h"
+
+#include <QByteArray>
+#include <QString>
+
+#include <memory>
+
+
+class RTLInstDict;
+
+
+/**
+ * Avoids parsing SSL files over and over again.
+ *
+ * Within a process, all users of the same SSL file share a single immutable RTLInstDict.
+ * Across processes, parsed dictionaries are stored in binary cache files in a cache directory.
+ * Cache files are keyed by the hash of the SSL file contents, so a modified SSL file is parsed
+ * again. Cache files written by a different version of Boomerang are ignored.
+ */
+class BOOMERANG_API RTLInstDictCache
+{
+public:
+    /**
+     * \returns the dictionary for the SSL file at \p sslFilePath, or nullptr if the file
+     * cannot be read. The dictionary is loaded from the cache file in \p cacheDir if possible,
+     * otherwise the SSL file is parsed and the cache file is (re-)created.
+     *
+     * \param sslFilePath   path to the SSL file
+     * \param verboseOutput see RTLInstDict::RTLInstDict
+     * \param cacheDir      directory of the cache files. If empty, no cache files are used.
+     */
+    static std::shared_ptr<const RTLInstDict> getDictionary(const QString &sslFilePath,
+                                                            bool verboseOutput,
+                                                            const QString &cacheDir);
+
+    /// \returns the hash of the contents of the SSL file at \p sslFilePath,
+    /// or an empty array if the file cannot be read.
+    static QByteArray hashSSLFile(const QString &sslFilePath);
+
+    /**
+     * Write \p dict to the cache file \p cacheFilePath.
+     * \param sslHash hash of the SSL file \p dict was parsed from (see hashSSLFile).
+     * \returns true on success. Dictionaries containing expressions that cannot be
+     * serialized are not written.
+     */
+    static bool writeCacheFile(const RTLInstDict &dict, const QString &cacheFilePath,
+                               const QByteArray &sslHash);
+
+    /**
+     * Fill \p dict from the cache file \p cacheFilePath.
+     * \returns false if the file does not exist, is corrupt, was written by a different
+     * version of Boomerang or does not match \p sslHash. \p dict is left empty in this case.
+     */
+    static bool readCacheFile(RTLInstDict &dict, const QString &cacheFilePath,
+                              const QByteArray &sslHash);
+};
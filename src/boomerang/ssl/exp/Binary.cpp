@@ -157,6 +157,13 @@ bool Binary::operator*=(const Exp &o) const
 }
 
 
+std::size_t Binary::hash() const
+{
+    assert(subExp1 && subExp2);
+    return hashCombine(Unary::hash(), subExp2->hash());
+}
+
+
 void Binary::doSearchChildren(const Exp &pattern, std::list<SharedExp *> &li, bool once)
 {
     assert(subExp1 && subExp2);
@@ -46,6 +46,9 @@ public:
     /// \copydoc Unary::operator*=
     bool operator*=(const Exp &o) const override;
 
+    /// \copydoc Unary::hash
+    std::size_t hash() const override;
+
     /// \copydoc Unary::getArity
     int getArity() const override { return 2; }
 
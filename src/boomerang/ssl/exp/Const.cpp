@@ -20,6 +20,10 @@
 #include "boomerang/visitor/expmodifier/ExpModifier.h"
 #include "boomerang/visitor/expvisitor/ExpVisitor.h"
 
+#include <QHash>
+
+#include <functional>
+
 
 Const::Const(uint32_t i)
     : Exp(opIntConst)
@@ -119,6 +123,20 @@ bool Const::operator*=(const Exp &o) const
 }
 
 
+std::size_t Const::hash() const
+{
+    const std::size_t operHash = static_cast<std::size_t>(m_oper);
+
+    switch (m_oper) {
+    case opIntConst: return hashCombine(operHash, std::hash<int>()(m_value.i));
+    case opLongConst: return hashCombine(operHash, std::hash<QWord>()(m_value.ll));
+    case opFltConst: return hashCombine(operHash, std::hash<double>()(m_value.d));
+    case opStrConst: return hashCombine(operHash, qHash(m_string));
+    default: return operHash;
+    }
+}
+
+
 QString Const::getFuncName() const
 {
     return m_value.pp->getName();
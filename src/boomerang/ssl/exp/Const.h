@@ -84,6 +84,9 @@ public:
     /// \copydoc Exp::operator*=
     virtual bool operator*=(const Exp &o) const override;
 
+    /// \copydoc Exp::hash
+    virtual std::size_t hash() const override;
+
     // Get the constant
     int getInt() const { return m_value.i; }
     QWord getLong() const { return m_value.ll; }
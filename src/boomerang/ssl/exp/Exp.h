@@ -92,6 +92,16 @@ public:
     /// Comparison ignoring subscripts
     virtual bool operator*=(const Exp &o) const = 0;
 
+    /**
+     * \returns a hash of the structure of this expression.
+     * Expressions that are equal according to lessExpStar have the same hash,
+     * so expressions can be used as keys of hash containers (see hashExpStar).
+     * \note Subscripts with a wildcard definition (STMT_WILD) are ordered equal to
+     * all subscripts of the same expression, but do not hash equal to them.
+     * \note The hash is not cached, since subexpressions can be modified in place.
+     */
+    virtual std::size_t hash() const = 0;
+
     /// Return the operator.
     /// \note I'd like to make this protected, but then subclasses
     /// don't seem to be able to use it (at least, for subexpressions)
@@ -520,6 +530,13 @@ protected:
     /// Accept an exppression modifier to modify this expression after modifying all subexpressions.
     virtual SharedExp acceptPostModifier(ExpModifier *mod) = 0;
 
+protected:
+    /// Combine the hash \p seed with the hash \p value of the next component of an expression.
+    static std::size_t hashCombine(std::size_t seed, std::size_t value)
+    {
+        return seed ^ (value + 0x9E3779B9 + (seed << 6) + (seed >> 2));
+    }
+
 protected:
     template<typename CHILD>
     std::shared_ptr<CHILD> shared_from_base()
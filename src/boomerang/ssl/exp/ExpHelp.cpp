@@ -19,3 +19,20 @@ bool lessExpStar::operator()(const SharedConstExp &left, const SharedConstExp &r
 {
     return (*left < *right); // Compare the actual Exps
 }
+
+
+std::size_t hashExpStar::operator()(const SharedConstExp &exp) const
+{
+    return exp->hash();
+}
+
+
+bool equalExpStar::operator()(const SharedConstExp &left, const SharedConstExp &right) const
+{
+    if (left == right) {
+        return true;
+    }
+
+    // Neither is less than the other
+    return !(*left < *right) && !(*right < *left);
+}
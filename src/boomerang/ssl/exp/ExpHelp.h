@@ -12,6 +12,7 @@
 
 #include "boomerang/core/BoomerangAPI.h"
 
+#include <cstddef>
 #include <memory>
 
 
@@ -26,3 +27,21 @@ struct BOOMERANG_API lessExpStar
 {
     bool operator()(const SharedConstExp &left, const SharedConstExp &right) const;
 };
+
+
+/**
+ * Hash functor for Exp*s (hashing the actual expressions). Consistent with lessExpStar,
+ * i.e. expressions that are equal according to lessExpStar have the same hash.
+ * Use together with equalExpStar for hash containers keyed by expressions.
+ */
+struct BOOMERANG_API hashExpStar
+{
+    std::size_t operator()(const SharedConstExp &exp) const;
+};
+
+
+/// Equality functor for Exp*s that agrees with lessExpStar. Type sensitive.
+struct BOOMERANG_API equalExpStar
+{
+    bool operator()(const SharedConstExp &left, const SharedConstExp &right) const;
+};
@@ -15,6 +15,8 @@
 #include "boomerang/visitor/expmodifier/ExpModifier.h"
 #include "boomerang/visitor/expvisitor/ExpVisitor.h"
 
+#include <functional>
+
 
 RefExp::RefExp(SharedExp e, Statement *d)
     : Unary(opSubscript, e)
@@ -119,6 +121,12 @@ bool RefExp::operator*=(const Exp &o) const
 }
 
 
+std::size_t RefExp::hash() const
+{
+    return hashCombine(Unary::hash(), std::hash<const Statement *>()(m_def));
+}
+
+
 bool RefExp::acceptVisitor(ExpVisitor *v)
 {
     bool visitChildren = true;
@@ -58,6 +58,9 @@ public:
     /// \copydoc Unary::operator*=
     bool operator*=(const Exp &o) const override;
 
+    /// \copydoc Unary::hash
+    std::size_t hash() const override;
+
     Statement *getDef() const { return m_def; } // Ugh was called getRef()
     void setDef(Statement *_def);
 
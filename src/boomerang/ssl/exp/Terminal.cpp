@@ -80,6 +80,12 @@ bool Terminal::operator*=(const Exp &o) const
 }
 
 
+std::size_t Terminal::hash() const
+{
+    return static_cast<std::size_t>(m_oper);
+}
+
+
 bool Terminal::acceptVisitor(ExpVisitor *v)
 {
     return v->visit(shared_from_base<Terminal>());
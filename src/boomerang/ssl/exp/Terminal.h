@@ -45,6 +45,9 @@ public:
     /// \copydoc Exp::operator*=
     bool operator*=(const Exp &o) const override;
 
+    /// \copydoc Exp::hash
+    std::size_t hash() const override;
+
     /// \copydoc Exp::isTerminal
     bool isTerminal() const override { return true; }
 
@@ -158,6 +158,12 @@ bool Ternary::operator*=(const Exp &o) const
 }
 
 
+std::size_t Ternary::hash() const
+{
+    return hashCombine(Binary::hash(), subExp3->hash());
+}
+
+
 void Ternary::doSearchChildren(const Exp &pattern, std::list<SharedExp *> &li, bool once)
 {
     doSearch(pattern, subExp1, li, once);
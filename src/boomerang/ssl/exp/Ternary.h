@@ -47,6 +47,9 @@ public:
     /// \copydoc Binary::operator*=
     bool operator*=(const Exp &o) const override;
 
+    /// \copydoc Binary::hash
+    std::size_t hash() const override;
+
     /// \copydoc Binary::getArity
     int getArity() const override { return 3; }
 
@@ -150,6 +150,12 @@ bool Unary::operator*=(const Exp &o) const
 }
 
 
+std::size_t Unary::hash() const
+{
+    return hashCombine(static_cast<std::size_t>(m_oper), subExp1->hash());
+}
+
+
 void Unary::doSearchChildren(const Exp &pattern, std::list<SharedExp *> &li, bool once)
 {
     doSearch(pattern, subExp1, li, once);
@@ -45,6 +45,9 @@ public:
     /// \copydoc Exp::operator*=
     bool operator*=(const Exp &o) const override;
 
+    /// \copydoc Exp::hash
+    std::size_t hash() const override;
+
     /// \copydoc Exp::getArity
     virtual int getArity() const override { return 1; }
 
@@ -217,7 +217,7 @@ bool BoolAssign::searchAndReplace(const Exp &pattern, SharedExp replace, bool cc
 }
 
 
-void BoolAssign::setLeftFromList(const std::list<Statement *> &stmts)
+void BoolAssign::setLeftFromList(const RTL::StmtList &stmts)
 {
     assert(stmts.size() == 1);
     Assign *first = static_cast<Assign *>(stmts.front());
@@ -10,6 +10,7 @@
 #pragma once
 
 
+#include "boomerang/ssl/RTL.h"
 #include "boomerang/ssl/statements/Assignment.h"
 
 
@@ -110,7 +111,7 @@ public:
 
     /// a hack for the SETS macro
     /// This is for setting up SETcc instructions; see include/decoder.h macro SETS
-    void setLeftFromList(const std::list<Statement *> &stmts);
+    void setLeftFromList(const RTL::StmtList &stmts);
 
 private:
     BranchType m_jumpType = BranchType::INVALID; ///< the condition for setting true
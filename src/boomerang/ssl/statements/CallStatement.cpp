@@ -416,6 +416,8 @@ bool CallStatement::searchAndReplace(const Exp &pattern, SharedExp replace, bool
         for (dd = m_defCol.begin(); dd != m_defCol.end(); ++dd) {
             change |= (*dd)->searchAndReplace(pattern, replace, cc);
         }
+
+        m_defCol.sort();
     }
 
     return change;
@@ -1314,6 +1316,8 @@ void CallStatement::updateArguments(bool experimental)
         for (dd = m_defCol.begin(); dd != m_defCol.end(); ++dd) {
             (*dd)->simplify();
         }
+
+        m_defCol.sort();
     }
 
     auto sig = m_proc->getSignature();
@@ -1596,11 +1600,11 @@ bool CallStatement::accept(StmtModifier *v)
     // possible logic take care of it, and leave the collectors as the rename logic set it Well,
     // sort it out with ignoreCollector()
     if (!v->ignoreCollector()) {
-        DefCollector::iterator cc;
-
         for (Statement *s : m_defCol) {
             s->accept(v);
         }
+
+        m_defCol.sort();
     }
 
     if (visitChildren) {
@@ -1663,6 +1667,10 @@ bool CallStatement::accept(StmtPartModifier *v)
             // m[esp{-} - 20]
             exp->acceptModifier(v->mod);
         }
+
+        // The locations and definitions were modified in place
+        m_useCol.sort();
+        m_defCol.sort();
     }
 
     StatementList::iterator dd;
@@ -134,6 +134,8 @@ bool ReturnStatement::searchAndReplace(const Exp &pattern, SharedExp replace, bo
         for (Assign *def : m_col) {
             change |= def->searchAndReplace(pattern, replace);
         }
+
+        m_col.sort();
     }
 
     return change;
@@ -220,9 +222,12 @@ bool ReturnStatement::accept(StmtModifier *v)
 
         for (dd = m_col.begin(); dd != m_col.end(); ++dd) {
             if (!(*dd)->accept(v)) {
+                m_col.sort();
                 return false;
             }
         }
+
+        m_col.sort();
     }
 
     for (Statement *stmt : m_modifieds) {
@@ -220,8 +220,7 @@ bool Statement::canPropagateToExp(const Exp &exp)
 }
 
 
-bool Statement::propagateTo(bool &convert, Settings *settings,
-                            std::map<SharedExp, int, lessExpStar> *destCounts,
+bool Statement::propagateTo(bool &convert, Settings *settings, ExpIntMap *destCounts,
                             LocationSet *usedByDomPhi, bool force)
 {
     bool change            = false;
@@ -319,7 +318,7 @@ bool Statement::propagateTo(bool &convert, Settings *settings,
                 change |= doPropagateTo(e, def, convert, settings);
             }
             else {
-                std::map<SharedExp, int, lessExpStar>::iterator ff = destCounts->find(e);
+                ExpIntMap::iterator ff = destCounts->find(e);
 
                 if (ff == destCounts->end()) {
                     change |= doPropagateTo(e, def, convert, settings);
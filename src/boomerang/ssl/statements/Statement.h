@@ -15,6 +15,7 @@
 
 #include <list>
 #include <map>
+#include <unordered_map>
 
 
 class BasicBlock;
@@ -94,7 +95,7 @@ enum class BranchType : uint8_t
  */
 class BOOMERANG_API Statement
 {
-    typedef std::map<SharedExp, int, lessExpStar> ExpIntMap;
+    typedef std::unordered_map<SharedExp, int, hashExpStar, equalExpStar> ExpIntMap;
 
 public:
     Statement();
@@ -95,6 +95,10 @@ size_t ArrayType::getSize() const
 
 bool ArrayType::operator==(const Type &other) const
 {
+    if (&other == this) {
+        return true;
+    }
+
     return other.isArray() && *BaseType == *static_cast<const ArrayType &>(other).BaseType &&
            static_cast<const ArrayType &>(other).m_length == m_length;
 }
@@ -138,7 +142,7 @@ void ArrayType::fixBaseType(SharedType b)
 }
 
 
-SharedType ArrayType::meetWith(SharedType other, bool &changed, bool useHighestPtr) const
+SharedType ArrayType::meetWithImpl(SharedType other, bool &changed, bool useHighestPtr) const
 {
     if (other->resolvesToVoid()) {
         return const_cast<ArrayType *>(this)->shared_from_this();
@@ -189,7 +193,7 @@ SharedType ArrayType::meetWith(SharedType other, bool &changed, bool useHighestP
         }
 
         auto bt = BaseType->clone();
-        bool base_changed;
+        bool base_changed = false;
         auto res = bt->meetWith(other, base_changed);
 
         if (res == bt) {
@@ -66,9 +66,6 @@ public:
     virtual size_t getSize() const override;
     virtual QString getCtype(bool final = false) const override;
 
-    /// \copydoc Type::meetWith
-    virtual SharedType meetWith(SharedType other, bool &changed, bool useHighestPtr) const override;
-
     virtual bool isCompatibleWith(const Type &other, bool all = false) const override
     {
         return isCompatible(other, all);
@@ -80,6 +77,10 @@ public:
 protected:
     ArrayType();
 
+    /// \copydoc Type::meetWithImpl
+    virtual SharedType meetWithImpl(SharedType other, bool &changed,
+                                    bool useHighestPtr) const override;
+
 private:
     SharedType BaseType;
     size_t m_length = 0; ///< number of elements in this array
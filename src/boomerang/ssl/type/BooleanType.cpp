@@ -23,9 +23,16 @@ BooleanType::~BooleanType()
 }
 
 
+std::shared_ptr<BooleanType> BooleanType::get()
+{
+    static const std::shared_ptr<BooleanType> instance = std::make_shared<BooleanType>();
+    return instance;
+}
+
+
 SharedType BooleanType::clone() const
 {
-    return std::make_shared<BooleanType>();
+    return BooleanType::get();
 }
 
 
@@ -61,7 +68,7 @@ QString BooleanType::getCtype(bool /*final*/) const
 }
 
 
-SharedType BooleanType::meetWith(SharedType other, bool &changed, bool useHighestPtr) const
+SharedType BooleanType::meetWithImpl(SharedType other, bool &changed, bool useHighestPtr) const
 {
     if (other->resolvesToVoid() || other->resolvesToBoolean()) {
         return const_cast<BooleanType *>(this)->shared_from_this();
@@ -27,7 +27,8 @@ public:
 
 public:
     virtual bool isBoolean() const override { return true; }
-    static std::shared_ptr<BooleanType> get() { return std::make_shared<BooleanType>(); }
+    /// \returns the shared, immutable instance of this type.
+    static std::shared_ptr<BooleanType> get();
 
     virtual SharedType clone() const override;
 
@@ -39,7 +40,10 @@ public:
 
     virtual QString getCtype(bool final = false) const override;
 
-    /// \copydoc Type::meetWith
-    virtual SharedType meetWith(SharedType other, bool &changed, bool useHighestPtr) const override;
     virtual bool isCompatible(const Type &other, bool all) const override;
+
+protected:
+    /// \copydoc Type::meetWithImpl
+    virtual SharedType meetWithImpl(SharedType other, bool &changed,
+                                    bool useHighestPtr) const override;
 };
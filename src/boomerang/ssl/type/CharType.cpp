@@ -24,6 +24,13 @@ CharType::~CharType()
 }
 
 
+std::shared_ptr<CharType> CharType::get()
+{
+    static const std::shared_ptr<CharType> instance = std::make_shared<CharType>();
+    return instance;
+}
+
+
 SharedType CharType::clone() const
 {
     return CharType::get();
@@ -53,7 +60,7 @@ QString CharType::getCtype(bool /*final*/) const
 }
 
 
-SharedType CharType::meetWith(SharedType other, bool &changed, bool useHighestPtr) const
+SharedType CharType::meetWithImpl(SharedType other, bool &changed, bool useHighestPtr) const
 {
     if (other->resolvesToVoid() || other->resolvesToChar()) {
         return const_cast<CharType *>(this)->shared_from_this();
@@ -30,7 +30,8 @@ public:
 
     virtual SharedType clone() const override;
 
-    static std::shared_ptr<CharType> get() { return std::make_shared<CharType>(); }
+    /// \returns the shared, immutable instance of this type.
+    static std::shared_ptr<CharType> get();
     virtual bool operator==(const Type &other) const override;
 
     virtual bool operator<(const Type &other) const override;
@@ -39,8 +40,10 @@ public:
 
     virtual QString getCtype(bool final = false) const override;
 
-    /// \copydoc Type::meetWith
-    virtual SharedType meetWith(SharedType other, bool &changed, bool useHighestPtr) const override;
-
     virtual bool isCompatible(const Type &other, bool all) const override;
+
+protected:
+    /// \copydoc Type::meetWithImpl
+    virtual SharedType meetWithImpl(SharedType other, bool &changed,
+                                    bool useHighestPtr) const override;
 };
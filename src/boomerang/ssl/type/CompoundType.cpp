@@ -11,11 +11,21 @@
 
 #include "boomerang/ssl/type/SizeType.h"
 
+#include <algorithm>
+
+
+/// \returns true if the size of \p ty might change after it was added to a compound.
+static bool hasVariableSize(const SharedType &ty)
+{
+    return ty->isArray() || ty->isCompound() || ty->isUnion() || ty->isNamed();
+}
+
 
 CompoundType::CompoundType(bool is_generic /* = false */)
     : Type(TypeClass::Compound)
     , m_isGeneric(is_generic)
     , m_nextGenericMemberNum(1)
+    , m_memberOffsets(1, 0)
 {
 }
 
@@ -39,14 +49,12 @@ SharedType CompoundType::clone() const
 
 size_t CompoundType::getSize() const
 {
-    int n = 0;
-
-    for (auto &elem : m_types) {
-        // NOTE: this assumes no padding... perhaps explicit padding will be needed
-        n += elem->getSize();
+    // NOTE: this assumes no padding... perhaps explicit padding will be needed
+    if (!hasStaleMemberOffsets()) {
+        return m_memberOffsets.back();
     }
 
-    return n;
+    return computeMemberOffsets().back();
 }
 
 
@@ -110,105 +118,82 @@ SharedType CompoundType::getMemberTypeByName(const QString &name)
 
 SharedType CompoundType::getMemberTypeByOffset(unsigned bitOffset)
 {
-    unsigned offset = 0;
-
-    for (auto &elem : m_types) {
-        if ((offset <= bitOffset) && (bitOffset < offset + elem->getSize())) {
-            return elem;
-        }
-
-        offset += elem->getSize();
-    }
-
-    return nullptr;
+    const int idx = findMemberIdxByOffset(bitOffset);
+    return idx != -1 ? m_types[idx] : nullptr;
 }
 
 
 void CompoundType::setMemberTypeByOffset(unsigned bitOffset, SharedType ty)
 {
-    unsigned offset = 0;
+    updateMemberOffsets();
 
-    for (unsigned i = 0; i < m_types.size(); i++) {
-        if ((offset <= bitOffset) && (bitOffset < offset + m_types[i]->getSize())) {
-            unsigned oldsz = m_types[i]->getSize();
-            m_types[i]     = ty;
+    const int idx = findMemberIdxByOffset(bitOffset);
 
-            if (ty->getSize() < oldsz) {
-                m_types.push_back(m_types[m_types.size() - 1]);
-                m_names.push_back(m_names[m_names.size() - 1]);
+    if (idx == -1) {
+        return;
+    }
 
-                for (size_t _n = m_types.size() - 1; _n > i; _n--) {
-                    m_types[_n] = m_types[_n - 1];
-                    m_names[_n] = m_names[_n - 1];
-                }
+    const size_t oldSize   = m_types[idx]->getSize();
+    const bool wasVariable = hasVariableSize(m_types[idx]);
+    m_types[idx]           = ty;
 
-                m_types[i + 1] = SizeType::get(oldsz - ty->getSize());
-                m_names[i + 1] = "pad";
-            }
+    if (ty->getSize() < oldSize) {
+        m_types.insert(m_types.begin() + idx + 1, SizeType::get(oldSize - ty->getSize()));
+        m_names.insert(m_names.begin() + idx + 1, "pad");
 
-            return;
-        }
+        recomputeMemberOffsets(idx);
+        recomputeVariableSizeMembers();
+    }
+    else if (ty->getSize() != oldSize) {
+        recomputeMemberOffsets(idx);
 
-        offset += m_types[i]->getSize();
+        if (wasVariable != hasVariableSize(ty)) {
+            recomputeVariableSizeMembers();
+        }
+    }
+    else if (wasVariable != hasVariableSize(ty)) {
+        recomputeVariableSizeMembers();
     }
 }
 
 
 void CompoundType::setMemberNameByOffset(unsigned n, const QString &name)
 {
-    unsigned offset = 0;
-
-    for (unsigned i = 0; i < m_types.size(); i++) {
-        if ((offset <= n) && (n < offset + m_types[i]->getSize())) {
-            m_names[i] = name;
-            return;
-        }
+    const int idx = findMemberIdxByOffset(n);
 
-        offset += m_types[i]->getSize();
+    if (idx != -1) {
+        m_names[idx] = name;
     }
 }
 
 
 QString CompoundType::getMemberNameByOffset(size_t n)
 {
-    unsigned offset = 0;
-
-    for (unsigned i = 0; i < m_types.size(); i++) {
-        // if (offset >= n && n < offset + types[i]->getSize())
-        if ((offset <= n) && (n < offset + m_types[i]->getSize())) {
-            // return getName(offset == n ? i : i - 1);
-            return m_names[i];
-        }
+    const int idx = findMemberIdxByOffset(n);
 
-        offset += m_types[i]->getSize();
+    if (idx == -1) {
+        return nullptr;
     }
 
-    return nullptr;
+    return m_names[idx];
 }
 
 
 unsigned CompoundType::getMemberOffsetByIdx(int n)
 {
-    unsigned offset = 0;
+    assert(n >= 0 && n <= getNumMembers());
 
-    for (int i = 0; i < n; i++) {
-        offset += m_types[i]->getSize();
-    }
-
-    return offset;
+    updateMemberOffsets();
+    return m_memberOffsets[n];
 }
 
 
 unsigned CompoundType::getMemberOffsetByName(const QString &member)
 {
-    unsigned offset = 0;
-
     for (unsigned i = 0; i < m_types.size(); i++) {
         if (m_names[i] == member) {
-            return offset;
+            return getMemberOffsetByIdx(i);
         }
-
-        offset += m_types[i]->getSize();
     }
 
     return static_cast<unsigned int>(-1);
@@ -217,26 +202,96 @@ unsigned CompoundType::getMemberOffsetByName(const QString &member)
 
 unsigned CompoundType::getOffsetRemainder(unsigned n)
 {
-    unsigned r      = n;
-    unsigned offset = 0;
+    updateMemberOffsets();
+
+    const int idx = countMembersBeforeOffset(n);
+    return n - m_memberOffsets[idx];
+}
 
-    for (auto &elem : m_types) {
-        offset += elem->getSize();
 
-        if (offset > n) {
-            break;
+int CompoundType::findMemberIdxByOffset(size_t bitOffset) const
+{
+    const int idx = countMembersBeforeOffset(bitOffset);
+
+    // Zero-sized members never contain bitOffset, so member idx (if any) always does.
+    return idx < getNumMembers() ? idx : -1;
+}
+
+
+int CompoundType::countMembersBeforeOffset(size_t bitOffset) const
+{
+    // The end of member i is the start of member i+1
+    if (!hasStaleMemberOffsets()) {
+        auto it = std::upper_bound(m_memberOffsets.begin() + 1, m_memberOffsets.end(), bitOffset);
+        return std::distance(m_memberOffsets.begin() + 1, it);
+    }
+
+    const std::vector<size_t> offsets = computeMemberOffsets();
+    auto it = std::upper_bound(offsets.begin() + 1, offsets.end(), bitOffset);
+    return std::distance(offsets.begin() + 1, it);
+}
+
+
+bool CompoundType::hasStaleMemberOffsets() const
+{
+    for (const int idx : m_variableSizeMembers) {
+        if (m_memberOffsets[idx + 1] - m_memberOffsets[idx] != m_types[idx]->getSize()) {
+            return true;
         }
+    }
+
+    return false;
+}
+
 
-        r -= elem->getSize();
+std::vector<size_t> CompoundType::computeMemberOffsets() const
+{
+    std::vector<size_t> offsets(m_types.size() + 1, 0);
+
+    for (size_t i = 0; i < m_types.size(); i++) {
+        offsets[i + 1] = offsets[i] + m_types[i]->getSize();
     }
 
-    return r;
+    return offsets;
+}
+
+
+void CompoundType::updateMemberOffsets()
+{
+    if (hasStaleMemberOffsets()) {
+        recomputeMemberOffsets(0);
+    }
+}
+
+
+void CompoundType::recomputeMemberOffsets(size_t idx)
+{
+    m_memberOffsets.resize(m_types.size() + 1);
+
+    for (size_t i = idx; i < m_types.size(); i++) {
+        m_memberOffsets[i + 1] = m_memberOffsets[i] + m_types[i]->getSize();
+    }
+}
+
+
+void CompoundType::recomputeVariableSizeMembers()
+{
+    m_variableSizeMembers.clear();
+
+    for (size_t i = 0; i < m_types.size(); i++) {
+        if (hasVariableSize(m_types[i])) {
+            m_variableSizeMembers.push_back(static_cast<int>(i));
+        }
+    }
 }
 
 
 bool CompoundType::operator==(const Type &other) const
 {
-    if (!other.isCompound()) {
+    if (&other == this) {
+        return true;
+    }
+    else if (!other.isCompound()) {
         return false;
     }
 
@@ -323,6 +378,13 @@ void CompoundType::addMember(SharedType memberType, const QString &memberName)
         memberType = existingType;
     }
 
+    updateMemberOffsets();
+    m_memberOffsets.push_back(m_memberOffsets.back() + memberType->getSize());
+
+    if (hasVariableSize(memberType)) {
+        m_variableSizeMembers.push_back(getNumMembers());
+    }
+
     m_types.push_back(memberType);
     m_names.push_back(memberName);
 }
@@ -342,7 +404,7 @@ QString CompoundType::getMemberNameByIdx(int idx)
 }
 
 
-SharedType CompoundType::meetWith(SharedType other, bool &changed, bool useHighestPtr) const
+SharedType CompoundType::meetWithImpl(SharedType other, bool &changed, bool useHighestPtr) const
 {
     if (other->resolvesToVoid()) {
         return const_cast<CompoundType *>(this)->shared_from_this();
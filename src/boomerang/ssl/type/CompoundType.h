@@ -50,9 +50,6 @@ public:
     /// \copydoc Type::getSize
     virtual size_t getSize() const override;
 
-    /// \copydoc Type::meetWith
-    virtual SharedType meetWith(SharedType other, bool &changed, bool useHighestPtr) const override;
-
     /// \copydoc Type::getCtype
     virtual QString getCtype(bool final = false) const override;
 
@@ -108,9 +105,47 @@ public:
 
     unsigned getOffsetRemainder(unsigned n);
 
+protected:
+    /// \copydoc Type::meetWithImpl
+    virtual SharedType meetWithImpl(SharedType other, bool &changed,
+                                    bool useHighestPtr) const override;
+
+private:
+    /// \returns the index of the member that contains the bit at \p bitOffset,
+    /// or -1 if there is no such member.
+    int findMemberIdxByOffset(size_t bitOffset) const;
+
+    /// \returns the number of members that end at or before \p bitOffset.
+    int countMembersBeforeOffset(size_t bitOffset) const;
+
+    /// \returns true if the size of a nested aggregate member changed after the member
+    /// offsets were computed. Const members then compute the offsets without storing them,
+    /// so that concurrent readers never modify the type.
+    bool hasStaleMemberOffsets() const;
+
+    /// \returns the bit offsets of all members, computed from the current member sizes.
+    std::vector<size_t> computeMemberOffsets() const;
+
+    /// Recompute the member offsets if the size of a member changed after it was added.
+    void updateMemberOffsets();
+
+    /// Recompute the offsets of all members after member \p idx.
+    void recomputeMemberOffsets(size_t idx);
+
+    /// Recompute which members might change their size.
+    void recomputeVariableSizeMembers();
+
 private:
     std::vector<SharedType> m_types;
     std::vector<QString> m_names;
     bool m_isGeneric;
     int m_nextGenericMemberNum;
+
+    /// m_memberOffsets[i] is the bit offset of member i;
+    /// the last element is the size of the compound.
+    std::vector<size_t> m_memberOffsets;
+
+    /// Indices of members that are aggregates themselves and whose size might
+    /// change after they were added. Primitive types are immutable.
+    std::vector<int> m_variableSizeMembers;
 };
@@ -12,6 +12,9 @@
 #include "boomerang/ssl/type/ArrayType.h"
 #include "boomerang/ssl/type/SizeType.h"
 
+#include <map>
+#include <mutex>
+
 
 FloatType::FloatType(int sz)
     : Type(TypeClass::Float)
@@ -22,7 +25,16 @@ FloatType::FloatType(int sz)
 
 std::shared_ptr<FloatType> FloatType::get(int sz)
 {
-    return std::make_shared<FloatType>(sz);
+    static std::mutex mutex;
+    static std::map<int, std::shared_ptr<FloatType>> types;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    std::shared_ptr<FloatType> &ty = types[sz];
+    if (!ty) {
+        ty = std::make_shared<FloatType>(sz);
+    }
+
+    return ty;
 }
 
 
@@ -89,7 +101,7 @@ QString FloatType::getTempName() const
 }
 
 
-SharedType FloatType::meetWith(SharedType other, bool &changed, bool useHighestPtr) const
+SharedType FloatType::meetWithImpl(SharedType other, bool &changed, bool useHighestPtr) const
 {
     if (other->resolvesToVoid()) {
         return const_cast<FloatType *>(this)->shared_from_this();
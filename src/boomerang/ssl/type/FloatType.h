@@ -22,10 +22,12 @@ public:
 
     virtual ~FloatType() override;
 
-    FloatType &operator=(const FloatType &other) = default;
-    FloatType &operator=(FloatType &&other) = default;
+    FloatType &operator=(const FloatType &other) = delete;
+    FloatType &operator=(FloatType &&other) = delete;
 
 public:
+    /// \returns the float type of size \p sz.
+    /// Float types are immutable; all float types of the same size are shared.
     static std::shared_ptr<FloatType> get(int sz = 64);
 
     virtual bool isFloat() const override { return true; }
@@ -38,17 +40,17 @@ public:
 
     virtual size_t getSize() const override;
 
-    virtual void setSize(size_t sz) override { size = sz; }
-
     virtual QString getCtype(bool final = false) const override;
 
     virtual QString getTempName() const override;
 
-    /// \copydoc Type::meetWith
-    virtual SharedType meetWith(SharedType other, bool &changed, bool useHighestPtr) const override;
-
     virtual bool isCompatible(const Type &other, bool all) const override;
 
+protected:
+    /// \copydoc Type::meetWithImpl
+    virtual SharedType meetWithImpl(SharedType other, bool &changed,
+                                    bool useHighestPtr) const override;
+
 private:
     size_t size; // Size in bits, e.g. 64
 };
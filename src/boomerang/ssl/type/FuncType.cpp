@@ -39,7 +39,10 @@ size_t FuncType::getSize() const
 
 bool FuncType::operator==(const Type &other) const
 {
-    if (!other.isFunc()) {
+    if (&other == this) {
+        return true;
+    }
+    else if (!other.isFunc()) {
         return false;
     }
     const FuncType &otherFunc = static_cast<const FuncType &>(other);
@@ -126,7 +129,7 @@ void FuncType::getReturnAndParam(QString &ret, QString &param)
 }
 
 
-SharedType FuncType::meetWith(SharedType other, bool &changed, bool useHighestPtr) const
+SharedType FuncType::meetWithImpl(SharedType other, bool &changed, bool useHighestPtr) const
 {
     if (other->resolvesToVoid()) {
         return const_cast<FuncType *>(this)->shared_from_this();
@@ -51,11 +51,13 @@ public:
     // As above, but split into the return and parameter parts
     void getReturnAndParam(QString &ret, QString &param);
 
-    /// \copydoc Type::meetWith
-    virtual SharedType meetWith(SharedType other, bool &changed, bool useHighestPtr) const override;
-
     virtual bool isCompatible(const Type &other, bool all) const override;
 
+protected:
+    /// \copydoc Type::meetWithImpl
+    virtual SharedType meetWithImpl(SharedType other, bool &changed,
+                                    bool useHighestPtr) const override;
+
 private:
     std::shared_ptr<Signature> signature;
 };
@@ -12,6 +12,10 @@
 #include "boomerang/ssl/type/SizeType.h"
 #include "boomerang/util/log/Log.h"
 
+#include <map>
+#include <mutex>
+#include <vector>
+
 
 IntegerType::IntegerType(unsigned int NumBits, Sign sign)
     : Type(TypeClass::Integer)
@@ -21,35 +25,70 @@ IntegerType::IntegerType(unsigned int NumBits, Sign sign)
 }
 
 
-std::shared_ptr<IntegerType> IntegerType::get(unsigned numBits, Sign sign)
+/// \returns \p sign, more likely to be signed
+static Sign hintAsSigned(Sign sign)
 {
-    return std::make_shared<IntegerType>(numBits, sign);
+    return std::min((Sign)((int)sign + 1), Sign::SignedStrong);
 }
 
 
-SharedType IntegerType::clone() const
+/// \returns \p sign, more likely to be unsigned
+static Sign hintAsUnsigned(Sign sign)
 {
-    return IntegerType::get(size, signedness);
+    return std::max((Sign)((int)sign - 1), Sign::UnsignedStrong);
 }
 
 
-size_t IntegerType::getSize() const
+std::shared_ptr<IntegerType> IntegerType::get(unsigned numBits, Sign sign)
 {
-    return size;
+    static constexpr unsigned NUM_COMMON_SIZES = 129; // 0..128 bits
+    static constexpr int NUM_SIGNS = (int)Sign::SignedStrong - (int)Sign::UnsignedStrong + 1;
+
+    // Initialized once, so no locking is required for lookups
+    static const std::vector<std::shared_ptr<IntegerType>> commonTypes = []() {
+        std::vector<std::shared_ptr<IntegerType>> types;
+        types.reserve(NUM_COMMON_SIZES * NUM_SIGNS);
+
+        for (unsigned sz = 0; sz < NUM_COMMON_SIZES; ++sz) {
+            for (int sgn = (int)Sign::UnsignedStrong; sgn <= (int)Sign::SignedStrong; ++sgn) {
+                types.push_back(std::make_shared<IntegerType>(sz, (Sign)sgn));
+            }
+        }
+
+        return types;
+    }();
+
+    const int signIdx = (int)sign - (int)Sign::UnsignedStrong;
+    assert(signIdx >= 0 && signIdx < NUM_SIGNS);
+
+    if (numBits < NUM_COMMON_SIZES) {
+        return commonTypes[numBits * NUM_SIGNS + signIdx];
+    }
+
+    static std::mutex mutex;
+    static std::map<std::pair<unsigned, Sign>, std::shared_ptr<IntegerType>> otherTypes;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    std::shared_ptr<IntegerType> &ty = otherTypes[{ numBits, sign }];
+    if (!ty) {
+        ty = std::make_shared<IntegerType>(numBits, sign);
+    }
+
+    return ty;
 }
 
-void IntegerType::hintAsSigned()
+
+SharedType IntegerType::clone() const
 {
-    signedness = std::min((Sign)((int)signedness + 1), Sign::SignedStrong);
+    return IntegerType::get(size, signedness);
 }
 
 
-void IntegerType::hintAsUnsigned()
+size_t IntegerType::getSize() const
 {
-    signedness = std::max((Sign)((int)signedness - 1), Sign::UnsignedStrong);
+    return size;
 }
 
-
 bool IntegerType::operator==(const Type &other) const
 {
     if (!other.isInteger()) {
@@ -129,7 +168,7 @@ QString IntegerType::getCtype(bool final) const
 }
 
 
-SharedType IntegerType::meetWith(SharedType other, bool &changed, bool useHighestPtr) const
+SharedType IntegerType::meetWithImpl(SharedType other, bool &changed, bool useHighestPtr) const
 {
     if (other->resolvesToVoid()) {
         return const_cast<IntegerType *>(this)->shared_from_this();
@@ -137,46 +176,46 @@ SharedType IntegerType::meetWith(SharedType other, bool &changed, bool useHighes
 
     if (other->resolvesToInteger()) {
         std::shared_ptr<IntegerType> otherInt = other->as<IntegerType>();
-        std::shared_ptr<IntegerType> result = std::dynamic_pointer_cast<IntegerType>(this->clone());
 
         // Signedness
+        Sign resultSign = signedness;
         if (otherInt->isSigned()) {
-            result->hintAsSigned();
+            resultSign = hintAsSigned(resultSign);
         }
         else if (otherInt->isUnsigned()) {
-            result->hintAsUnsigned();
+            resultSign = hintAsUnsigned(resultSign);
         }
 
+        // Size. Assume 0 indicates unknown size
+        const size_t resultSize = std::max(size, otherInt->size);
+
+        std::shared_ptr<IntegerType> result = IntegerType::get(resultSize, resultSign);
+
         changed |= result->isSigned() !=
                    isSigned(); // Changed from signed to not necessarily signed
         changed |= result->isUnsigned() !=
                    isUnsigned(); // Changed from unsigned to not necessarily unsigned
-
-        // Size. Assume 0 indicates unknown size
-        result->size = std::max(size, otherInt->size);
         changed |= (result->size != size);
 
         return result;
     }
     else if (other->resolvesToSize()) {
-        std::shared_ptr<IntegerType> result = std::dynamic_pointer_cast<IntegerType>(this->clone());
-        std::shared_ptr<SizeType> other_sz  = other->as<SizeType>();
+        std::shared_ptr<SizeType> other_sz = other->as<SizeType>();
 
         if (size == 0) { // Doubt this will ever happen
-            result->size = other_sz->getSize();
-            changed      = true;
-            return result;
+            changed = true;
+            return IntegerType::get(other_sz->getSize(), signedness);
         }
 
         if (size == other_sz->getSize()) {
-            return result;
+            return const_cast<IntegerType *>(this)->shared_from_this();
         }
 
         LOG_VERBOSE("Integer size %1 meet with SizeType size %2!", size, other_sz->getSize());
 
-        result->size = std::max(size, other_sz->getSize());
-        changed      = result->size != size;
-        return result;
+        const size_t resultSize = std::max(size, other_sz->getSize());
+        changed                 = resultSize != size;
+        return IntegerType::get(resultSize, signedness);
     }
 
     return createUnion(other, changed, useHighestPtr);
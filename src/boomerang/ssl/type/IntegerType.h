@@ -22,10 +22,12 @@ public:
 
     virtual ~IntegerType() override = default;
 
-    IntegerType &operator=(const IntegerType &other) = default;
-    IntegerType &operator=(IntegerType &&other) = default;
+    IntegerType &operator=(const IntegerType &other) = delete;
+    IntegerType &operator=(IntegerType &&other) = delete;
 
 public:
+    /// \returns the integer type with the given size and signedness.
+    /// Integer types are immutable; all integer types of the same size and sign are shared.
     static std::shared_ptr<IntegerType> get(unsigned NumBits, Sign sign = Sign::Unknown);
 
     virtual bool isInteger() const override { return true; }
@@ -38,8 +40,6 @@ public:
 
     virtual size_t getSize() const override; // Get size in bits
 
-    virtual void setSize(size_t sz) override { size = sz; }
-
     /// \returns true if definitely signed
     bool isSigned() const { return signedness > Sign::Unknown; }
 
@@ -54,11 +54,6 @@ public:
 
     bool isSignUnknown() const { return signedness == Sign::Unknown; }
 
-    /// A hint for signedness
-    void hintAsSigned();
-    void hintAsUnsigned();
-
-    void setSignedness(Sign sign) { signedness = sign; }
     Sign getSign() const { return signedness; }
 
     /// Get the C type as a string. If full, output comments re the lack of sign information (in
@@ -67,10 +62,13 @@ public:
 
     virtual QString getTempName() const override;
 
-    /// \copydoc Type::meetWith
-    virtual SharedType meetWith(SharedType other, bool &changed, bool useHighestPtr) const override;
     virtual bool isCompatible(const Type &other, bool all) const override;
 
+protected:
+    /// \copydoc Type::meetWithImpl
+    virtual SharedType meetWithImpl(SharedType other, bool &changed,
+                                    bool useHighestPtr) const override;
+
 private:
     size_t size;     ///< Size in bits, e.g. 16
     Sign signedness; ///< pos=signed, neg=unsigned, 0=unknown or evenly matched
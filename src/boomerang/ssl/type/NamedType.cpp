@@ -77,7 +77,7 @@ QString NamedType::getCtype(bool /*final*/) const
 }
 
 
-SharedType NamedType::meetWith(SharedType other, bool &changed, bool useHighestPtr) const
+SharedType NamedType::meetWithImpl(SharedType other, bool &changed, bool useHighestPtr) const
 {
     SharedType rt = resolvesTo();
 
@@ -59,11 +59,14 @@ void PointerType::setSize(size_t sz)
 }
 
 
-static int pointerCompareNest = 0;
+static thread_local int pointerCompareNest = 0;
 
 bool PointerType::operator==(const Type &other) const
 {
-    if (!other.isPointer()) {
+    if (&other == this) {
+        return true;
+    }
+    else if (!other.isPointer()) {
         return false;
     }
 
@@ -135,7 +138,7 @@ QString PointerType::getCtype(bool final) const
 }
 
 
-SharedType PointerType::meetWith(SharedType other, bool &changed, bool useHighestPtr) const
+SharedType PointerType::meetWithImpl(SharedType other, bool &changed, bool useHighestPtr) const
 {
     if (other->resolvesToVoid()) {
         return const_cast<PointerType *>(this)->shared_from_this();
@@ -64,11 +64,13 @@ public:
 
     virtual QString getCtype(bool final = false) const override;
 
-    /// \copydoc Type::meetWith
-    virtual SharedType meetWith(SharedType other, bool &changed, bool useHighestPtr) const override;
-
     virtual bool isCompatible(const Type &other, bool all) const override;
 
+protected:
+    /// \copydoc Type::meetWithImpl
+    virtual SharedType meetWithImpl(SharedType other, bool &changed,
+                                    bool useHighestPtr) const override;
+
 private:
     SharedType points_to;
 };
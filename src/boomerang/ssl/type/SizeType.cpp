@@ -10,8 +10,12 @@
 #include "SizeType.h"
 
 #include "boomerang/ssl/type/ArrayType.h"
+#include "boomerang/ssl/type/IntegerType.h"
 #include "boomerang/util/log/Log.h"
 
+#include <map>
+#include <mutex>
+
 
 SizeType::SizeType()
     : Type(TypeClass::Size)
@@ -62,19 +66,22 @@ bool SizeType::operator<(const Type &other) const
 
 std::shared_ptr<SizeType> SizeType::get(unsigned int sz)
 {
-    return std::make_shared<SizeType>(sz);
-}
+    static std::mutex mutex;
+    static std::map<unsigned int, std::shared_ptr<SizeType>> types;
 
+    std::lock_guard<std::mutex> lock(mutex);
+    std::shared_ptr<SizeType> &ty = types[sz];
+    if (!ty) {
+        ty = std::make_shared<SizeType>(sz);
+    }
 
-std::shared_ptr<SizeType> SizeType::get()
-{
-    return std::make_shared<SizeType>();
+    return ty;
 }
 
 
-void SizeType::setSize(size_t sz)
+std::shared_ptr<SizeType> SizeType::get()
 {
-    size = sz;
+    return SizeType::get(0);
 }
 
 
@@ -101,30 +108,25 @@ QString SizeType::getCtype(bool /*final*/) const
 }
 
 
-SharedType SizeType::meetWith(SharedType other, bool &changed, bool useHighestPtr) const
+SharedType SizeType::meetWithImpl(SharedType other, bool &changed, bool useHighestPtr) const
 {
     if (other->resolvesToVoid()) {
         return const_cast<SizeType *>(this)->shared_from_this();
     }
 
     if (other->resolvesToSize()) {
-        SharedType result = this->clone();
-
         if (other->as<SizeType>()->size != size) {
             LOG_VERBOSE("Size %1 meet with size %2!", size, other->as<SizeType>()->size);
         }
 
-        result->setSize(std::max(result->getSize(), other->as<SizeType>()->getSize()));
-
-        return result;
+        return SizeType::get(std::max(size, other->as<SizeType>()->getSize()));
     }
 
     changed = true;
 
     if (other->resolvesToInteger()) {
         if (other->getSize() == 0) {
-            other->setSize(size);
-            return other->clone();
+            return IntegerType::get(size, other->as<IntegerType>()->getSign());
         }
 
         if (other->getSize() != size) {
@@ -27,12 +27,14 @@ public:
 
     virtual ~SizeType() override;
 
-    SizeType &operator=(const SizeType &other) = default;
-    SizeType &operator=(SizeType &&other) = default;
+    SizeType &operator=(const SizeType &other) = delete;
+    SizeType &operator=(SizeType &&other) = delete;
 
 public:
     virtual SharedType clone() const override;
 
+    /// \returns the size type of size \p sz.
+    /// Size types are immutable; all size types of the same size are shared.
     static std::shared_ptr<SizeType> get(unsigned sz);
 
     static std::shared_ptr<SizeType> get();
@@ -42,15 +44,17 @@ public:
 
     virtual size_t getSize() const override;
 
-    virtual void setSize(size_t sz) override;
     virtual bool isSize() const override;
     virtual bool isComplete() override; // Basic type is unknown
     virtual QString getCtype(bool final = false) const override;
 
-    /// \copydoc Type::meetWith
-    virtual SharedType meetWith(SharedType other, bool &changed, bool useHighestPtr) const override;
     virtual bool isCompatible(const Type &other, bool) const override;
 
+protected:
+    /// \copydoc Type::meetWithImpl
+    virtual SharedType meetWithImpl(SharedType other, bool &changed,
+                                    bool useHighestPtr) const override;
+
 private:
     size_t size; // Size in bits, e.g. 16
 };
@@ -26,6 +26,7 @@
 #include "boomerang/ssl/type/NamedType.h"
 #include "boomerang/ssl/type/PointerType.h"
 #include "boomerang/ssl/type/SizeType.h"
+#include "boomerang/ssl/type/TypeContext.h"
 #include "boomerang/ssl/type/UnionType.h"
 #include "boomerang/ssl/type/VoidType.h"
 #include "boomerang/type/DataIntervalMap.h"
@@ -37,10 +38,13 @@
 
 #include <cassert>
 #include <cstring>
+#include <mutex>
+#include <shared_mutex>
 
 
-/// For NamedType
+/// For NamedType. Read-mostly, so readers share the lock.
 static QMap<QString, SharedType> g_namedTypes;
+static std::shared_mutex g_namedTypesMutex;
 
 
 Type::Type(TypeClass _class)
@@ -96,35 +100,50 @@ QString Type::prints()
 
 void Type::addNamedType(const QString &name, SharedType type)
 {
-    if (g_namedTypes.find(name) != g_namedTypes.end()) {
-        if (!(*type == *g_namedTypes[name])) {
-            LOG_WARN("Redefinition of type %1", name);
-            LOG_WARN(" type     = %1", type->prints());
-            LOG_WARN(" previous = %1", g_namedTypes[name]->prints());
-            g_namedTypes[name] = type; // WARN: was *type==*namedTypes[name], verify !
-        }
-    }
-    else {
+    // Note: Do not compare, print or clone types while holding the lock;
+    // these operations might need to look up other named types.
+    // A new definition is therefore prepared without the lock and only inserted
+    // if the name is still undefined once the lock is held.
+    SharedType existingType = getNamedType(name);
+
+    if (!existingType) {
         // check if it is:
         // typedef int a;
         // typedef a b;
         // we then need to define b as int
         // we create clones to keep the GC happy
-        if (g_namedTypes.find(type->getCtype()) != g_namedTypes.end()) {
-            g_namedTypes[name] = g_namedTypes[type->getCtype()]->clone();
-        }
-        else {
-            g_namedTypes[name] = type->clone();
+        SharedType aliasedType = getNamedType(type->getCtype());
+        SharedType newType     = aliasedType ? aliasedType->clone() : type->clone();
+
+        std::unique_lock<std::shared_mutex> lock(g_namedTypesMutex);
+        auto iter = g_namedTypes.find(name);
+
+        if (iter == g_namedTypes.end()) {
+            g_namedTypes.insert(name, newType);
+            return;
         }
+
+        // defined by another thread in the meantime
+        existingType = *iter;
+    }
+
+    if (!(*type == *existingType)) {
+        LOG_WARN("Redefinition of type %1", name);
+        LOG_WARN(" type     = %1", type->prints());
+        LOG_WARN(" previous = %1", existingType->prints());
+
+        std::unique_lock<std::shared_mutex> lock(g_namedTypesMutex);
+        g_namedTypes[name] = type; // WARN: was *type==*namedTypes[name], verify !
     }
 }
 
 
 SharedType Type::getNamedType(const QString &name)
 {
-    auto iter = g_namedTypes.find(name);
+    std::shared_lock<std::shared_mutex> lock(g_namedTypesMutex);
+    auto iter = g_namedTypes.constFind(name);
 
-    return (iter != g_namedTypes.end()) ? *iter : nullptr;
+    return (iter != g_namedTypes.constEnd()) ? *iter : nullptr;
 }
 
 
@@ -161,6 +180,7 @@ QString Type::getTempName() const
 
 void Type::clearNamedTypes()
 {
+    std::unique_lock<std::shared_mutex> lock(g_namedTypesMutex);
     g_namedTypes.clear();
 }
 
@@ -286,6 +306,29 @@ SharedType Type::newIntegerLikeType(int size, Sign signedness)
 }
 
 
+SharedType Type::meetWith(SharedType other, bool &changed, bool useHighestPtr) const
+{
+    TypeContext *context = TypeContext::getCurrent();
+
+    bool ch = false;
+    SharedType result;
+
+    if (context && context->lookupMeet(*this, *other, useHighestPtr, result, ch)) {
+        changed |= ch;
+        return result;
+    }
+
+    result = meetWithImpl(other, ch, useHighestPtr);
+
+    if (context) {
+        result = context->storeMeet(*this, *other, useHighestPtr, result, ch);
+    }
+
+    changed |= ch;
+    return result;
+}
+
+
 SharedType Type::createUnion(SharedType other, bool &changed, bool useHighestPtr) const
 {
     // `this' should not be a UnionType
@@ -81,6 +81,7 @@ public:
     TypeClass getId() const { return id; }
 
     /// Add a named ("typedef'd") type to the global type list.
+    /// The global type list can be accessed from multiple threads concurrently.
     static void addNamedType(const QString &name, SharedType type);
 
     /// \returns the actual type of the named type with name \p name
@@ -195,9 +196,11 @@ public:
      * then if this and other are non void* pointers, set the result to the
      * *highest* possible type compatible with both (i.e. this JOIN other)
      * \todo the best possible thing would be to have both types as const
+     *
+     * The meet itself is implemented by meetWithImpl. Meets of immutable types are memoized
+     * in the TypeContext of the current thread, if there is one.
      */
-    virtual SharedType meetWith(SharedType other, bool &changed,
-                                bool useHighestPtr = false) const = 0;
+    SharedType meetWith(SharedType other, bool &changed, bool useHighestPtr = false) const;
 
     /**
      * When all=false (default), return true if can use this and other interchangeably; in
@@ -225,6 +228,14 @@ public:
     /// union of pointers, return a new union with the dereference of all members. In dfa.cpp
     SharedType dereference();
 
+protected:
+    /**
+     * Implements the meet operator for this type (see meetWith).
+     * \p changed is false on entry.
+     */
+    virtual SharedType meetWithImpl(SharedType other, bool &changed,
+                                    bool useHighestPtr) const = 0;
+
 protected:
     TypeClass id;
 };
@@ -0,0 +1,161 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "TypeContext.h"
+
+#include "boomerang/ssl/type/IntegerType.h"
+#include "boomerang/ssl/type/PointerType.h"
+#include "boomerang/util/log/Log.h"
+
+
+static thread_local TypeContext *g_currentContext = nullptr;
+
+
+/**
+ * Computes a key that identifies the immutable type \p ty by structure.
+ * \returns false if \p ty is not immutable.
+ */
+static bool getTypeKey(const Type &ty, uint64 &key)
+{
+    // pointers to pointers to ... a primitive type
+    uint64 depth     = 0;
+    const Type *base = &ty;
+
+    while (base->isPointer()) {
+        if (++depth > 0xFF) {
+            return false;
+        }
+
+        base = static_cast<const PointerType *>(base)->getPointsTo().get();
+    }
+
+    uint64 size = 0;
+    uint64 sign = 0;
+
+    switch (base->getId()) {
+    case TypeClass::Void:
+    case TypeClass::Boolean:
+    case TypeClass::Char: break;
+
+    case TypeClass::Integer:
+        size = base->getSize();
+        sign = (int)static_cast<const IntegerType *>(base)->getSign() - (int)Sign::UnsignedStrong;
+        break;
+
+    case TypeClass::Float:
+    case TypeClass::Size: size = base->getSize(); break;
+
+    default: return false;
+    }
+
+    if (size > 0xFFFFFFFF) {
+        return false;
+    }
+
+    key = (depth << 48) | ((uint64)base->getId() << 40) | (sign << 32) | size;
+    return true;
+}
+
+
+TypeContext::Scope::Scope(TypeContext *context)
+    : m_prevContext(g_currentContext)
+{
+    g_currentContext = context;
+}
+
+
+TypeContext::Scope::~Scope()
+{
+    g_currentContext = m_prevContext;
+}
+
+
+TypeContext::TypeContext()
+{
+}
+
+
+TypeContext::~TypeContext()
+{
+}
+
+
+TypeContext *TypeContext::getCurrent()
+{
+    return g_currentContext;
+}
+
+
+SharedType TypeContext::intern(const SharedType &ty)
+{
+    uint64 key = 0;
+    if (!ty || !getTypeKey(*ty, key)) {
+        return ty;
+    }
+
+    return m_types.insert({ key, ty }).first->second;
+}
+
+
+bool TypeContext::lookupMeet(const Type &ty, const Type &other, bool useHighestPtr,
+                             SharedType &result, bool &changed)
+{
+    uint64 tyKey    = 0;
+    uint64 otherKey = 0;
+
+    if (!getTypeKey(ty, tyKey) || !getTypeKey(other, otherKey)) {
+        return false;
+    }
+
+    m_stats.numQueries++;
+
+    auto it = m_meets.find(MeetKey(tyKey, otherKey, useHighestPtr));
+    if (it == m_meets.end()) {
+        return false;
+    }
+
+    m_stats.numHits++;
+    result  = it->second.type;
+    changed = it->second.changed;
+    return true;
+}
+
+
+SharedType TypeContext::storeMeet(const Type &ty, const Type &other, bool useHighestPtr,
+                                  const SharedType &result, bool changed)
+{
+    uint64 tyKey     = 0;
+    uint64 otherKey  = 0;
+    uint64 resultKey = 0;
+
+    // Meets of different immutable types may result in a union, which is not immutable.
+    if (!getTypeKey(ty, tyKey) || !getTypeKey(other, otherKey) ||
+        !getTypeKey(*result, resultKey)) {
+        return result;
+    }
+
+    const SharedType canonical = m_types.insert({ resultKey, result }).first->second;
+    m_meets.insert({ MeetKey(tyKey, otherKey, useHighestPtr), { canonical, changed } });
+    return canonical;
+}
+
+
+void TypeContext::clear()
+{
+    m_types.clear();
+    m_meets.clear();
+    m_stats = Stats();
+}
+
+
+void TypeContext::logStats() const
+{
+    LOG_VERBOSE("Type statistics: %1 canonical types, %2 meets, %3 cache hits",
+                static_cast<uint64>(m_types.size()), m_stats.numQueries, m_stats.numHits);
+}
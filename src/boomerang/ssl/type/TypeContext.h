@@ -0,0 +1,124 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include "boomerang/core/BoomerangAPI.h"
+#include "boomerang/ssl/type/Type.h"
+#include "boomerang/util/Types.h"
+
+#include <map>
+#include <tuple>
+#include <unordered_map>
+
+
+/**
+ * Holds the canonical instances of the immutable types of a program
+ * and remembers the results of meets between them.
+ *
+ * Immutable types are the primitive types (void, bool, char, integer, float, size)
+ * and pointers to them. They are hash-consed by structure, so all structurally equal
+ * immutable types can share a single instance. Meets of two immutable types are memoized,
+ * since Type::meetWith is called for every statement in every iteration of the
+ * data flow based type analysis.
+ *
+ * Aggregate and named types are changed in place (e.g. by DataIntervalMap),
+ * so they are neither interned nor memoized.
+ *
+ * Each Prog has its own context, and a Prog is only analysed by one thread at a time,
+ * so the context is not locked. Type::meetWith uses the context installed for the current
+ * thread by a TypeContext::Scope (see PassManager::executePass).
+ */
+class BOOMERANG_API TypeContext
+{
+public:
+    /// Makes a context the current context of this thread for the lifetime of the scope.
+    class BOOMERANG_API Scope
+    {
+    public:
+        explicit Scope(TypeContext *context);
+        Scope(const Scope &other) = delete;
+        Scope(Scope &&other)      = delete;
+
+        ~Scope();
+
+        Scope &operator=(const Scope &other) = delete;
+        Scope &operator=(Scope &&other) = delete;
+
+    private:
+        TypeContext *m_prevContext;
+    };
+
+    struct Stats
+    {
+        uint64 numQueries = 0; ///< number of meets of two immutable types
+        uint64 numHits    = 0; ///< number of meets answered by the cache
+    };
+
+public:
+    TypeContext();
+    TypeContext(const TypeContext &other) = delete;
+    TypeContext(TypeContext &&other)      = delete;
+
+    ~TypeContext();
+
+    TypeContext &operator=(const TypeContext &other) = delete;
+    TypeContext &operator=(TypeContext &&other) = delete;
+
+public:
+    /// \returns the context of the current thread, or nullptr if there is none.
+    static TypeContext *getCurrent();
+
+    /**
+     * \returns the canonical instance of \p ty if \p ty is immutable, \p ty otherwise.
+     * The first immutable type of a given structure becomes its canonical instance.
+     */
+    SharedType intern(const SharedType &ty);
+
+    /**
+     * Look up the result of \p ty meet \p other.
+     * \param result  set to the result of the meet if it is in the cache.
+     * \param changed set to whether the meet changed \p ty.
+     * \returns true if the result is in the cache.
+     */
+    bool lookupMeet(const Type &ty, const Type &other, bool useHighestPtr, SharedType &result,
+                    bool &changed);
+
+    /**
+     * Remember that \p ty meet \p other is \p result.
+     * \returns the canonical instance of \p result.
+     */
+    SharedType storeMeet(const Type &ty, const Type &other, bool useHighestPtr,
+                         const SharedType &result, bool changed);
+
+    /// Drop all canonical types and meet results.
+    void clear();
+
+    Stats getStats() const { return m_stats; }
+
+    /// \returns the number of canonical types
+    std::size_t getNumTypes() const { return m_types.size(); }
+
+    void logStats() const;
+
+private:
+    struct MeetResult
+    {
+        SharedType type;
+        bool changed;
+    };
+
+    typedef std::tuple<uint64, uint64, bool> MeetKey;
+
+    /// Key is the structure of the type (see getTypeKey)
+    std::unordered_map<uint64, SharedType> m_types;
+    std::map<MeetKey, MeetResult> m_meets;
+    Stats m_stats;
+};
@@ -15,6 +15,8 @@
 
 #include <QHash>
 
+#include <atomic>
+
 
 size_t hashUnionElem::operator()(const UnionElement &e) const
 {
@@ -72,7 +74,10 @@ size_t UnionType::getSize() const
 
 bool UnionType::operator==(const Type &other) const
 {
-    if (!other.isUnion()) {
+    if (&other == this) {
+        return true;
+    }
+    else if (!other.isUnion()) {
         return false;
     }
 
@@ -153,9 +158,9 @@ QString UnionType::getCtype(bool final) const
 }
 
 
-static int nextUnionNumber = 0;
+static std::atomic<int> nextUnionNumber(0);
 
-SharedType UnionType::meetWith(SharedType other, bool &changed, bool useHighestPtr) const
+SharedType UnionType::meetWithImpl(SharedType other, bool &changed, bool useHighestPtr) const
 {
     if (other->resolvesToVoid()) {
         return const_cast<UnionType *>(this)->shared_from_this();
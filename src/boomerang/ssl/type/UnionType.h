@@ -91,9 +91,6 @@ public:
 
     virtual QString getCtype(bool final = false) const override;
 
-    /// \copydoc Type::meetWith
-    virtual SharedType meetWith(SharedType other, bool &changed, bool useHighestPtr) const override;
-
     virtual bool isCompatibleWith(const Type &other, bool all) const override
     {
         return isCompatible(other, all);
@@ -103,6 +100,11 @@ public:
     // if this is a union of pointer types, get the union of things they point to. In dfa.cpp
     SharedType dereferenceUnion();
 
+protected:
+    /// \copydoc Type::meetWithImpl
+    virtual SharedType meetWithImpl(SharedType other, bool &changed,
+                                    bool useHighestPtr) const override;
+
 private:
     // Note: list, not vector, as it is occasionally desirable to insert elements without affecting
     // iterators (e.g. meetWith(another Union))
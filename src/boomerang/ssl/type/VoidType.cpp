@@ -21,6 +21,13 @@ VoidType::~VoidType()
 }
 
 
+std::shared_ptr<VoidType> VoidType::get()
+{
+    static const std::shared_ptr<VoidType> instance = std::make_shared<VoidType>();
+    return instance;
+}
+
+
 SharedType VoidType::clone() const
 {
     return VoidType::get();
@@ -51,7 +58,7 @@ QString VoidType::getCtype(bool /*final*/) const
 }
 
 
-SharedType VoidType::meetWith(SharedType other, bool &changed, bool) const
+SharedType VoidType::meetWithImpl(SharedType other, bool &changed, bool) const
 {
     // void meet x = x
     changed |= !other->resolvesToVoid();
@@ -30,7 +30,8 @@ public:
 
     virtual SharedType clone() const override;
 
-    static std::shared_ptr<VoidType> get() { return std::make_shared<VoidType>(); }
+    /// \returns the shared, immutable instance of this type.
+    static std::shared_ptr<VoidType> get();
 
     virtual bool operator==(const Type &other) const override;
 
@@ -45,7 +46,10 @@ public:
      */
     virtual QString getCtype(bool final = false) const override;
 
-    /// \copydoc Type::meetWith
-    virtual SharedType meetWith(SharedType other, bool &changed, bool useHighestPtr) const override;
     virtual bool isCompatible(const Type &other, bool all) const override;
+
+protected:
+    /// \copydoc Type::meetWithImpl
+    virtual SharedType meetWithImpl(SharedType other, bool &changed,
+                                    bool useHighestPtr) const override;
 };
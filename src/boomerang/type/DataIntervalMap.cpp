@@ -103,7 +103,7 @@ DataIntervalMap::iterator DataIntervalMap::insertItem(Address baseAddr, QString
         if (it1->first.containsInterval(newTypeRange)) {
             if (newTypeRange.containsInterval(it1->first)) {
                 // both types are of equal size
-                bool changed;
+                bool changed = false;
                 it1->second.type = it1->second.type->meetWith(type, changed);
                 return it1;
             }
@@ -146,10 +146,14 @@ void DataIntervalMap::insertComponentType(TypedVariable *existingVar, Address ad
     assert(existingVar);
     assert(existingVar->baseAddr <= addr);
 
+    // Types are changed on a copy, since the existing type might be the definition
+    // of a named type, which is shared with other procedures and programs.
     if (existingVar->type->resolvesToCompound()) {
+        auto compound = std::static_pointer_cast<CompoundType>(
+            existingVar->type->as<CompoundType>()->clone());
+
         const uint64 bitOffset = (addr - existingVar->baseAddr).value() * 8;
-        SharedType memberType  = existingVar->type->as<CompoundType>()->getMemberTypeByOffset(
-            bitOffset);
+        SharedType memberType  = compound->getMemberTypeByOffset(bitOffset);
 
         if (!memberType || !memberType->isCompatibleWith(*type)) {
             LOG_ERROR("TYPE ERROR: At address %1 type %2 is not compatible with existing structure "
@@ -158,12 +162,16 @@ void DataIntervalMap::insertComponentType(TypedVariable *existingVar, Address ad
         }
 
         // types are compatible
-        bool ch;
+        bool ch = false;
         memberType = memberType->meetWith(type, ch);
-        existingVar->type->as<CompoundType>()->setMemberTypeByOffset(bitOffset, memberType);
+        compound->setMemberTypeByOffset(bitOffset, memberType);
+        existingVar->type = compound;
     }
     else if (existingVar->type->resolvesToArray()) {
-        SharedType baseType = existingVar->type->as<ArrayType>()->getBaseType();
+        auto array = std::static_pointer_cast<ArrayType>(
+            existingVar->type->as<ArrayType>()->clone());
+
+        SharedType baseType = array->getBaseType();
         assert(baseType);
 
         if (!baseType->isCompatibleWith(*type)) {
@@ -174,8 +182,9 @@ void DataIntervalMap::insertComponentType(TypedVariable *existingVar, Address ad
         }
 
         // types are compatible -> change it
-        bool ch;
-        existingVar->type->as<ArrayType>()->setBaseType(baseType->meetWith(type, ch));
+        bool ch = false;
+        array->setBaseType(baseType->meetWith(type, ch));
+        existingVar->type = array;
     }
     else {
         LOG_ERROR("TYPE ERROR: Existing type at address %1 is not structure or array type",
@@ -190,6 +199,14 @@ DataIntervalMap::iterator DataIntervalMap::replaceComponents(Address addr, const
     // This is the byte address just past the type to be inserted
     const Address endAddr = addr + ty->getSize() / 8;
 
+    // The members of ty are changed below, so change a copy (see insertComponentType)
+    if (ty->resolvesToCompound()) {
+        ty = ty->as<CompoundType>()->clone();
+    }
+    else if (ty->resolvesToArray()) {
+        ty = ty->as<ArrayType>()->clone();
+    }
+
     VariableMap::const_iterator it1, it2;
 
     // First check that the new entry will be compatible with everything it will overlap
@@ -211,7 +228,7 @@ DataIntervalMap::iterator DataIntervalMap::replaceComponents(Address addr, const
             LOG_VERBOSE("%1", this->prints());
             LOG_VERBOSE("%1 %2", memberType->getCtype(), it->second.type->getCtype());
 
-            bool ch;
+            bool ch = false;
             memberType = it->second.type->meetWith(memberType, ch);
             ty->as<CompoundType>()->setMemberTypeByOffset(bitOffset, memberType);
         }
@@ -222,7 +239,7 @@ DataIntervalMap::iterator DataIntervalMap::replaceComponents(Address addr, const
 
         for (VariableMap::const_iterator it = it1; it != it2; ++it) {
             if (memberType->isCompatibleWith(*it->second.type, true)) {
-                bool ch;
+                bool ch = false;
                 memberType = memberType->meetWith(it->second.type, ch);
                 ty->as<ArrayType>()->setBaseType(memberType);
             }
@@ -334,7 +351,8 @@ void DataIntervalMap::clearRange(const Interval<Address> &interval)
 
     std::tie(it, it2) = m_varMap.equalRange(interval);
 
-    while (it != it2) {
+    // Erasing invalidates it2, so count the variables instead
+    for (std::ptrdiff_t remaining = std::distance(it, it2); remaining > 0; --remaining) {
         TypedVariable &var = it->second;
         const Interval<Address> typeRange(var.baseAddr, var.baseAddr + 8 * var.size);
 
@@ -12,7 +12,7 @@
 
 #include "boomerang/ssl/type/Type.h"
 #include "boomerang/util/Address.h"
-#include "boomerang/util/IntervalMap.h"
+#include "boomerang/util/FlatIntervalMap.h"
 
 
 class QString;
@@ -51,7 +51,7 @@ struct TypedVariable
 class BOOMERANG_API DataIntervalMap
 {
 public:
-    typedef IntervalMap<Address, TypedVariable> VariableMap;
+    typedef FlatIntervalMap<Address, TypedVariable> VariableMap;
     typedef VariableMap::iterator iterator;
     typedef VariableMap::const_iterator const_iterator;
 
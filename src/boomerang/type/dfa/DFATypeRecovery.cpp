@@ -15,6 +15,7 @@
 #include "boomerang/db/Prog.h"
 #include "boomerang/db/proc/UserProc.h"
 #include "boomerang/db/signature/Signature.h"
+#include "boomerang/decomp/DecompilationBudget.h"
 #include "boomerang/passes/PassManager.h"
 #include "boomerang/ssl/exp/Const.h"
 #include "boomerang/ssl/exp/Location.h"
@@ -61,7 +62,7 @@ DFATypeRecovery::DFATypeRecovery()
 }
 
 
-void DFATypeRecovery::printResults(StatementList &stmts, int iter)
+void DFATypeRecovery::printResults(const std::vector<Statement *> &stmts, int iter)
 {
     LOG_VERBOSE("%1 iterations", iter);
 
@@ -210,6 +211,8 @@ void DFATypeRecovery::recoverFunctionTypes(Function *function)
     UserProc *up = dynamic_cast<UserProc *>(function);
     assert(up != nullptr);
 
+    DecompilationBudget *budget = function->getProg()->getProject()->getDecompilationBudget();
+
     do {
         if (first) {
             // Subscript the discovered extra parameters
@@ -224,7 +227,7 @@ void DFATypeRecovery::recoverFunctionTypes(Function *function)
         // There used to be a pass here to insert casts. This is best left until global type
         // analysis is complete, so do it just before translating from SSA form (which is the where
         // type information becomes inaccessible)
-    } while (doEllipsisProcessing(up));
+    } while (!budget->isExhausted(up) && doEllipsisProcessing(up));
 
     PassManager::get()->executePass(PassID::BBSimplify, up); // In case there are new struct members
 
@@ -243,10 +246,11 @@ void DFATypeRecovery::dfaTypeAnalysis(UserProc *proc)
     // Sometimes needed to split variables (e.g. argc as a
     // int and char* in sparc/switch_gcc)
     bool ch = dfaTypeAnalysis(proc->getSignature().get(), cfg);
-    StatementList stmts;
-    proc->getStatements(stmts);
+    // Implicit assignments are replaced while using the type information below
+    const std::vector<Statement *> stmts = proc->getStatements();
 
-    int iter = 0;
+    DecompilationBudget *budget = proc->getProg()->getProject()->getDecompilationBudget();
+    int iter                    = 0;
 
     for (iter = 1; iter <= DFA_ITER_LIMIT; ++iter) {
         ch = false;
@@ -282,9 +286,12 @@ void DFATypeRecovery::dfaTypeAnalysis(UserProc *proc)
             // No more changes: round robin algorithm terminates
             break;
         }
+        else if (budget->isExhausted(proc)) {
+            break;
+        }
     }
 
-    if (ch) {
+    if (ch && iter > DFA_ITER_LIMIT) {
         LOG_VERBOSE("Iteration limit exceeded for dfaTypeAnalysis of procedure '%1'",
                     proc->getName());
     }
@@ -544,7 +551,7 @@ bool DFATypeRecovery::doEllipsisProcessing(UserProc *proc)
 
     for (BasicBlock *bb : *proc->getCFG()) {
         BasicBlock::RTLRIterator rrit;
-        StatementList::reverse_iterator srit;
+        RTL::reverse_iterator srit;
         CallStatement *c = dynamic_cast<CallStatement *>(bb->getLastStmt(rrit, srit));
 
         // Note: we may have removed some statements, so there may no longer be a last statement!
@@ -12,11 +12,12 @@
 
 #include "boomerang/type/TypeRecovery.h"
 
+#include <vector>
+
 
 class ProcCFG;
 class Signature;
 class Statement;
-class StatementList;
 class UserProc;
 
 
@@ -44,7 +45,7 @@ private:
     bool dfaTypeAnalysis(Signature *signature, ProcCFG *cfg);
     bool dfaTypeAnalysis(Statement *stmt);
 
-    void printResults(StatementList &stmts, int iter);
+    void printResults(const std::vector<Statement *> &stmts, int iter);
 
     /// Replace array references of the form m[idx*K1 + K2]
     /// in \p s. Create global array variables as needed.
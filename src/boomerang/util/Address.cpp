@@ -16,7 +16,7 @@
 
 const Address Address::ZERO    = Address(0);
 const Address Address::INVALID = Address(static_cast<Address::value_type>(-1));
-Byte Address::m_sourceBits     = 32U;
+std::atomic<Byte> Address::m_sourceBits(32U);
 
 const HostAddress HostAddress::ZERO    = HostAddress(nullptr);
 const HostAddress HostAddress::INVALID = HostAddress(static_cast<HostAddress::value_type>(-1));
@@ -40,19 +40,19 @@ Address::Address(value_type _value)
 
 void Address::setSourceBits(Byte bitCount)
 {
-    m_sourceBits = bitCount;
+    m_sourceBits.store(bitCount, std::memory_order_relaxed);
 }
 
 
 QString Address::toString() const
 {
-    return QString("0x%1").arg(m_value, m_sourceBits / 4, 16, QChar('0'));
+    return QString("0x%1").arg(m_value, getSourceBits() / 4, 16, QChar('0'));
 }
 
 
 Address::value_type Address::getSourceMask()
 {
-    return Util::getLowerBitMask(m_sourceBits);
+    return Util::getLowerBitMask(getSourceBits());
 }
 
 
@@ -16,6 +16,8 @@
 
 #include <QString>
 
+#include <atomic>
+
 
 /// Standard pointer size of source machine, in bits
 #define STD_SIZE 32
@@ -43,7 +45,7 @@ public:
     /// Set the bit count of the source machine.
     static void setSourceBits(Byte bitCount = STD_SIZE);
 
-    static Byte getSourceBits() { return m_sourceBits; }
+    static Byte getSourceBits() { return m_sourceBits.load(std::memory_order_relaxed); }
     static value_type getSourceMask();
 
     Address native() const { return Address(m_value & 0xFFFFFFFF); }
@@ -122,8 +124,10 @@ public:
     QString toString() const;
 
 private:
-    static Byte m_sourceBits; ///< number of bits in a source address (typically 32 or 64 bits)
-    value_type m_value;       ///< Value of this address
+    /// number of bits in a source address (typically 32 or 64 bits)
+    static std::atomic<Byte> m_sourceBits;
+
+    value_type m_value; ///< Value of this address
 };
 
 /// Like \ref Address, but only for addresses of the host machine
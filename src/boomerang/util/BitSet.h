@@ -0,0 +1,148 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+/**
+ * A set of bits whose size is determined at runtime.
+ * Unlike std::vector<bool>, the set operations work on whole words,
+ * so combining two sets of n bits takes n/64 operations instead of n.
+ *
+ * \note The set operations require both sets to have the same size.
+ */
+class BitSet
+{
+    typedef uint64_t Word;
+    static constexpr std::size_t BITS_PER_WORD = 64;
+
+public:
+    BitSet() = default;
+
+    explicit BitSet(std::size_t numBits, bool value = false) { assign(numBits, value); }
+
+public:
+    /// \returns the number of bits in this set
+    std::size_t size() const { return m_numBits; }
+
+    /// Resize this set to \p numBits bits, all of which are set to \p value.
+    void assign(std::size_t numBits, bool value)
+    {
+        m_numBits = numBits;
+        m_words.assign((numBits + BITS_PER_WORD - 1) / BITS_PER_WORD, value ? ~Word(0) : Word(0));
+        clearUnusedBits();
+    }
+
+    bool test(std::size_t bit) const
+    {
+        assert(bit < m_numBits);
+        return (m_words[bit / BITS_PER_WORD] >> (bit % BITS_PER_WORD)) & 1;
+    }
+
+    void set(std::size_t bit)
+    {
+        assert(bit < m_numBits);
+        m_words[bit / BITS_PER_WORD] |= Word(1) << (bit % BITS_PER_WORD);
+    }
+
+    void reset(std::size_t bit)
+    {
+        assert(bit < m_numBits);
+        m_words[bit / BITS_PER_WORD] &= ~(Word(1) << (bit % BITS_PER_WORD));
+    }
+
+    /// Set all bits.
+    void setAll()
+    {
+        for (Word &word : m_words) {
+            word = ~Word(0);
+        }
+
+        clearUnusedBits();
+    }
+
+    /// Clear all bits.
+    void resetAll()
+    {
+        for (Word &word : m_words) {
+            word = 0;
+        }
+    }
+
+    /// \returns true if any bit is set.
+    bool any() const
+    {
+        for (const Word word : m_words) {
+            if (word != 0) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /// Set all bits that are set in \p other.
+    BitSet &operator|=(const BitSet &other)
+    {
+        assert(m_numBits == other.m_numBits);
+        for (std::size_t i = 0; i < m_words.size(); i++) {
+            m_words[i] |= other.m_words[i];
+        }
+
+        return *this;
+    }
+
+    /// Clear all bits that are not set in \p other.
+    BitSet &operator&=(const BitSet &other)
+    {
+        assert(m_numBits == other.m_numBits);
+        for (std::size_t i = 0; i < m_words.size(); i++) {
+            m_words[i] &= other.m_words[i];
+        }
+
+        return *this;
+    }
+
+    /// Clear all bits that are set in \p other.
+    BitSet &subtract(const BitSet &other)
+    {
+        assert(m_numBits == other.m_numBits);
+        for (std::size_t i = 0; i < m_words.size(); i++) {
+            m_words[i] &= ~other.m_words[i];
+        }
+
+        return *this;
+    }
+
+    bool operator==(const BitSet &other) const
+    {
+        return m_numBits == other.m_numBits && m_words == other.m_words;
+    }
+
+    bool operator!=(const BitSet &other) const { return !(*this == other); }
+
+private:
+    /// The bits after the last bit are always clear, so whole words can be compared.
+    void clearUnusedBits()
+    {
+        if (m_numBits % BITS_PER_WORD != 0) {
+            m_words.back() &= (Word(1) << (m_numBits % BITS_PER_WORD)) - 1;
+        }
+    }
+
+private:
+    std::size_t m_numBits = 0;
+    std::vector<Word> m_words;
+};
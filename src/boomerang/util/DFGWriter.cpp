@@ -30,10 +30,7 @@ void DFGWriter::printDFG(const UserProc *proc, const QString &fname)
     OStream out(&file);
     out << "digraph " << proc->getName() << " {\n";
     proc->numberStatements();
-    StatementList stmts;
-    proc->getStatements(stmts);
-
-    for (Statement *s : stmts) {
+    for (Statement *s : proc->getStatements()) {
         if (s->isPhi()) {
             out << s->getNumber() << " [shape=\"triangle\"];\n";
         }
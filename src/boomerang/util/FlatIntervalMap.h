@@ -0,0 +1,253 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include "boomerang/util/Interval.h"
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+
+/**
+ * A map that maps intervals of Key types to Value types, with the same interface
+ * and semantics as IntervalMap. Intervals may overlap each other.
+ *
+ * The intervals are stored in a vector sorted by lower bound instead of a tree,
+ * together with the running maximum of the upper bounds, so all lookups are binary searches
+ * over contiguous memory. Appending intervals in ascending order is amortized O(1);
+ * inserting or removing intervals elsewhere moves the intervals after them.
+ * This makes it a good fit for maps that are mostly built in order and queried often
+ * (e.g. the sections of a binary image).
+ *
+ * \note Unlike IntervalMap, inserting or removing elements invalidates iterators.
+ */
+template<typename Key, typename Value>
+class FlatIntervalMap
+{
+public:
+    typedef std::pair<Interval<Key>, Value> Element;
+    typedef std::vector<Element> Data;
+
+    typedef typename Data::iterator iterator;
+    typedef typename Data::const_iterator const_iterator;
+    typedef typename Data::reverse_iterator reverse_iterator;
+    typedef typename Data::const_reverse_iterator const_reverse_iterator;
+
+public:
+    iterator begin() { return m_data.begin(); }
+    iterator end() { return m_data.end(); }
+    const_iterator begin() const { return m_data.begin(); }
+    const_iterator end() const { return m_data.end(); }
+    reverse_iterator rbegin() { return m_data.rbegin(); }
+    reverse_iterator rend() { return m_data.rend(); }
+    const_reverse_iterator rbegin() const { return m_data.rbegin(); }
+    const_reverse_iterator rend() const { return m_data.rend(); }
+
+public:
+    /// \returns true if the map does not contain any elements.
+    bool isEmpty() const { return m_data.empty(); }
+
+    /// Remove all elements from this map.
+    void clear()
+    {
+        m_data.clear();
+        m_maxUpper.clear();
+    }
+
+    /// Reserve space for \p count intervals.
+    void reserve(std::size_t count)
+    {
+        m_data.reserve(count);
+        m_maxUpper.reserve(count);
+    }
+
+    /**
+     * Inserts an interval with a mapped value into this map.
+     * Like IntervalMap, insertion fails if there is already an interval
+     * with the same lower bound.
+     * \returns the inserted element, or end() on failure.
+     */
+    iterator insert(const Interval<Key> &key, Value value)
+    {
+        if (key.lower() >= key.upper()) {
+            return end(); // do not insert degenerate intervals
+        }
+
+        iterator it = lowerBound(key.lower());
+        if (it != end() && !(key.lower() < it->first.lower())) {
+            return end(); // interval with the same lower bound exists already
+        }
+
+        const std::size_t pos = std::distance(begin(), it);
+        m_data.insert(it, Element(key, std::move(value)));
+        updateMaxUpper(pos);
+
+        return begin() + pos;
+    }
+
+    iterator insert(const Key &lower, const Key &upper, Value value)
+    {
+        return insert(Interval<Key>(lower, upper), std::move(value));
+    }
+
+    /// Erase the item referenced by \p it
+    /// \returns an iterator to the element immediately after the deleted element
+    iterator erase(iterator it)
+    {
+        assert(it != end());
+        return erase(it, std::next(it));
+    }
+
+    /// Remove all intervals containing \p key
+    void eraseAll(const Key &key)
+    {
+        iterator first = find(key);
+
+        if (first == end()) {
+            return;
+        }
+
+        iterator last = std::next(first);
+        while (last != end() && last->first.contains(key)) {
+            ++last;
+        }
+
+        erase(first, last);
+    }
+
+    /// Remove all intervals overlapping with \p interval
+    void eraseAll(const Interval<Key> &interval)
+    {
+        iterator first, last;
+        std::tie(first, last) = equalRange(interval);
+
+        if (first != last) { // case first == last == end() accounted for
+            erase(first, last);
+        }
+    }
+
+    /**
+     * Finds the mapped value at \p key.
+     * If there are muliple candidate intervals,
+     * the interval with the lowest lower bound is retrieved.
+     */
+    const_iterator find(const Key &key) const { return begin() + findIndex(key); }
+    iterator find(const Key &key) { return begin() + findIndex(key); }
+
+    /**
+     * \returns an iterator range containing all intervals between \p lower and \p upper.
+     * If there are no intervals between lower and upper, the function returns (end(), end).
+     */
+    std::pair<const_iterator, const_iterator> equalRange(const Key &lower, const Key &upper) const
+    {
+        return equalRange(Interval<Key>(lower, upper));
+    }
+
+    std::pair<const_iterator, const_iterator> equalRange(const Interval<Key> &interval) const
+    {
+        const std::pair<std::size_t, std::size_t> range = equalRangeIndices(interval);
+        return { begin() + range.first, begin() + range.second };
+    }
+
+    std::pair<iterator, iterator> equalRange(const Key &lower, const Key &upper)
+    {
+        return equalRange(Interval<Key>(lower, upper));
+    }
+
+    std::pair<iterator, iterator> equalRange(const Interval<Key> &interval)
+    {
+        const std::pair<std::size_t, std::size_t> range = equalRangeIndices(interval);
+        return { begin() + range.first, begin() + range.second };
+    }
+
+private:
+    /// \returns the first element with a lower bound not less than \p lower
+    iterator lowerBound(const Key &lower)
+    {
+        return std::lower_bound(begin(), end(), lower, [](const Element &elem, const Key &k) {
+            return elem.first.lower() < k;
+        });
+    }
+
+    /// \returns the index of the first element with an upper bound greater than \p key.
+    /// All elements before it end at or before \p key.
+    std::size_t firstEndingAfter(const Key &key) const
+    {
+        return std::distance(m_maxUpper.begin(),
+                             std::upper_bound(m_maxUpper.begin(), m_maxUpper.end(), key));
+    }
+
+    std::size_t findIndex(const Key &key) const
+    {
+        const std::size_t idx = firstEndingAfter(key);
+
+        // m_data[idx] is the first interval that ends after key, so if it does not contain key,
+        // all later intervals start after key as well.
+        if (idx < m_data.size() && m_data[idx].first.lower() <= key) {
+            assert(m_data[idx].first.contains(key));
+            return idx;
+        }
+
+        return m_data.size();
+    }
+
+    std::pair<std::size_t, std::size_t> equalRangeIndices(const Interval<Key> &interval) const
+    {
+        const std::size_t none = m_data.size();
+
+        if (interval.lower() >= interval.upper()) {
+            return { none, none };
+        }
+
+        const std::size_t lowerIdx = firstEndingAfter(interval.lower());
+        if (lowerIdx == none || m_data[lowerIdx].first.lower() >= interval.upper()) {
+            return { none, none }; // no overlapping intervals
+        }
+
+        // we want to have the interval after the last interval overlapping
+        // with the desired interval
+        const_iterator upperIt = std::lower_bound(
+            begin() + lowerIdx + 1, end(), interval.upper(),
+            [](const Element &elem, const Key &k) { return elem.first.lower() < k; });
+
+        return { lowerIdx, static_cast<std::size_t>(std::distance(begin(), upperIt)) };
+    }
+
+    iterator erase(iterator first, iterator last)
+    {
+        const std::size_t pos = std::distance(begin(), first);
+        m_data.erase(first, last);
+        updateMaxUpper(pos);
+        return begin() + pos;
+    }
+
+    /// Recompute the running maximum of the upper bounds, starting at index \p from
+    void updateMaxUpper(std::size_t from)
+    {
+        m_maxUpper.erase(m_maxUpper.begin() + std::min(from, m_maxUpper.size()), m_maxUpper.end());
+
+        for (std::size_t i = from; i < m_data.size(); ++i) {
+            const Key &upper = m_data[i].first.upper();
+            m_maxUpper.push_back((i > 0 && upper < m_maxUpper[i - 1]) ? m_maxUpper[i - 1] : upper);
+        }
+    }
+
+private:
+    Data m_data; ///< All intervals, sorted by lower bound
+
+    /// m_maxUpper[i] is the highest upper bound of the intervals m_data[0] to m_data[i].
+    /// Unlike the upper bounds themselves, this is sorted even if intervals overlap.
+    std::vector<Key> m_maxUpper;
+};
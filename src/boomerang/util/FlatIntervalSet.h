@@ -0,0 +1,132 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include "boomerang/util/Interval.h"
+
+#include <algorithm>
+#include <iterator>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+
+/**
+ * A set of intervals with the same interface and semantics as IntervalSet;
+ * overlapping intervals are merged.
+ *
+ * The intervals are stored in a sorted vector instead of a tree. Since the intervals
+ * do not overlap, both their lower and their upper bounds are sorted, so all lookups are
+ * binary searches over contiguous memory. Appending intervals in ascending order
+ * is amortized O(1); inserting intervals elsewhere moves the intervals after them.
+ *
+ * \note Unlike IntervalSet, inserting elements invalidates iterators.
+ */
+template<typename T>
+class FlatIntervalSet
+{
+public:
+    typedef std::vector<Interval<T>> Data;
+
+    typedef typename Data::const_iterator iterator; ///< Intervals must not be modified in place
+    typedef typename Data::const_iterator const_iterator;
+    typedef typename Data::const_reverse_iterator reverse_iterator;
+    typedef typename Data::const_reverse_iterator const_reverse_iterator;
+
+public:
+    const_iterator begin() const { return m_data.begin(); }
+    const_iterator end() const { return m_data.end(); }
+    const_reverse_iterator rbegin() const { return m_data.rbegin(); }
+    const_reverse_iterator rend() const { return m_data.rend(); }
+
+public:
+    /// \returns true if the set does not contain any elements.
+    bool isEmpty() const { return m_data.empty(); }
+
+    /// Removes all intervals from the set.
+    void clear() { m_data.clear(); }
+
+    iterator insert(const T &from, const T &to) { return insert(Interval<T>(from, to)); }
+    iterator insert(const Interval<T> &interval)
+    {
+        if (interval.lower() >= interval.upper()) {
+            return end(); // Don't insert invalid intervals
+        }
+
+        iterator firstInRange, lastInRange;
+        std::tie(firstInRange, lastInRange) = equalRange(interval);
+
+        if (firstInRange == end()) {
+            // no overlapping intervals
+            return m_data.insert(upperBound(interval.lower()), interval);
+        }
+
+        // Merge all overlapping intervals into the first one
+        const T minLower = std::min(interval.lower(), firstInRange->lower());
+        const T maxUpper = std::max(interval.upper(), std::prev(lastInRange)->upper());
+
+        const std::size_t pos = std::distance(begin(), firstInRange);
+        m_data.erase(std::next(firstInRange), lastInRange);
+        m_data[pos] = Interval<T>(minLower, maxUpper);
+
+        return begin() + pos;
+    }
+
+    /**
+     * Returns an iterator range containing all intervals between \p lower and \p upper
+     */
+    std::pair<iterator, iterator> equalRange(const T &lower, const T &upper) const
+    {
+        return equalRange(Interval<T>(lower, upper));
+    }
+
+    std::pair<iterator, iterator> equalRange(const Interval<T> &interval) const
+    {
+        if (interval.lower() >= interval.upper()) {
+            return { end(), end() };
+        }
+
+        // first interval ending after the start of the range
+        const_iterator itLower = std::upper_bound(
+            begin(), end(), interval.lower(),
+            [](const T &value, const Interval<T> &elem) { return value < elem.upper(); });
+
+        if (itLower == end() || itLower->lower() >= interval.upper()) {
+            return { end(), end() }; // no blocking intervals
+        }
+
+        // first interval starting at or after the end of the range
+        const_iterator itUpper = std::lower_bound(
+            std::next(itLower), end(), interval.upper(),
+            [](const Interval<T> &elem, const T &value) { return elem.lower() < value; });
+
+        return { itLower, itUpper };
+    }
+
+    /// \returns true if \p value is contained in any interval of this set.
+    bool isContained(const T &value) const
+    {
+        const_iterator it = upperBound(value); // first interval starting after value
+        return it != begin() && std::prev(it)->contains(value);
+    }
+
+private:
+    /// \returns the first interval with a lower bound greater than \p value
+    const_iterator upperBound(const T &value) const
+    {
+        return std::upper_bound(
+            begin(), end(), value,
+            [](const T &val, const Interval<T> &elem) { return val < elem.lower(); });
+    }
+
+private:
+    Data m_data; ///< Disjoint intervals, sorted by lower bound
+};
@@ -0,0 +1,124 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include "boomerang/util/SmallVector.h"
+
+#include <algorithm>
+#include <utility>
+
+
+/**
+ * A sorted set that stores its elements in a contiguous array instead of a tree.
+ * Up to \p N elements are stored inside the object itself (see SmallVector).
+ *
+ * Lookups are binary searches; insertions and removals move the elements after
+ * the insertion or removal point. For small sets this is much cheaper
+ * than the node allocations and pointer chasing of std::set.
+ *
+ * \note Unlike std::set, inserting or removing elements invalidates iterators.
+ *
+ * \tparam T       the type of the elements
+ * \tparam Compare Binary functor type that defines the sorting order.
+ * \tparam N       Maximum number of elements stored without heap allocation
+ */
+template<typename T, typename Compare, std::size_t N = 8>
+class FlatSet
+{
+    typedef SmallVector<T, N> Storage;
+
+public:
+    typedef T value_type;
+    typedef typename Storage::const_iterator iterator; ///< Elements must not be modified in place
+    typedef typename Storage::const_iterator const_iterator;
+
+public:
+    const_iterator begin() const { return m_elems.begin(); }
+    const_iterator end() const { return m_elems.end(); }
+
+public:
+    bool empty() const { return m_elems.empty(); }
+    int size() const { return static_cast<int>(m_elems.size()); }
+    void clear() { m_elems.clear(); }
+
+    /**
+     * Insert \p value, unless an equivalent element exists already.
+     * \returns the element equivalent to \p value and true if \p value was inserted.
+     */
+    std::pair<iterator, bool> insert(const T &value)
+    {
+        const_iterator it = lowerBound(value);
+
+        if (it != end() && !Compare()(value, *it)) {
+            return { it, false };
+        }
+
+        return { m_elems.insert(it, value), true };
+    }
+
+    /// \returns the element equivalent to \p value, or end() if not found.
+    const_iterator find(const T &value) const
+    {
+        const_iterator it = lowerBound(value);
+        return (it != end() && !Compare()(value, *it)) ? it : end();
+    }
+
+    /**
+     * Binary search by a key other than the element type.
+     * \param less Binary functor that returns true if the element passed as first argument
+     *             is ordered before the key passed as second argument.
+     *             The order must be compatible with the order of Compare.
+     * \returns the first element that is not ordered before \p key, or end().
+     */
+    template<typename Key, typename KeyCompare>
+    const_iterator lowerBound(const Key &key, KeyCompare less) const
+    {
+        return std::lower_bound(begin(), end(), key, less);
+    }
+
+    bool contains(const T &value) const { return find(value) != end(); }
+
+    /// Remove the element at \p it.
+    /// \returns an iterator to the element after the removed element.
+    iterator erase(const_iterator it) { return m_elems.erase(it); }
+
+    /// Remove the element equivalent to \p value, if any.
+    /// \returns true if an element was removed.
+    bool remove(const T &value)
+    {
+        const_iterator it = find(value);
+
+        if (it == end()) {
+            return false;
+        }
+
+        m_elems.erase(it);
+        return true;
+    }
+
+    /**
+     * Re-establish the order of the elements after the elements were modified
+     * (e.g. by a search and replace on the elements of a set of expressions).
+     * Unlike std::set, duplicate elements are kept in this case.
+     */
+    void sort()
+    {
+        if (!std::is_sorted(m_elems.begin(), m_elems.end(), Compare())) {
+            std::stable_sort(m_elems.begin(), m_elems.end(), Compare());
+        }
+    }
+
+private:
+    const_iterator lowerBound(const T &value) const { return lowerBound(value, Compare()); }
+
+private:
+    Storage m_elems;
+};
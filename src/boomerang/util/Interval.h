@@ -40,8 +40,8 @@ public:
 
     const Interval<T> &operator=(const Interval<T> &other)
     {
-        m_lower(other.lower());
-        m_upper(other.upper());
+        m_lower = other.m_lower;
+        m_upper = other.m_upper;
         return *this;
     }
 
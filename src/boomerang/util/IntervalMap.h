@@ -159,23 +159,7 @@ public:
 
     std::pair<const_iterator, const_iterator> equalRange(const Interval<Key> &interval) const
     {
-        const_iterator itLower = end();
-        const_iterator itUpper = end();
-
-        // todo: speed up
-        for (const_iterator it = begin(); it != end(); ++it) {
-            if ((it->first.upper() > interval.lower()) && (itLower == end())) {
-                itLower = it;
-            }
-
-            // we want to have the interval after the last interval overlapping
-            // with the desired interval
-            if ((itLower != end()) && (it->first.lower() >= interval.upper())) {
-                itUpper = it;
-            }
-        }
-
-        return std::make_pair(itLower, itUpper);
+        return const_cast<IntervalMap *>(this)->equalRange(interval);
     }
 
     std::pair<iterator, iterator> equalRange(const Key &lower, const Key &upper)
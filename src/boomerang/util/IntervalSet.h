@@ -60,10 +60,9 @@ public:
         T maxUpper = interval.upper();
 
         if (firstInRange != m_data.end()) {
+            // lastInRange is the first interval after the overlapping intervals
             minLower = std::min(minLower, firstInRange->lower());
-        }
-        if (lastInRange != m_data.end()) {
-            maxUpper = std::max(maxUpper, lastInRange->upper());
+            maxUpper = std::max(maxUpper, std::prev(lastInRange)->upper());
         }
 
         typename Data::iterator it = m_data.erase(firstInRange, lastInRange);
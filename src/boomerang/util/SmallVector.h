@@ -0,0 +1,360 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+
+/**
+ * A vector that stores up to \p N elements inside the object itself.
+ * Only when more than \p N elements are stored, the elements are moved to the heap.
+ * This avoids heap allocations for the many small containers of the decompiler
+ * (e.g. the collectors of call statements, which mostly contain 1 to 8 elements).
+ *
+ * \note Unlike std::vector, moving a SmallVector invalidates all iterators
+ * if the elements are stored inline.
+ */
+template<typename T, std::size_t N>
+class SmallVector
+{
+    static_assert(N > 0, "Use std::vector for vectors without inline storage");
+
+public:
+    typedef T value_type;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef T &reference;
+    typedef const T &const_reference;
+    typedef T *pointer;
+    typedef const T *const_pointer;
+    typedef T *iterator;
+    typedef const T *const_iterator;
+    typedef std::reverse_iterator<iterator> reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+public:
+    SmallVector()
+        : m_data(inlineData())
+    {
+    }
+
+    SmallVector(std::initializer_list<T> init)
+        : SmallVector()
+    {
+        assign(init.begin(), init.end());
+    }
+
+    template<typename InputIt,
+             typename = typename std::iterator_traits<InputIt>::iterator_category>
+    SmallVector(InputIt first, InputIt last)
+        : SmallVector()
+    {
+        assign(first, last);
+    }
+
+    SmallVector(const SmallVector &other)
+        : SmallVector()
+    {
+        assign(other.begin(), other.end());
+    }
+
+    SmallVector(SmallVector &&other) noexcept(std::is_nothrow_move_constructible<T>::value)
+        : SmallVector()
+    {
+        takeFrom(std::move(other));
+    }
+
+    ~SmallVector()
+    {
+        clear();
+        freeHeap();
+    }
+
+    SmallVector &operator=(const SmallVector &other)
+    {
+        if (&other != this) {
+            assign(other.begin(), other.end());
+        }
+
+        return *this;
+    }
+
+    SmallVector &operator=(SmallVector &&other) noexcept(
+        std::is_nothrow_move_constructible<T>::value)
+    {
+        if (&other != this) {
+            clear();
+            takeFrom(std::move(other));
+        }
+
+        return *this;
+    }
+
+    SmallVector &operator=(std::initializer_list<T> init)
+    {
+        assign(init.begin(), init.end());
+        return *this;
+    }
+
+public:
+    bool operator==(const SmallVector &other) const
+    {
+        return std::equal(begin(), end(), other.begin(), other.end());
+    }
+
+    bool operator!=(const SmallVector &other) const { return !(*this == other); }
+
+public:
+    iterator begin() { return m_data; }
+    iterator end() { return m_data + m_size; }
+    const_iterator begin() const { return m_data; }
+    const_iterator end() const { return m_data + m_size; }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+public:
+    bool empty() const { return m_size == 0; }
+    size_type size() const { return m_size; }
+    size_type capacity() const { return m_capacity; }
+
+    /// \returns true if the elements are stored inside this object.
+    bool isInline() const { return m_data == inlineData(); }
+
+    T *data() { return m_data; }
+    const T *data() const { return m_data; }
+
+    T &operator[](size_type idx)
+    {
+        assert(idx < m_size);
+        return m_data[idx];
+    }
+
+    const T &operator[](size_type idx) const
+    {
+        assert(idx < m_size);
+        return m_data[idx];
+    }
+
+    T &front() { return (*this)[0]; }
+    const T &front() const { return (*this)[0]; }
+    T &back() { return (*this)[m_size - 1]; }
+    const T &back() const { return (*this)[m_size - 1]; }
+
+public:
+    void reserve(size_type newCapacity)
+    {
+        if (newCapacity > m_capacity) {
+            grow(newCapacity);
+        }
+    }
+
+    void clear()
+    {
+        destroy(begin(), end());
+        m_size = 0;
+    }
+
+    template<typename InputIt>
+    void assign(InputIt first, InputIt last)
+    {
+        clear();
+
+        if constexpr (std::is_base_of<
+                          std::forward_iterator_tag,
+                          typename std::iterator_traits<InputIt>::iterator_category>::value) {
+            reserve(std::distance(first, last));
+        }
+
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+    }
+
+    void push_back(const T &value) { emplace_back(value); }
+    void push_back(T &&value) { emplace_back(std::move(value)); }
+
+    template<typename... Args>
+    T &emplace_back(Args &&... args)
+    {
+        if (m_size == m_capacity) {
+            // construct first, \p args might refer to an element of this vector
+            T tmp(std::forward<Args>(args)...);
+            grow(m_capacity * 2);
+            new (end()) T(std::move(tmp));
+        }
+        else {
+            new (end()) T(std::forward<Args>(args)...);
+        }
+
+        return m_data[m_size++];
+    }
+
+    void pop_back()
+    {
+        assert(!empty());
+        m_size--;
+        end()->~T();
+    }
+
+    void resize(size_type newSize)
+    {
+        if (newSize < m_size) {
+            destroy(begin() + newSize, end());
+            m_size = static_cast<unsigned int>(newSize);
+            return;
+        }
+
+        reserve(newSize);
+        while (m_size < newSize) {
+            emplace_back();
+        }
+    }
+
+    /// Insert \p value before \p pos.
+    /// \returns an iterator to the inserted element.
+    iterator insert(const_iterator pos, T value)
+    {
+        const size_type idx = pos - begin();
+        assert(idx <= m_size);
+
+        if (idx == m_size) {
+            emplace_back(std::move(value));
+            return begin() + idx;
+        }
+
+        if (m_size == m_capacity) {
+            grow(m_capacity * 2);
+        }
+
+        new (end()) T(std::move(back()));
+        std::move_backward(begin() + idx, end() - 1, end());
+        m_size++;
+
+        m_data[idx] = std::move(value);
+        return begin() + idx;
+    }
+
+    /// Insert the elements in [first, last) before \p pos.
+    /// The elements must not be elements of this vector.
+    /// \returns an iterator to the first inserted element.
+    template<typename InputIt,
+             typename = typename std::iterator_traits<InputIt>::iterator_category>
+    iterator insert(const_iterator pos, InputIt first, InputIt last)
+    {
+        const size_type idx = pos - begin();
+        assert(idx <= m_size);
+
+        // Append the new elements, then rotate them into place
+        const size_type oldSize = m_size;
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+
+        std::rotate(begin() + idx, begin() + oldSize, end());
+        return begin() + idx;
+    }
+
+    /// Remove the element at \p pos.
+    /// \returns an iterator to the element after the removed element.
+    iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+
+    /// Remove the elements in [first, last).
+    /// \returns an iterator to the element after the last removed element.
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        iterator dest = begin() + (first - begin());
+        iterator src  = begin() + (last - begin());
+
+        if (src != dest) {
+            iterator newEnd = std::move(src, end(), dest);
+            destroy(newEnd, end());
+            m_size = static_cast<unsigned int>(newEnd - begin());
+        }
+
+        return dest;
+    }
+
+private:
+    T *inlineData() { return reinterpret_cast<T *>(&m_inline); }
+    const T *inlineData() const { return reinterpret_cast<const T *>(&m_inline); }
+
+    static void destroy(T *first, T *last)
+    {
+        for (; first != last; ++first) {
+            first->~T();
+        }
+    }
+
+    void freeHeap()
+    {
+        if (!isInline()) {
+            ::operator delete(m_data);
+            m_data     = inlineData();
+            m_capacity = N;
+        }
+    }
+
+    /// Move all elements to a new heap buffer that can hold at least \p minCapacity elements.
+    void grow(size_type minCapacity)
+    {
+        const size_type newCapacity = std::max<size_type>(minCapacity, N + 1);
+        T *newData = static_cast<T *>(::operator new(newCapacity * sizeof(T)));
+
+        std::uninitialized_move(begin(), end(), newData);
+        destroy(begin(), end());
+        freeHeap();
+
+        m_data     = newData;
+        m_capacity = static_cast<unsigned int>(newCapacity);
+    }
+
+    /// Move the contents of \p other into this empty vector.
+    void takeFrom(SmallVector &&other)
+    {
+        assert(empty());
+
+        if (!other.isInline()) {
+            // steal the heap buffer
+            freeHeap();
+            m_data           = other.m_data;
+            m_size           = other.m_size;
+            m_capacity       = other.m_capacity;
+            other.m_data     = other.inlineData();
+            other.m_size     = 0;
+            other.m_capacity = N;
+            return;
+        }
+
+        reserve(other.size());
+        std::uninitialized_move(other.begin(), other.end(), begin());
+        m_size = other.m_size;
+        other.clear();
+    }
+
+private:
+    T *m_data;
+    unsigned int m_size     = 0;
+    unsigned int m_capacity = N;
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type m_inline[N];
+};
@@ -32,10 +32,7 @@ void UseGraphWriter::writeUseGraph(const UserProc *proc, const QString &filePath
 
     OStream out(&file);
     out << "digraph " << proc->getName() << " {\n";
-    StatementList stmts;
-    proc->getStatements(stmts);
-
-    for (Statement *s : stmts) {
+    for (Statement *s : proc->getStatements()) {
         if (s->isPhi()) {
             out << s->getNumber() << " [shape=diamond];\n";
         }
@@ -22,9 +22,6 @@
 #include <QFileInfo>
 
 
-static Log *g_log = nullptr;
-
-
 Log::Log(LogLevel level)
     : m_fileNameOffset(0)
     , m_level(level)
@@ -47,16 +44,16 @@ Log::~Log()
 
 Log &Log::getOrCreateLog()
 {
-    if (!g_log) {
-        g_log = new Log(LogLevel::Default);
-    }
-
-    return *g_log;
+    // Never destroyed, so the log can still be used while static objects are destroyed.
+    static Log *log = new Log(LogLevel::Default);
+    return *log;
 }
 
 
 void Log::flush()
 {
+    std::lock_guard<std::recursive_mutex> lock(m_sinkMutex);
+
     for (std::unique_ptr<ILogSink> &s : m_sinks) {
         s->flush();
     }
@@ -67,6 +64,9 @@ void Log::log(LogLevel level, const char *file, int line, const QString &msg)
 {
     const QStringList msgLines = msg.split('\n');
 
+    // Do not interleave the lines of this message with messages of other threads
+    std::lock_guard<std::recursive_mutex> lock(m_sinkMutex);
+
     for (const QString &msgLine : msgLines) {
         logDirect(level, file, line, msgLine);
     }
@@ -86,6 +86,8 @@ void Log::logDirect(LogLevel level, const char *file, int line, const QString &m
 
     QString header  = "%1 | %2 | %3 | %4\n";
     QString logLine = header.arg(levelToString(level)).arg(prettyFile).arg(line, 4).arg(msg);
+
+    std::lock_guard<std::recursive_mutex> lock(m_sinkMutex);
     this->write(logLine);
 
     if (level == LogLevel::Fatal) {
@@ -98,6 +100,8 @@ void Log::addLogSink(std::unique_ptr<ILogSink> s)
 {
     assert(s != nullptr);
 
+    std::lock_guard<std::recursive_mutex> lock(m_sinkMutex);
+
     if (std::find(m_sinks.begin(), m_sinks.end(), s) == m_sinks.end()) {
         m_sinks.push_back(std::move(s));
     }
@@ -106,6 +110,8 @@ void Log::addLogSink(std::unique_ptr<ILogSink> s)
 
 void Log::addDefaultLogSinks(const QString &outputDir)
 {
+    std::lock_guard<std::recursive_mutex> lock(m_sinkMutex);
+
     addLogSink(std::make_unique<ConsoleLogSink>());
 
     QFileInfo fi(QDir(outputDir), "boomerang.log");
@@ -117,8 +123,9 @@ void Log::addDefaultLogSinks(const QString &outputDir)
 
 void Log::removeAllSinks()
 {
-    flush();
+    std::lock_guard<std::recursive_mutex> lock(m_sinkMutex);
 
+    flush();
     m_sinks.clear();
 }
 
@@ -144,6 +151,8 @@ bool Log::canLog(LogLevel level) const
 
 void Log::writeLogHeader()
 {
+    std::lock_guard<std::recursive_mutex> lock(m_sinkMutex);
+
     this->write("Level | File                                    | Line | Message\n");
     this->write(QString(100, '=') + "\n");
 
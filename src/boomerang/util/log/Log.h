@@ -13,7 +13,9 @@
 #include "boomerang/util/Address.h"
 #include "boomerang/util/Types.h"
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 
@@ -49,6 +51,8 @@ enum class LogLevel
  * Log messages have different levels (see \ref LogLevel).
  * The default behavior is to omit verbose log messages from being logged;
  * this behavior can be overridden by calling \ref setLogLevel.
+ *
+ * Logs can be used from multiple threads concurrently; each message is written atomically.
  */
 class BOOMERANG_API Log
 {
@@ -193,8 +197,12 @@ private:
      * to have a sensible file name
      */
     size_t m_fileNameOffset;
-    LogLevel m_level = LogLevel::Default;
+    std::atomic<LogLevel> m_level;
     std::vector<std::unique_ptr<ILogSink>> m_sinks;
+
+    /// Serializes access to the sinks. Recursive, since sinks may be written to
+    /// while a message is being logged (e.g. the log header).
+    std::recursive_mutex m_sinkMutex;
 };
 
 
@@ -35,7 +35,6 @@ static SharedExp checkSignedness(SharedExp e, Sign reqSignedness)
         std::shared_ptr<IntegerType> newtype = IntegerType::get(
             std::static_pointer_cast<const IntegerType>(ty)->getSize(), reqSignedness);
 
-        newtype->setSignedness(reqSignedness);
         return std::make_shared<TypedExp>(newtype, e);
     }
 
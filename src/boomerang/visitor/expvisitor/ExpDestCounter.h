@@ -13,7 +13,7 @@
 #include "boomerang/ssl/exp/ExpHelp.h"
 #include "boomerang/visitor/expvisitor/ExpVisitor.h"
 
-#include <map>
+#include <unordered_map>
 
 
 /**
@@ -23,7 +23,7 @@
 class ExpDestCounter : public ExpVisitor
 {
 public:
-    typedef std::map<SharedExp, int, lessExpStar> ExpCountMap;
+    typedef std::unordered_map<SharedExp, int, hashExpStar, equalExpStar> ExpCountMap;
 
 public:
     ExpDestCounter(ExpCountMap &dc);
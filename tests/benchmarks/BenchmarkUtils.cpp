@@ -0,0 +1,95 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "BenchmarkUtils.h"
+
+
+#include "boomerang/core/Settings.h"
+#include "boomerang/db/Prog.h"
+#include "boomerang/db/module/Module.h"
+#include "boomerang/db/proc/ProcCFG.h"
+#include "boomerang/db/proc/UserProc.h"
+#include "boomerang/util/log/Log.h"
+
+#include <cstdlib>
+#include <iostream>
+
+
+BenchmarkProject::BenchmarkProject()
+{
+    getSettings()->setDataDirectory(BOOMERANG_TEST_BASE "share/boomerang/");
+    getSettings()->setPluginDirectory(BOOMERANG_TEST_BASE "lib/boomerang/plugins/");
+    loadPlugins();
+}
+
+
+QString getFullSamplePath(const QString &relpath)
+{
+    return QString(BOOMERANG_TEST_BASE) + "share/boomerang/samples/" + relpath;
+}
+
+
+QString getFullSSLPath(const QString &relpath)
+{
+    return QString(BOOMERANG_TEST_BASE) + "share/boomerang/ssl/" + relpath;
+}
+
+
+void loadAndDecodeSample(Project &project, const QString &relpath)
+{
+    if (!project.loadBinaryFile(getFullSamplePath(relpath)) || !project.decodeBinaryFile()) {
+        std::cerr << "Cannot load sample '" << qPrintable(relpath) << "'" << std::endl;
+        std::abort();
+    }
+}
+
+
+std::vector<UserProc *> getUserProcs(Project &project)
+{
+    std::vector<UserProc *> procs;
+
+    for (const auto &module : project.getProg()->getModuleList()) {
+        for (Function *function : *module) {
+            if (!function->isLib() && static_cast<UserProc *>(function)->isDecoded()) {
+                procs.push_back(static_cast<UserProc *>(function));
+            }
+        }
+    }
+
+    return procs;
+}
+
+
+UserProc *getLargestUserProc(Project &project)
+{
+    UserProc *largest = nullptr;
+
+    for (UserProc *proc : getUserProcs(project)) {
+        if (!largest || proc->getCFG()->getNumBBs() > largest->getCFG()->getNumBBs()) {
+            largest = proc;
+        }
+    }
+
+    return largest;
+}
+
+
+int main(int argc, char *argv[])
+{
+    // Keep the log quiet, formatting log messages would dominate the timings otherwise.
+    Log::getOrCreateLog().setLogLevel(LogLevel::Error);
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
@@ -0,0 +1,51 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include "boomerang/core/Project.h"
+
+#include <benchmark/benchmark.h>
+
+#include <QString>
+
+#include <vector>
+
+
+class UserProc;
+
+
+/// A Project that loads its plugins and data files from the build output directory.
+class BenchmarkProject : public Project
+{
+public:
+    BenchmarkProject();
+};
+
+
+/// \returns the full absolute path given a path
+// relative to the data/samples/ directory
+QString getFullSamplePath(const QString &relpath);
+
+/// \returns the full absolute path given a path
+// relative to the data/ssl/ directory
+QString getFullSSLPath(const QString &relpath);
+
+/**
+ * Load and decode the sample binary at \p relpath (relative to data/samples/).
+ * Aborts the benchmark run if the sample cannot be loaded or decoded.
+ */
+void loadAndDecodeSample(Project &project, const QString &relpath);
+
+/// \returns all decoded user procedures of the program loaded by \p project
+std::vector<UserProc *> getUserProcs(Project &project);
+
+/// \returns the decoded user procedure with the most basic blocks
+UserProc *getLargestUserProc(Project &project);
@@ -0,0 +1,156 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "BenchmarkUtils.h"
+
+
+#include "boomerang/db/binary/BinarySymbol.h"
+#include "boomerang/db/binary/BinarySymbolTable.h"
+
+#include <algorithm>
+#include <random>
+
+
+/// Create \p count symbols with C++ mangled names, 16 bytes apart, sorted by address
+static std::vector<BinarySymbolDefinition> makeSymbols(int count)
+{
+    std::vector<BinarySymbolDefinition> defs;
+    defs.reserve(count);
+
+    for (int i = 0; i < count; i++) {
+        defs.push_back({ Address(0x08048000 + 16 * i),
+                         QString("_ZN5boost6detail8function13invoker%1E4callEv").arg(i), false });
+    }
+
+    return defs;
+}
+
+
+/// \returns the symbols of \p defs in random (but reproducible) order
+static std::vector<BinarySymbolDefinition> shuffled(std::vector<BinarySymbolDefinition> defs)
+{
+    std::mt19937 rng(42);
+    std::shuffle(defs.begin(), defs.end(), rng);
+    return defs;
+}
+
+
+static void BM_SymbolTableCreateSymbol(benchmark::State &state)
+{
+    const std::vector<BinarySymbolDefinition> defs = shuffled(makeSymbols(state.range(0)));
+
+    for (auto _ : state) {
+        BinarySymbolTable tbl;
+        for (const BinarySymbolDefinition &def : defs) {
+            tbl.createSymbol(def.addr, def.name, def.local);
+        }
+
+        benchmark::DoNotOptimize(tbl.findNearestSymbol(Address(0x08048000)));
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SymbolTableCreateSymbol)->RangeMultiplier(8)->Range(1 << 10, 1 << 19);
+
+
+static void BM_SymbolTableCreateSymbols(benchmark::State &state)
+{
+    const std::vector<BinarySymbolDefinition> defs = makeSymbols(state.range(0));
+
+    for (auto _ : state) {
+        BinarySymbolTable tbl;
+        tbl.createSymbols(defs);
+
+        benchmark::DoNotOptimize(tbl.findNearestSymbol(Address(0x08048000)));
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SymbolTableCreateSymbols)->RangeMultiplier(8)->Range(1 << 10, 1 << 19);
+
+
+static void BM_SymbolTableCreateSymbolsUnsorted(benchmark::State &state)
+{
+    const std::vector<BinarySymbolDefinition> defs = shuffled(makeSymbols(state.range(0)));
+
+    for (auto _ : state) {
+        BinarySymbolTable tbl;
+        tbl.createSymbols(defs);
+
+        benchmark::DoNotOptimize(tbl.findNearestSymbol(Address(0x08048000)));
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SymbolTableCreateSymbolsUnsorted)->RangeMultiplier(8)->Range(1 << 10, 1 << 19);
+
+
+static void BM_SymbolTableFindByAddress(benchmark::State &state)
+{
+    const std::vector<BinarySymbolDefinition> defs = makeSymbols(state.range(0));
+    BinarySymbolTable tbl;
+    tbl.createSymbols(defs);
+
+    const std::vector<BinarySymbolDefinition> queries = shuffled(defs);
+
+    for (auto _ : state) {
+        for (const BinarySymbolDefinition &query : queries) {
+            benchmark::DoNotOptimize(tbl.findSymbolByAddress(query.addr));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SymbolTableFindByAddress)->RangeMultiplier(8)->Range(1 << 10, 1 << 19);
+
+
+static void BM_SymbolTableFindByName(benchmark::State &state)
+{
+    const std::vector<BinarySymbolDefinition> defs = makeSymbols(state.range(0));
+    BinarySymbolTable tbl;
+    tbl.createSymbols(defs);
+
+    // look up deep copies so that we do not measure comparisons of shared strings
+    std::vector<QString> queries;
+    for (const BinarySymbolDefinition &def : shuffled(defs)) {
+        queries.push_back(QString(def.name.constData(), def.name.size()));
+    }
+
+    for (auto _ : state) {
+        for (const QString &query : queries) {
+            benchmark::DoNotOptimize(tbl.findSymbolByName(query));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SymbolTableFindByName)->RangeMultiplier(8)->Range(1 << 10, 1 << 19);
+
+
+static void BM_SymbolTableFindNearest(benchmark::State &state)
+{
+    const std::vector<BinarySymbolDefinition> defs = makeSymbols(state.range(0));
+    BinarySymbolTable tbl;
+    tbl.createSymbols(defs);
+
+    // addresses inside the symbols, not at their start
+    std::vector<Address> queries;
+    for (const BinarySymbolDefinition &def : shuffled(defs)) {
+        queries.push_back(def.addr + 7);
+    }
+
+    for (auto _ : state) {
+        for (Address query : queries) {
+            benchmark::DoNotOptimize(tbl.findNearestSymbol(query));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SymbolTableFindNearest)->RangeMultiplier(8)->Range(1 << 10, 1 << 19);
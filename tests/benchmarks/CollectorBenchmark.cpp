@@ -0,0 +1,143 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "BenchmarkUtils.h"
+
+
+#include "boomerang/db/DefCollector.h"
+#include "boomerang/db/UseCollector.h"
+#include "boomerang/ssl/exp/Binary.h"
+#include "boomerang/ssl/exp/Const.h"
+#include "boomerang/ssl/exp/Location.h"
+#include "boomerang/ssl/exp/RefExp.h"
+#include "boomerang/ssl/statements/Assign.h"
+#include "boomerang/ssl/statements/CallStatement.h"
+
+
+/// Create \p count distinct locations: registers first, then stack locations m[r28{-} - K]
+static std::vector<SharedExp> makeLocations(int count)
+{
+    std::vector<SharedExp> locs;
+    locs.reserve(count);
+
+    for (int i = 0; i < count; i++) {
+        if (i < 32) {
+            locs.push_back(Location::regOf(i));
+        }
+        else {
+            locs.push_back(Location::memOf(Binary::get(
+                opMinus, RefExp::get(Location::regOf(REG_PENT_ESP), nullptr), Const::get(4 * i))));
+        }
+    }
+
+    return locs;
+}
+
+
+static void BM_UseCollectorInsert(benchmark::State &state)
+{
+    const std::vector<SharedExp> locs = makeLocations(state.range(0));
+
+    for (auto _ : state) {
+        UseCollector col;
+        for (const SharedExp &loc : locs) {
+            col.insert(loc);
+        }
+
+        benchmark::DoNotOptimize(col);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_UseCollectorInsert)->RangeMultiplier(2)->Range(1, 64);
+
+
+static void BM_UseCollectorExists(benchmark::State &state)
+{
+    const std::vector<SharedExp> locs = makeLocations(state.range(0));
+    UseCollector col;
+
+    for (const SharedExp &loc : locs) {
+        col.insert(loc);
+    }
+
+    // look up clones so that we measure the deep comparison, not pointer equality
+    std::vector<SharedExp> queries;
+    for (const SharedExp &loc : locs) {
+        queries.push_back(loc->clone());
+    }
+
+    for (auto _ : state) {
+        for (const SharedExp &query : queries) {
+            benchmark::DoNotOptimize(col.exists(query));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_UseCollectorExists)->RangeMultiplier(2)->Range(1, 64);
+
+
+static void BM_DefCollectorInsert(benchmark::State &state)
+{
+    const std::vector<SharedExp> locs = makeLocations(state.range(0));
+
+    for (auto _ : state) {
+        DefCollector col;
+        for (const SharedExp &loc : locs) {
+            col.insert(new Assign(loc, RefExp::get(loc, nullptr)));
+        }
+
+        benchmark::DoNotOptimize(col);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DefCollectorInsert)->RangeMultiplier(2)->Range(1, 64);
+
+
+static void BM_DefCollectorFindDefFor(benchmark::State &state)
+{
+    const std::vector<SharedExp> locs = makeLocations(state.range(0));
+    DefCollector col;
+
+    for (const SharedExp &loc : locs) {
+        col.insert(new Assign(loc, RefExp::get(loc, nullptr)));
+    }
+
+    std::vector<SharedExp> queries;
+    for (const SharedExp &loc : locs) {
+        queries.push_back(loc->clone());
+    }
+
+    for (auto _ : state) {
+        for (const SharedExp &query : queries) {
+            benchmark::DoNotOptimize(col.findDefFor(query));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DefCollectorFindDefFor)->RangeMultiplier(2)->Range(1, 64);
+
+
+/// Reports the size of the collectors embedded in each call statement.
+/// Collectors with more than 8 entries allocate their elements on the heap in addition.
+static void BM_CallStatementSize(benchmark::State &state)
+{
+    for (auto _ : state) {
+        CallStatement call;
+        benchmark::DoNotOptimize(call);
+    }
+
+    state.counters["UseCollector"]  = sizeof(UseCollector);
+    state.counters["DefCollector"]  = sizeof(DefCollector);
+    state.counters["CallStatement"] = sizeof(CallStatement);
+}
+BENCHMARK(BM_CallStatementSize);
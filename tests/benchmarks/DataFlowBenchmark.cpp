@@ -0,0 +1,39 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "BenchmarkUtils.h"
+
+
+#include "boomerang/db/DataFlow.h"
+#include "boomerang/db/proc/ProcCFG.h"
+#include "boomerang/db/proc/UserProc.h"
+
+
+/// Dominator tree and dominance frontier computation for the largest proc of the sample
+static void BM_CalculateDominators(benchmark::State &state, const QString &samplePath)
+{
+    BenchmarkProject project;
+    loadAndDecodeSample(project, samplePath);
+
+    UserProc *proc = getLargestUserProc(project);
+    if (!proc) {
+        state.SkipWithError("Sample does not contain any decoded procedures");
+        return;
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(proc->getDataFlow()->calculateDominators());
+    }
+
+    state.SetItemsProcessed(state.iterations() * proc->getCFG()->getNumBBs());
+}
+BENCHMARK_CAPTURE(BM_CalculateDominators, pentium, QString("pentium/ass2.Linux"));
+BENCHMARK_CAPTURE(BM_CalculateDominators, sparc, QString("sparc/worms"));
+BENCHMARK_CAPTURE(BM_CalculateDominators, ppc, QString("ppc/banner"));
+BENCHMARK_CAPTURE(BM_CalculateDominators, mips, QString("mips/worms"));
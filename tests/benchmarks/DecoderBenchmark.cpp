@@ -0,0 +1,114 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "BenchmarkUtils.h"
+
+
+#include "boomerang/db/Prog.h"
+#include "boomerang/db/binary/BinaryFile.h"
+#include "boomerang/db/binary/BinaryImage.h"
+#include "boomerang/db/binary/BinarySection.h"
+#include "boomerang/frontend/DecodeResult.h"
+#include "boomerang/ifc/IDecoder.h"
+#include "boomerang/ifc/IFrontEnd.h"
+#include "boomerang/ssl/RTL.h"
+
+#include <stdexcept>
+
+
+/**
+ * Linearly decode all code sections of the sample at \p samplePath.
+ * Invalid instructions are skipped by \p minInsnSize bytes.
+ */
+static void BM_DecodeCodeSections(benchmark::State &state, const QString &samplePath,
+                                  int minInsnSize)
+{
+    BenchmarkProject project;
+    if (!project.loadBinaryFile(getFullSamplePath(samplePath))) {
+        state.SkipWithError("Cannot load sample");
+        return;
+    }
+
+    IDecoder *decoder  = project.getProg()->getFrontEnd()->getDecoder();
+    BinaryImage *image = project.getLoadedBinaryFile()->getImage();
+
+    int64_t numInsns = 0;
+    int64_t numBytes = 0;
+
+    for (auto _ : state) {
+        for (const BinarySection *section : *image) {
+            if (!section->isCode() || section->getHostAddr() == HostAddress::INVALID) {
+                continue;
+            }
+
+            const ptrdiff_t delta = (section->getHostAddr() - section->getSourceAddr()).value();
+            const Address end     = section->getSourceAddr() + section->getSize();
+            DecodeResult result;
+
+            for (Address pc = section->getSourceAddr(); pc < end;) {
+                result.reset();
+
+                bool valid = false;
+                try {
+                    valid = decoder->decodeInstruction(pc, delta, result);
+                }
+                catch (const std::runtime_error &) {
+                    valid = false;
+                }
+
+                if (valid && result.valid && result.numBytes > 0) {
+                    pc += result.numBytes;
+                    numInsns++;
+                }
+                else {
+                    pc += minInsnSize;
+                }
+            }
+
+            numBytes += section->getSize();
+        }
+    }
+
+    state.SetBytesProcessed(numBytes);
+    state.SetItemsProcessed(numInsns);
+}
+BENCHMARK_CAPTURE(BM_DecodeCodeSections, pentium, QString("pentium/ass2.Linux"), 1)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_DecodeCodeSections, sparc, QString("sparc/worms"), 4)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_DecodeCodeSections, ppc, QString("ppc/banner"), 4)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_DecodeCodeSections, mips, QString("mips/worms"), 4)
+    ->Unit(benchmark::kMillisecond);
+
+
+/// Recursive descent decoding of the whole program, like Project::decodeBinaryFile
+static void BM_DecodeBinaryFile(benchmark::State &state, const QString &samplePath)
+{
+    BenchmarkProject project;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        const bool loaded = project.loadBinaryFile(getFullSamplePath(samplePath));
+        state.ResumeTiming();
+
+        if (!loaded || !project.decodeBinaryFile()) {
+            state.SkipWithError("Cannot load or decode sample");
+            break;
+        }
+    }
+}
+BENCHMARK_CAPTURE(BM_DecodeBinaryFile, pentium, QString("pentium/ass2.Linux"))
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_DecodeBinaryFile, sparc, QString("sparc/worms"))
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_DecodeBinaryFile, ppc, QString("ppc/banner"))
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_DecodeBinaryFile, mips, QString("mips/worms"))
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,124 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "BenchmarkUtils.h"
+
+
+#include "boomerang/ssl/exp/Binary.h"
+#include "boomerang/ssl/exp/Const.h"
+#include "boomerang/ssl/exp/Location.h"
+#include "boomerang/ssl/exp/RefExp.h"
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+
+/// Build an expression like m[m[r28{-} + 4] + 8] with \p depth nested memofs
+static SharedExp makeNestedMemOf(int depth, int offset = 0)
+{
+    SharedExp exp = RefExp::get(Location::regOf(REG_PENT_ESP), nullptr);
+
+    for (int i = 0; i < depth; i++) {
+        exp = Location::memOf(Binary::get(opPlus, exp, Const::get(4 * (i + 1) + offset)));
+    }
+
+    return exp;
+}
+
+
+static void BM_ExpClone(benchmark::State &state)
+{
+    const SharedExp exp = makeNestedMemOf(state.range(0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(exp->clone());
+    }
+}
+BENCHMARK(BM_ExpClone)->RangeMultiplier(2)->Range(1, 64);
+
+
+static void BM_ExpEquals(benchmark::State &state)
+{
+    const SharedExp exp1 = makeNestedMemOf(state.range(0));
+    const SharedExp exp2 = exp1->clone();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(*exp1 == *exp2);
+    }
+}
+BENCHMARK(BM_ExpEquals)->RangeMultiplier(2)->Range(1, 64);
+
+
+/// Worst case for lessExpStar: both expressions are equal, so the whole tree is compared
+static void BM_LessExpStarEqual(benchmark::State &state)
+{
+    const SharedExp exp1 = makeNestedMemOf(state.range(0));
+    const SharedExp exp2 = exp1->clone();
+    lessExpStar less;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(less(exp1, exp2));
+    }
+}
+BENCHMARK(BM_LessExpStarEqual)->RangeMultiplier(2)->Range(1, 64);
+
+
+/// The expressions only differ in the innermost constant
+static void BM_LessExpStarDifferent(benchmark::State &state)
+{
+    const SharedExp exp1 = makeNestedMemOf(state.range(0), 0);
+    const SharedExp exp2 = makeNestedMemOf(state.range(0), 1);
+    lessExpStar less;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(less(exp1, exp2));
+    }
+}
+BENCHMARK(BM_LessExpStarDifferent)->RangeMultiplier(2)->Range(1, 64);
+
+
+static void BM_ExpHash(benchmark::State &state)
+{
+    const SharedExp exp = makeNestedMemOf(state.range(0));
+    hashExpStar hash;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(hash(exp));
+    }
+}
+BENCHMARK(BM_ExpHash)->RangeMultiplier(2)->Range(1, 64);
+
+
+/// Look up \p state.range(0) locations like m[m[r28{-} + 4] + k] in a map containing all of them
+template<typename Map>
+static void BM_ExpMapFind(benchmark::State &state)
+{
+    std::vector<SharedExp> keys;
+    Map map;
+
+    for (int i = 0; i < state.range(0); i++) {
+        keys.push_back(makeNestedMemOf(2, 4 * i));
+        map[keys.back()->clone()] = i;
+    }
+
+    for (auto _ : state) {
+        for (const SharedExp &key : keys) {
+            benchmark::DoNotOptimize(map.find(key));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_ExpMapFind, std::map<SharedExp, int, lessExpStar>)
+    ->RangeMultiplier(8)
+    ->Range(8, 1 << 15);
+BENCHMARK_TEMPLATE(BM_ExpMapFind, std::unordered_map<SharedExp, int, hashExpStar, equalExpStar>)
+    ->RangeMultiplier(8)
+    ->Range(8, 1 << 15);
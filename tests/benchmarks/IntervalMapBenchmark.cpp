@@ -0,0 +1,141 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "BenchmarkUtils.h"
+
+
+#include "boomerang/util/Address.h"
+#include "boomerang/util/FlatIntervalMap.h"
+#include "boomerang/util/FlatIntervalSet.h"
+#include "boomerang/util/IntervalMap.h"
+#include "boomerang/util/IntervalSet.h"
+
+#include <algorithm>
+#include <random>
+
+
+/// \returns the addresses of \p count adjacent 16 byte intervals in random (but reproducible) order
+static std::vector<Address> makeQueries(int count)
+{
+    std::vector<Address> queries;
+    queries.reserve(count);
+
+    for (int i = 0; i < count; i++) {
+        queries.push_back(Address(0x08048000 + 16 * i + 7));
+    }
+
+    std::mt19937 rng(42);
+    std::shuffle(queries.begin(), queries.end(), rng);
+    return queries;
+}
+
+
+template<typename Map>
+static void fillMap(Map &map, int count)
+{
+    for (int i = 0; i < count; i++) {
+        const Address lower(0x08048000 + 16 * i);
+        map.insert(lower, lower + 16, i);
+    }
+}
+
+
+template<typename Set>
+static void fillSet(Set &set, int count)
+{
+    // leave a gap between the intervals so they are not merged
+    for (int i = 0; i < count; i++) {
+        const Address lower(0x08048000 + 16 * i);
+        set.insert(lower, lower + 8);
+    }
+}
+
+
+template<typename Map>
+static void BM_IntervalMapInsert(benchmark::State &state)
+{
+    for (auto _ : state) {
+        Map map;
+        fillMap(map, state.range(0));
+        benchmark::DoNotOptimize(map.begin());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_IntervalMapInsert, IntervalMap<Address, int>)
+    ->RangeMultiplier(8)
+    ->Range(1 << 6, 1 << 15);
+BENCHMARK_TEMPLATE(BM_IntervalMapInsert, FlatIntervalMap<Address, int>)
+    ->RangeMultiplier(8)
+    ->Range(1 << 6, 1 << 15);
+
+
+template<typename Map>
+static void BM_IntervalMapFind(benchmark::State &state)
+{
+    Map map;
+    fillMap(map, state.range(0));
+    const std::vector<Address> queries = makeQueries(state.range(0));
+
+    for (auto _ : state) {
+        for (Address query : queries) {
+            benchmark::DoNotOptimize(map.find(query));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_IntervalMapFind, IntervalMap<Address, int>)
+    ->RangeMultiplier(8)
+    ->Range(1 << 6, 1 << 12);
+BENCHMARK_TEMPLATE(BM_IntervalMapFind, FlatIntervalMap<Address, int>)
+    ->RangeMultiplier(8)
+    ->Range(1 << 6, 1 << 15);
+
+
+template<typename Set>
+static void BM_IntervalSetInsert(benchmark::State &state)
+{
+    for (auto _ : state) {
+        Set set;
+        fillSet(set, state.range(0));
+        benchmark::DoNotOptimize(set.begin());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_IntervalSetInsert, IntervalSet<Address>)
+    ->RangeMultiplier(8)
+    ->Range(1 << 6, 1 << 12);
+BENCHMARK_TEMPLATE(BM_IntervalSetInsert, FlatIntervalSet<Address>)
+    ->RangeMultiplier(8)
+    ->Range(1 << 6, 1 << 15);
+
+
+template<typename Set>
+static void BM_IntervalSetIsContained(benchmark::State &state)
+{
+    Set set;
+    fillSet(set, state.range(0));
+    const std::vector<Address> queries = makeQueries(state.range(0));
+
+    for (auto _ : state) {
+        for (Address query : queries) {
+            benchmark::DoNotOptimize(set.isContained(query));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_IntervalSetIsContained, IntervalSet<Address>)
+    ->RangeMultiplier(8)
+    ->Range(1 << 6, 1 << 12);
+BENCHMARK_TEMPLATE(BM_IntervalSetIsContained, FlatIntervalSet<Address>)
+    ->RangeMultiplier(8)
+    ->Range(1 << 6, 1 << 15);
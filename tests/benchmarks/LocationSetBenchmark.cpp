@@ -0,0 +1,120 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "BenchmarkUtils.h"
+
+
+#include "boomerang/ssl/exp/Binary.h"
+#include "boomerang/ssl/exp/Const.h"
+#include "boomerang/ssl/exp/Location.h"
+#include "boomerang/ssl/exp/RefExp.h"
+#include "boomerang/util/LocationSet.h"
+
+
+/// Create \p count distinct locations: registers first, then stack locations m[r28{-} - K]
+static std::vector<SharedExp> makeLocations(int count)
+{
+    std::vector<SharedExp> locs;
+    locs.reserve(count);
+
+    for (int i = 0; i < count; i++) {
+        if (i < 32) {
+            locs.push_back(Location::regOf(i));
+        }
+        else {
+            locs.push_back(Location::memOf(Binary::get(
+                opMinus, RefExp::get(Location::regOf(REG_PENT_ESP), nullptr), Const::get(4 * i))));
+        }
+    }
+
+    return locs;
+}
+
+
+static void BM_LocationSetInsert(benchmark::State &state)
+{
+    const std::vector<SharedExp> locs = makeLocations(state.range(0));
+
+    for (auto _ : state) {
+        LocationSet set;
+        for (const SharedExp &loc : locs) {
+            set.insert(loc);
+        }
+
+        benchmark::DoNotOptimize(set);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_LocationSetInsert)->RangeMultiplier(4)->Range(1, 1024);
+
+
+static void BM_LocationSetContains(benchmark::State &state)
+{
+    const std::vector<SharedExp> locs = makeLocations(state.range(0));
+    LocationSet filled;
+
+    for (const SharedExp &loc : locs) {
+        filled.insert(loc);
+    }
+
+    // look up clones so that we measure the deep comparison, not pointer equality
+    std::vector<SharedExp> queries;
+    for (const SharedExp &loc : locs) {
+        queries.push_back(loc->clone());
+    }
+
+    for (auto _ : state) {
+        for (const SharedExp &query : queries) {
+            benchmark::DoNotOptimize(filled.contains(query));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_LocationSetContains)->RangeMultiplier(4)->Range(1, 1024);
+
+
+static void BM_LocationSetCopy(benchmark::State &state)
+{
+    const std::vector<SharedExp> locs = makeLocations(state.range(0));
+    LocationSet set;
+
+    for (const SharedExp &loc : locs) {
+        set.insert(loc);
+    }
+
+    for (auto _ : state) {
+        LocationSet copy(set);
+        benchmark::DoNotOptimize(copy);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_LocationSetCopy)->RangeMultiplier(4)->Range(1, 1024);
+
+
+static void BM_LocationSetUnion(benchmark::State &state)
+{
+    const std::vector<SharedExp> locs = makeLocations(2 * state.range(0));
+    LocationSet evens, odds;
+
+    for (size_t i = 0; i < locs.size(); i++) {
+        (i % 2 == 0 ? evens : odds).insert(locs[i]);
+    }
+
+    for (auto _ : state) {
+        LocationSet result = evens;
+        result.makeUnion(odds);
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_LocationSetUnion)->RangeMultiplier(4)->Range(1, 1024);
@@ -0,0 +1,145 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "BenchmarkUtils.h"
+
+
+#include "boomerang/core/Settings.h"
+#include "boomerang/db/Prog.h"
+#include "boomerang/db/proc/UserProc.h"
+#include "boomerang/passes/PassManager.h"
+#include "boomerang/util/StatementList.h"
+
+#include <algorithm>
+
+
+/// The passes of ProcDecompiler::earlyDecompile, in execution order.
+static const PassID earlyPasses[] = {
+    PassID::StatementInit,    PassID::BBSimplify,         PassID::Dominators,
+    PassID::CallDefineUpdate, PassID::GlobalConstReplace, PassID::PhiPlacement,
+    PassID::BlockVarRename,   PassID::StatementPropagation
+};
+
+
+/**
+ * Time a single early decompilation pass over all procs of the sample.
+ * Before each measurement, the sample is loaded and decoded again and all passes
+ * preceding \p passID in earlyDecompile are executed (untimed), so every iteration
+ * sees the same input.
+ */
+static void BM_EarlyPass(benchmark::State &state, const QString &samplePath, PassID passID)
+{
+    const PassID *passEnd = std::find(std::begin(earlyPasses), std::end(earlyPasses), passID);
+    if (passEnd == std::end(earlyPasses)) {
+        state.SkipWithError("Not an early decompilation pass");
+        return;
+    }
+
+    BenchmarkProject project;
+    int64_t numProcs = 0;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        loadAndDecodeSample(project, samplePath);
+        const std::vector<UserProc *> procs = getUserProcs(project);
+
+        for (UserProc *proc : procs) {
+            for (const PassID *prev = std::begin(earlyPasses); prev != passEnd; ++prev) {
+                PassManager::get()->executePass(*prev, proc);
+            }
+        }
+        state.ResumeTiming();
+
+        for (UserProc *proc : procs) {
+            PassManager::get()->executePass(passID, proc);
+        }
+
+        numProcs += procs.size();
+    }
+
+    state.SetItemsProcessed(numProcs);
+}
+
+#define BOOMERANG_PASS_BENCHMARK(sample, samplePath, pass)                                          \
+    BENCHMARK_CAPTURE(BM_EarlyPass, sample##_##pass, QString(samplePath), PassID::pass)             \
+        ->Unit(benchmark::kMillisecond)                                                            \
+        ->Iterations(10)
+
+BOOMERANG_PASS_BENCHMARK(pentium, "pentium/ass2.Linux", StatementInit);
+BOOMERANG_PASS_BENCHMARK(pentium, "pentium/ass2.Linux", Dominators);
+BOOMERANG_PASS_BENCHMARK(pentium, "pentium/ass2.Linux", CallDefineUpdate);
+BOOMERANG_PASS_BENCHMARK(pentium, "pentium/ass2.Linux", PhiPlacement);
+BOOMERANG_PASS_BENCHMARK(pentium, "pentium/ass2.Linux", BlockVarRename);
+BOOMERANG_PASS_BENCHMARK(pentium, "pentium/ass2.Linux", StatementPropagation);
+
+BOOMERANG_PASS_BENCHMARK(sparc, "sparc/worms", PhiPlacement);
+BOOMERANG_PASS_BENCHMARK(sparc, "sparc/worms", BlockVarRename);
+BOOMERANG_PASS_BENCHMARK(sparc, "sparc/worms", StatementPropagation);
+
+// The largest samples of the regression test suite
+BOOMERANG_PASS_BENCHMARK(pentium_ass3, "pentium/ass3.Linux", BlockVarRename);
+BOOMERANG_PASS_BENCHMARK(sparc_ass3, "sparc/ass3.SunOS", BlockVarRename);
+
+
+/**
+ * Time decoding the sample and all early decompilation passes, with or without
+ * pruning the assignments to overlapping registers (see Settings::prunedOverlaps).
+ * Reports the number of statements after the early passes
+ * and the number of inserted assignments to overlapping registers.
+ */
+static void BM_EarlyDecompile(benchmark::State &state, const QString &samplePath,
+                              bool prunedOverlaps)
+{
+    BenchmarkProject project;
+    project.getSettings()->prunedOverlaps = prunedOverlaps;
+
+    int64_t numStatements = 0;
+    int64_t numOverlaps   = 0;
+
+    for (auto _ : state) {
+        loadAndDecodeSample(project, samplePath);
+        const std::vector<UserProc *> procs = getUserProcs(project);
+
+        for (UserProc *proc : procs) {
+            for (PassID passID : earlyPasses) {
+                PassManager::get()->executePass(passID, proc);
+            }
+        }
+
+        state.PauseTiming();
+        numStatements = 0;
+        for (UserProc *proc : procs) {
+            StatementList stmts;
+            proc->getStatements(stmts);
+            numStatements += stmts.size();
+        }
+
+        numOverlaps = project.getProg()->getOverlapStats().numInserted;
+        state.ResumeTiming();
+    }
+
+    state.counters["statements"] = numStatements;
+    state.counters["overlaps"]   = numOverlaps;
+}
+
+#define BOOMERANG_OVERLAP_BENCHMARK(sample, samplePath)                                             \
+    BENCHMARK_CAPTURE(BM_EarlyDecompile, sample##_eager, QString(samplePath), false)               \
+        ->Unit(benchmark::kMillisecond)                                                            \
+        ->Iterations(5);                                                                           \
+    BENCHMARK_CAPTURE(BM_EarlyDecompile, sample##_pruned, QString(samplePath), true)               \
+        ->Unit(benchmark::kMillisecond)                                                            \
+        ->Iterations(5)
+
+// Pentium samples of the regression test suite
+BOOMERANG_OVERLAP_BENCHMARK(pentium_ass2, "pentium/ass2.Linux");
+BOOMERANG_OVERLAP_BENCHMARK(pentium_ass3, "pentium/ass3.Linux");
+BOOMERANG_OVERLAP_BENCHMARK(pentium_bswap, "pentium/bswap");
+BOOMERANG_OVERLAP_BENCHMARK(pentium_encrypt, "pentium/encrypt");
+BOOMERANG_OVERLAP_BENCHMARK(pentium_rux_encrypt, "pentium/rux_encrypt");
+BOOMERANG_OVERLAP_BENCHMARK(pentium_regalias, "pentium/regalias");
@@ -0,0 +1,80 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "BenchmarkUtils.h"
+
+
+#include "boomerang/ssl/RTL.h"
+#include "boomerang/ssl/exp/Const.h"
+#include "boomerang/ssl/exp/Location.h"
+#include "boomerang/ssl/statements/Assign.h"
+
+
+/// Create an RTL with \p numStmts assignments, like a decoded instruction.
+static std::unique_ptr<RTL> makeRTL(int numStmts)
+{
+    std::unique_ptr<RTL> rtl(new RTL(Address(0x1000)));
+
+    for (int i = 0; i < numStmts; i++) {
+        rtl->append(new Assign(Location::regOf(REG_PENT_EAX + i % 8), Const::get(i)));
+    }
+
+    return rtl;
+}
+
+
+static void BM_RTLAppend(benchmark::State &state)
+{
+    const std::unique_ptr<RTL> stmts = makeRTL(state.range(0));
+
+    for (auto _ : state) {
+        RTL rtl(Address(0x1000));
+        for (Statement *stmt : *stmts) {
+            rtl.append(stmt);
+        }
+
+        benchmark::DoNotOptimize(rtl);
+        rtl.clear(); // the statements are owned by stmts
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RTLAppend)->DenseRange(1, 8);
+
+
+static void BM_RTLCopy(benchmark::State &state)
+{
+    const std::unique_ptr<RTL> rtl = makeRTL(state.range(0));
+
+    for (auto _ : state) {
+        RTL copy(*rtl);
+        benchmark::DoNotOptimize(copy);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RTLCopy)->DenseRange(1, 8);
+
+
+/// Move the RTLs of a basic block into a new list, like ProcCFG::splitBB does.
+static void BM_RTLListSplice(benchmark::State &state)
+{
+    RTLList rtls;
+    for (int i = 0; i < state.range(0); i++) {
+        rtls.push_back(makeRTL(3));
+    }
+
+    for (auto _ : state) {
+        RTLList high;
+        high.splice(high.end(), rtls, std::next(rtls.begin()), rtls.end());
+        rtls.splice(rtls.end(), high);
+        benchmark::DoNotOptimize(rtls);
+    }
+}
+BENCHMARK(BM_RTLListSplice)->RangeMultiplier(4)->Range(4, 256);
@@ -0,0 +1,116 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "BenchmarkUtils.h"
+
+
+#include "boomerang/ssl/RTL.h"
+#include "boomerang/ssl/RTLInstDict.h"
+#include "boomerang/ssl/RTLInstDictCache.h"
+#include "boomerang/ssl/exp/Binary.h"
+#include "boomerang/ssl/exp/Const.h"
+#include "boomerang/ssl/exp/Location.h"
+
+#include <QTemporaryDir>
+
+
+static void BM_ReadSSLFile(benchmark::State &state, const QString &sslFile)
+{
+    const QString path = getFullSSLPath(sslFile);
+
+    for (auto _ : state) {
+        RTLInstDict dict;
+        if (!dict.readSSLFile(path)) {
+            state.SkipWithError("Cannot read SSL file");
+            break;
+        }
+
+        benchmark::DoNotOptimize(dict);
+    }
+}
+BENCHMARK_CAPTURE(BM_ReadSSLFile, pentium, QString("pentium.ssl"))->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_ReadSSLFile, sparc, QString("sparc.ssl"))->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_ReadSSLFile, ppc, QString("ppc.ssl"))->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_ReadSSLFile, mips, QString("mips.ssl"))->Unit(benchmark::kMillisecond);
+
+
+/// Load a dictionary from a cache file written by RTLInstDictCache instead of parsing the SSL file.
+static void BM_ReadSSLCacheFile(benchmark::State &state, const QString &sslFile)
+{
+    const QString path       = getFullSSLPath(sslFile);
+    const QByteArray sslHash = RTLInstDictCache::hashSSLFile(path);
+
+    QTemporaryDir cacheDir;
+    const QString cacheFilePath = cacheDir.filePath(sslFile + "cache");
+
+    RTLInstDict parsed;
+    if (!parsed.readSSLFile(path) ||
+        !RTLInstDictCache::writeCacheFile(parsed, cacheFilePath, sslHash)) {
+        state.SkipWithError("Cannot write SSL cache file");
+        return;
+    }
+
+    for (auto _ : state) {
+        RTLInstDict dict;
+        if (!RTLInstDictCache::readCacheFile(dict, cacheFilePath, sslHash)) {
+            state.SkipWithError("Cannot read SSL cache file");
+            break;
+        }
+
+        benchmark::DoNotOptimize(dict);
+    }
+}
+BENCHMARK_CAPTURE(BM_ReadSSLCacheFile, pentium, QString("pentium.ssl"))->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_ReadSSLCacheFile, sparc, QString("sparc.ssl"))->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_ReadSSLCacheFile, ppc, QString("ppc.ssl"))->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_ReadSSLCacheFile, mips, QString("mips.ssl"))->Unit(benchmark::kMillisecond);
+
+
+/**
+ * Instantiate the RTL template for \p insnName with register and memory operands,
+ * like the decoders do for every decoded instruction.
+ */
+static void BM_InstantiateRTL(benchmark::State &state, const QString &sslFile,
+                              const QString &insnName)
+{
+    RTLInstDict dict;
+    if (!dict.readSSLFile(getFullSSLPath(sslFile))) {
+        state.SkipWithError("Cannot read SSL file");
+        return;
+    }
+
+    const std::pair<QString, int> sig = dict.getSignature(insnName);
+    if (sig.second == -1) {
+        state.SkipWithError("Instruction not found in SSL file");
+        return;
+    }
+
+    std::vector<SharedExp> actuals;
+    for (int i = 0; i < sig.second; i++) {
+        if (i % 2 == 0) {
+            actuals.push_back(Location::regOf(i + 1));
+        }
+        else {
+            actuals.push_back(
+                Location::memOf(Binary::get(opPlus, Location::regOf(i + 1), Const::get(8))));
+        }
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dict.instantiateRTL(sig.first, Address(0x1000), actuals));
+    }
+}
+BENCHMARK_CAPTURE(BM_InstantiateRTL, pentium_MOV_MROD, QString("pentium.ssl"), QString("MOV.MROD"));
+BENCHMARK_CAPTURE(BM_InstantiateRTL, pentium_ADD_RMOD, QString("pentium.ssl"), QString("ADD.RMOD"));
+BENCHMARK_CAPTURE(BM_InstantiateRTL, pentium_PUSH_EVOD, QString("pentium.ssl"), QString("PUSH.EVOD"));
+BENCHMARK_CAPTURE(BM_InstantiateRTL, pentium_CALL_EVOD, QString("pentium.ssl"), QString("CALL.EVOD"));
+BENCHMARK_CAPTURE(BM_InstantiateRTL, sparc_ADD, QString("sparc.ssl"), QString("ADD"));
+BENCHMARK_CAPTURE(BM_InstantiateRTL, sparc_SUBCC, QString("sparc.ssl"), QString("SUBCC"));
+BENCHMARK_CAPTURE(BM_InstantiateRTL, sparc_LD, QString("sparc.ssl"), QString("LD"));
+BENCHMARK_CAPTURE(BM_InstantiateRTL, ppc_ADD, QString("ppc.ssl"), QString("ADD"));
@@ -0,0 +1,96 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "BenchmarkUtils.h"
+
+
+#include "boomerang/ssl/type/CompoundType.h"
+#include "boomerang/ssl/type/IntegerType.h"
+#include "boomerang/ssl/type/PointerType.h"
+#include "boomerang/ssl/type/VoidType.h"
+
+
+/// Create a struct with \p numMembers members, alternating between ints and pointers
+/// (like a vtable or a large configuration struct).
+static std::shared_ptr<CompoundType> makeLargeStruct(int numMembers)
+{
+    std::shared_ptr<CompoundType> comp = CompoundType::get();
+
+    for (int i = 0; i < numMembers; i++) {
+        if (i % 2 == 0) {
+            comp->addMember(IntegerType::get(32, Sign::Signed), QString("member%1").arg(i));
+        }
+        else {
+            comp->addMember(PointerType::get(VoidType::get()), QString("member%1").arg(i));
+        }
+    }
+
+    return comp;
+}
+
+
+static void BM_CompoundAddMember(benchmark::State &state)
+{
+    for (auto _ : state) {
+        std::shared_ptr<CompoundType> comp = makeLargeStruct(state.range(0));
+        benchmark::DoNotOptimize(comp);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CompoundAddMember)->RangeMultiplier(4)->Range(16, 4096);
+
+
+static void BM_CompoundGetMemberTypeByOffset(benchmark::State &state)
+{
+    std::shared_ptr<CompoundType> comp = makeLargeStruct(state.range(0));
+    const unsigned size                = comp->getSize();
+
+    for (auto _ : state) {
+        for (unsigned offset = 0; offset < size; offset += 32) {
+            benchmark::DoNotOptimize(comp->getMemberTypeByOffset(offset));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CompoundGetMemberTypeByOffset)->RangeMultiplier(4)->Range(16, 4096);
+
+
+static void BM_CompoundSetMemberTypeByOffset(benchmark::State &state)
+{
+    std::shared_ptr<CompoundType> comp = makeLargeStruct(state.range(0));
+    const unsigned size                = comp->getSize();
+    SharedType ty                      = IntegerType::get(32, Sign::Unsigned);
+
+    // refine the type of each member, like DFA type analysis does for each field access
+    for (auto _ : state) {
+        for (unsigned offset = 0; offset < size; offset += 64) {
+            comp->setMemberTypeByOffset(offset, ty);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0) / 2);
+}
+BENCHMARK(BM_CompoundSetMemberTypeByOffset)->RangeMultiplier(4)->Range(16, 4096);
+
+
+static void BM_CompoundGetMemberOffsetByIdx(benchmark::State &state)
+{
+    std::shared_ptr<CompoundType> comp = makeLargeStruct(state.range(0));
+
+    for (auto _ : state) {
+        for (int i = 0; i < comp->getNumMembers(); i++) {
+            benchmark::DoNotOptimize(comp->getMemberOffsetByIdx(i));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CompoundGetMemberOffsetByIdx)->RangeMultiplier(4)->Range(16, 4096);
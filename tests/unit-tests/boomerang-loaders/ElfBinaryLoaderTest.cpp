@@ -13,9 +13,13 @@
 #include "boomerang/core/Settings.h"
 #include "boomerang/db/binary/BinaryImage.h"
 #include "boomerang/db/binary/BinarySection.h"
+#include "boomerang/db/binary/BinarySymbol.h"
+#include "boomerang/db/binary/BinarySymbolTable.h"
 #include "boomerang/util/log/Log.h"
 
+#include <QDataStream>
 #include <QLibrary>
+#include <QTemporaryDir>
 
 
 #define HELLO_CLANG4           (m_project.getSettings()->getDataDirectory().absoluteFilePath("samples/elf/hello-clang4-dynamic"))
@@ -130,5 +134,123 @@ void ElfBinaryLoaderTest::testPentiumLoad_data()
 }
 
 
+/// Address of the function with symbol index \p i in the file written by writeManySymbolsElf
+static Address manySymbolsAddr(int i)
+{
+    return Address(0x08048000 + 4 * i);
+}
+
+
+/**
+ * Write a minimal 32 bit x86 ELF executable with \p numSymbols entries in its symbol table.
+ * Symbol i (i > 0) is a function at manySymbolsAddr(i), named "func<i>", except:
+ *  - i % 1000 == 1: a STT_FILE symbol named "file<i>.c"
+ *  - i % 1000 == 2: a local function (belonging to the file before it)
+ */
+static bool writeManySymbolsElf(const QString &path, int numSymbols)
+{
+    QByteArray text(4 * numSymbols, '\xC3');
+    QByteArray strtab(1, '\0');
+    QByteArray symtab;
+
+    QDataStream sym(&symtab, QIODevice::WriteOnly);
+    sym.setByteOrder(QDataStream::LittleEndian);
+    sym << quint32(0) << quint32(0) << quint32(0) << quint8(0) << quint8(0) << quint16(0);
+
+    for (int i = 1; i < numSymbols; i++) {
+        const quint32 nameIdx = strtab.size();
+
+        if (i % 1000 == 1) {
+            strtab += QString("file%1.c").arg(i).toLatin1() + '\0';
+            sym << nameIdx << quint32(0) << quint32(0) << quint8(0x04) // STB_LOCAL, STT_FILE
+                << quint8(0) << quint16(0xFFF1);                      // SHN_ABS
+        }
+        else {
+            const quint8 binding = (i % 1000 == 2) ? 0 : 1; // STB_LOCAL : STB_GLOBAL
+            strtab += QString("func%1").arg(i).toLatin1() + '\0';
+            sym << nameIdx << quint32(manySymbolsAddr(i).value()) << quint32(4)
+                << quint8((binding << 4) | 0x02) << quint8(0) << quint16(1); // STT_FUNC in .text
+        }
+    }
+
+    const QByteArray shstrtab("\0.text\0.symtab\0.strtab\0.shstrtab\0", 33);
+
+    const quint32 textOffset     = 52; // directly after the ELF header
+    const quint32 symtabOffset   = textOffset + text.size();
+    const quint32 strtabOffset   = symtabOffset + symtab.size();
+    const quint32 shstrtabOffset = strtabOffset + strtab.size();
+    const quint32 shOffset       = (shstrtabOffset + shstrtab.size() + 3) & ~3U;
+
+    QByteArray contents;
+    QDataStream out(&contents, QIODevice::WriteOnly);
+    out.setByteOrder(QDataStream::LittleEndian);
+
+    // ELF header: ELFCLASS32, ELFDATA2LSB, ET_EXEC, EM_386, no program headers
+    out << quint8(0x7F) << quint8('E') << quint8('L') << quint8('F') << quint8(1) << quint8(1)
+        << quint8(1);
+    for (int i = 7; i < 16; i++) {
+        out << quint8(0);
+    }
+
+    out << quint16(2) << quint16(3) << quint32(1) << quint32(manySymbolsAddr(0).value())
+        << quint32(textOffset) << shOffset << quint32(0) << quint16(52) << quint16(32)
+        << quint16(0) << quint16(40) << quint16(5) << quint16(4);
+
+    out.writeRawData(text.constData(), text.size());
+    out.writeRawData(symtab.constData(), symtab.size());
+    out.writeRawData(strtab.constData(), strtab.size());
+    out.writeRawData(shstrtab.constData(), shstrtab.size());
+    while (static_cast<quint32>(contents.size()) < shOffset) {
+        out << quint8(0);
+    }
+
+    // Section headers: name, type, flags, addr, offset, size, link, info, addralign, entsize
+    const auto writeSection = [&out](quint32 name, quint32 type, quint32 flags, quint32 addr,
+                                     quint32 offset, quint32 size, quint32 link, quint32 entsize) {
+        out << name << type << flags << addr << offset << size << link << quint32(0)
+            << quint32(4) << entsize;
+    };
+
+    writeSection(0, 0, 0, 0, 0, 0, 0, 0);
+    writeSection(1, 1, 0x6, manySymbolsAddr(0).value(), textOffset, text.size(), 0, 0);
+    writeSection(7, 2, 0, 0, symtabOffset, symtab.size(), 3, 16);
+    writeSection(15, 3, 0, 0, strtabOffset, strtab.size(), 0, 0);
+    writeSection(23, 3, 0, 0, shstrtabOffset, shstrtab.size(), 0, 0);
+
+    QFile file(path);
+    return file.open(QFile::WriteOnly) && file.write(contents) == contents.size();
+}
+
+
+void ElfBinaryLoaderTest::testManySymbols()
+{
+    // more than the minimum number of symbols for translating them in parallel
+    const int numSymbols = 20000;
+
+    QTemporaryDir tempDir;
+    QVERIFY(tempDir.isValid());
+
+    const QString path = tempDir.filePath("manysymbols");
+    QVERIFY(writeManySymbolsElf(path, numSymbols));
+    QVERIFY(m_project.loadBinaryFile(path));
+
+    const BinarySymbolTable *symbols = m_project.getLoadedBinaryFile()->getSymbols();
+
+    for (int i = 1; i < numSymbols; i++) {
+        if (i % 1000 == 1) {
+            continue; // file symbols are not added
+        }
+
+        const BinarySymbol *symbol = symbols->findSymbolByAddress(manySymbolsAddr(i));
+        QVERIFY(symbol != nullptr);
+        QCOMPARE(symbol->getName(), QString("func%1").arg(i));
+        QVERIFY(symbol->isFunction());
+
+        // source files are tracked in file order, also across chunk boundaries
+        const QString sourceFile = (i % 1000 == 2) ? QString("file%1.c").arg(i - 1) : QString("");
+        QCOMPARE(symbol->belongsToSourceFile(), sourceFile);
+    }
+}
+
 
 QTEST_GUILESS_MAIN(ElfBinaryLoaderTest)
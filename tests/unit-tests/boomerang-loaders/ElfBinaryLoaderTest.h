@@ -25,4 +25,7 @@ private slots:
     /// Test loading the Pentium (Solaris) hello world program
     void testPentiumLoad();
     void testPentiumLoad_data();
+
+    /// Test loading a symbol table that is large enough to be translated in parallel
+    void testManySymbols();
 };
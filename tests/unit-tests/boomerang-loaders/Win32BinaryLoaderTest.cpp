@@ -12,9 +12,13 @@
 
 #include "boomerang/db/binary/BinaryImage.h"
 #include "boomerang/db/binary/BinarySection.h"
-
+#include "boomerang/util/ByteUtil.h"
 #include "boomerang/util/log/Log.h"
 
+#include <QFile>
+
+#include <algorithm>
+
 
 #define SWITCH_BORLAND    getFullSamplePath("windows/switch_borland.exe")
 
@@ -30,4 +34,44 @@ void Win32BinaryLoaderTest::testWinLoad()
 }
 
 
+void Win32BinaryLoaderTest::testSectionLayout()
+{
+    QFile file(SWITCH_BORLAND);
+    QVERIFY(file.open(QFile::ReadOnly));
+    const QByteArray fileData = file.readAll();
+    const char *data          = fileData.constData();
+
+    QVERIFY(m_project.loadBinaryFile(SWITCH_BORLAND));
+    const BinaryImage *image = m_project.getLoadedBinaryFile()->getImage();
+
+    // The image replaces the file contents
+    const DWord peOffset  = Util::readDWord(data + 0x3C, Endian::Little);
+    const DWord imageBase = Util::readDWord(data + peOffset + 0x34, Endian::Little);
+    QCOMPARE(DWord(image->getRawData().size()),
+             Util::readDWord(data + peOffset + 0x50, Endian::Little));
+
+    const SWord numSections   = Util::readWord(data + peOffset + 0x06, Endian::Little);
+    const SWord ntHeaderSize  = Util::readWord(data + peOffset + 0x14, Endian::Little);
+    const char *sectionHeader = data + peOffset + 24 + ntHeaderSize;
+
+    for (int i = 0; i < numSections; i++, sectionHeader += 40) {
+        const DWord virtualSize = Util::readDWord(sectionHeader + 8, Endian::Little);
+        const DWord rva         = Util::readDWord(sectionHeader + 12, Endian::Little);
+        const DWord physSize    = Util::readDWord(sectionHeader + 16, Endian::Little);
+        const DWord physOffset  = Util::readDWord(sectionHeader + 20, Endian::Little);
+
+        const BinarySection *section = image->getSectionByAddr(Address(imageBase + rva));
+        QVERIFY(section != nullptr);
+
+        const char *sectionData = reinterpret_cast<const char *>(section->getHostAddr().value());
+        const DWord initSize    = std::min(physSize, virtualSize);
+
+        // Initialized data is loaded from the file, the rest is zero
+        QVERIFY(std::equal(sectionData, sectionData + initSize, data + physOffset));
+        QVERIFY(std::all_of(sectionData + initSize, sectionData + virtualSize,
+                            [](char c) { return c == 0; }));
+    }
+}
+
+
 QTEST_GUILESS_MAIN(Win32BinaryLoaderTest)
@@ -20,4 +20,7 @@ class Win32BinaryLoaderTest : public BoomerangTestWithPlugins
 private slots:
     /// Test loading Windows programs
     void testWinLoad();
+
+    /// Test that the sections are laid out at their relative virtual addresses
+    void testSectionLayout();
 };
@@ -0,0 +1,145 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "MetricsWatcherTest.h"
+
+
+#include "boomerang/core/MetricsWatcher.h"
+#include "boomerang/db/proc/LibProc.h"
+#include "boomerang/db/proc/UserProc.h"
+
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTemporaryDir>
+
+
+void MetricsWatcherTest::testDecodeMetrics()
+{
+    MetricsWatcher watcher;
+    UserProc proc(Address(0x1000), "test", nullptr);
+
+    watcher.onStartDecode(Address(0x1000), 100);
+    QCOMPARE(watcher.getMetrics().phase, DecompilationMetrics::Phase::Decoding);
+
+    for (int i = 0; i < 10; ++i) {
+        watcher.onInstructionDecoded(Address(0x1000 + 4 * i), 4);
+    }
+
+    watcher.onBadDecode(Address(0x1028));
+    watcher.onFunctionDecoded(&proc, Address(0x1000), Address(0x1028), 40);
+
+    DecompilationMetrics metrics = watcher.getMetrics();
+    QCOMPARE(metrics.numInstructionsDecoded, uint64(10));
+    QCOMPARE(metrics.numBytesDecoded, uint64(40));
+    QCOMPARE(metrics.numBytesToDecode, uint64(100));
+    QCOMPARE(metrics.numBadDecodes, uint64(1));
+    QCOMPARE(metrics.numFunctionsDecoded, uint64(1));
+
+    watcher.onEndDecode();
+    metrics = watcher.getMetrics();
+    QCOMPARE(metrics.phase, DecompilationMetrics::Phase::Idle);
+    QVERIFY(metrics.decodeSeconds > 0.0);
+    QVERIFY(metrics.instructionsPerSecond > 0.0);
+    QCOMPARE(metrics.etaSeconds, 0.0);
+
+    // the decode time does not advance after decoding has finished
+    QCOMPARE(watcher.getMetrics().decodeSeconds, metrics.decodeSeconds);
+}
+
+
+void MetricsWatcherTest::testDecompileMetrics()
+{
+    MetricsWatcher watcher;
+    UserProc proc1(Address(0x1000), "test1", nullptr);
+    UserProc proc2(Address(0x2000), "test2", nullptr);
+    UserProc proc3(Address(0x3000), "test3", nullptr);
+    LibProc libProc(Address(0x4000), "printf", nullptr);
+
+    watcher.onFunctionCreated(&proc1);
+    watcher.onFunctionCreated(&proc2);
+    watcher.onFunctionCreated(&proc3);
+    watcher.onFunctionCreated(&libProc);
+    QCOMPARE(watcher.getMetrics().numProcsRemaining, uint64(3));
+
+    watcher.onFunctionRemoved(&proc3);
+    QCOMPARE(watcher.getMetrics().numProcsRemaining, uint64(2));
+
+    watcher.onStartDecompile(&proc1);
+    watcher.onEndDecompile(&proc1);
+
+    DecompilationMetrics metrics = watcher.getMetrics();
+    QCOMPARE(metrics.phase, DecompilationMetrics::Phase::Decompiling);
+    QCOMPARE(metrics.numProcsDecompiled, uint64(1));
+    QCOMPARE(metrics.numProcsRemaining, uint64(1));
+
+    watcher.onStartDecompile(&proc2);
+    watcher.onEndDecompile(&proc2);
+    watcher.onDecompilationEnd();
+
+    metrics = watcher.getMetrics();
+    QCOMPARE(metrics.phase, DecompilationMetrics::Phase::Finished);
+    QCOMPARE(metrics.numProcsDecompiled, uint64(2));
+    QCOMPARE(metrics.numProcsRemaining, uint64(0));
+    QCOMPARE(metrics.etaSeconds, 0.0);
+}
+
+
+void MetricsWatcherTest::testReport()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+
+    const QString filePath = dir.filePath("metrics.json");
+
+    MetricsWatcher watcher;
+    QVERIFY(watcher.setOutputFile(filePath));
+    watcher.setLabel("test.exe");
+
+    watcher.onStartDecode(Address(0x1000), 4);
+    watcher.onInstructionDecoded(Address(0x1000), 4);
+    watcher.onEndDecode();
+    watcher.onDecompilationEnd();
+    QVERIFY(watcher.setOutputFile("")); // closes the file
+
+    QFile file(filePath);
+    QVERIFY(file.open(QFile::ReadOnly));
+    const QList<QByteArray> lines = file.readAll().trimmed().split('\n');
+    QCOMPARE(lines.size(), 2);
+
+    const QJsonObject decoded = QJsonDocument::fromJson(lines[0]).object();
+    QCOMPARE(decoded["label"].toString(), QString("test.exe"));
+    QCOMPARE(decoded["phase"].toString(), QString("idle"));
+    QCOMPARE(decoded["instructions"].toInt(), 1);
+    QCOMPARE(decoded["bytes"].toInt(), 4);
+
+    const QJsonObject finished = QJsonDocument::fromJson(lines[1]).object();
+    QCOMPARE(finished["phase"].toString(), QString("finished"));
+}
+
+
+void MetricsWatcherTest::testReset()
+{
+    MetricsWatcher watcher;
+    UserProc proc(Address(0x1000), "test", nullptr);
+
+    watcher.onFunctionCreated(&proc);
+    watcher.onInstructionDecoded(Address(0x1000), 4);
+    QCOMPARE(watcher.getMetrics().phase, DecompilationMetrics::Phase::Decoding);
+
+    watcher.reset();
+
+    const DecompilationMetrics metrics = watcher.getMetrics();
+    QCOMPARE(metrics.phase, DecompilationMetrics::Phase::Idle);
+    QCOMPARE(metrics.numInstructionsDecoded, uint64(0));
+    QCOMPARE(metrics.numProcsRemaining, uint64(0));
+    QCOMPARE(metrics.decodeSeconds, 0.0);
+}
+
+
+QTEST_GUILESS_MAIN(MetricsWatcherTest)
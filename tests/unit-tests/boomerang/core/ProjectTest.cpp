@@ -13,6 +13,14 @@
 #include "boomerang/core/Project.h"
 #include "boomerang/core/Settings.h"
 #include "boomerang/db/Prog.h"
+#include "boomerang/db/binary/BinaryFile.h"
+
+#include <QTemporaryDir>
+
+#include <thread>
+
+
+Q_DECLARE_METATYPE(LoadFmt)
 
 
 void ProjectTest::testLoadBinaryFile()
@@ -31,6 +39,45 @@ void ProjectTest::testLoadBinaryFile()
 
     // load while no other file is loaded
     QVERIFY(!project.loadBinaryFile("invalid"));
+
+    // load a file that does not match the signature of any loader
+    QTemporaryDir tempDir;
+    QVERIFY(tempDir.isValid());
+
+    QFile textFile(tempDir.filePath("text"));
+    QVERIFY(textFile.open(QFile::WriteOnly));
+    QVERIFY(textFile.write("This is not a binary file.\n") > 0);
+    textFile.close();
+
+    QVERIFY(!project.loadBinaryFile(textFile.fileName()));
+    QVERIFY(!project.isBinaryLoaded());
+}
+
+
+void ProjectTest::testLoadBinaryFileFormat()
+{
+    QFETCH(QString, sample);
+    QFETCH(LoadFmt, format);
+
+    Project project;
+    project.getSettings()->setDataDirectory(BOOMERANG_TEST_BASE "share/boomerang/");
+    project.getSettings()->setPluginDirectory(BOOMERANG_TEST_BASE "lib/boomerang/plugins/");
+    project.loadPlugins();
+
+    QVERIFY(project.loadBinaryFile(getFullSamplePath(sample)));
+    QCOMPARE(project.getLoadedBinaryFile()->getFormat(), format);
+}
+
+
+void ProjectTest::testLoadBinaryFileFormat_data()
+{
+    QTest::addColumn<QString>("sample");
+    QTest::addColumn<LoadFmt>("format");
+
+    QTest::newRow("ELF")    << "elf/hello-clang4-dynamic" << LoadFmt::ELF;
+    QTest::newRow("PE")     << "windows/hello.exe"        << LoadFmt::PE;
+    QTest::newRow("Palm")   << "mc68328/Starter.prc"      << LoadFmt::PALM;
+    QTest::newRow("Mach-O") << "OSX/hello"                << LoadFmt::MACHO;
 }
 
 
@@ -104,6 +151,23 @@ void ProjectTest::testDecompileBinaryFile()
 }
 
 
+void ProjectTest::testDecompileWithBudget()
+{
+    Project project;
+    project.getSettings()->setDataDirectory(BOOMERANG_TEST_BASE "share/boomerang/");
+    project.getSettings()->setPluginDirectory(BOOMERANG_TEST_BASE "lib/boomerang/plugins/");
+    project.getSettings()->procPassLimit = 1;
+    project.loadPlugins();
+
+    QVERIFY(project.loadBinaryFile(getFullSamplePath("elf/hello-clang4-dynamic")));
+    QVERIFY(project.decodeBinaryFile());
+    QVERIFY(project.decompileBinaryFile());
+
+    // procedures that ran out of budget are still emitted
+    QVERIFY(project.generateCode());
+}
+
+
 void ProjectTest::testGenerateCode()
 {
     Project project;
@@ -122,4 +186,41 @@ void ProjectTest::testGenerateCode()
 }
 
 
+void ProjectTest::testConcurrentDecompilation()
+{
+    const QStringList samples = { "elf/hello-clang4-dynamic", "pentium/hello", "pentium/fib",
+                                  "pentium/branch" };
+
+    QTemporaryDir outputDir;
+    QVERIFY(outputDir.isValid());
+
+    // not std::vector<bool>, since the threads write to different elements concurrently
+    std::vector<int> succeeded(samples.size(), 0);
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < samples.size(); i++) {
+        threads.emplace_back([&samples, &outputDir, &succeeded, i]() {
+            Project project;
+            project.getSettings()->setDataDirectory(BOOMERANG_TEST_BASE "share/boomerang/");
+            project.getSettings()->setPluginDirectory(BOOMERANG_TEST_BASE
+                                                      "lib/boomerang/plugins/");
+            project.getSettings()->setOutputDirectory(outputDir.filePath(QString::number(i)));
+            project.loadPlugins();
+
+            succeeded[i] = project.loadBinaryFile(getFullSamplePath(samples[i])) &&
+                           project.decodeBinaryFile() && project.decompileBinaryFile() &&
+                           project.generateCode();
+        });
+    }
+
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+
+    for (int i = 0; i < samples.size(); i++) {
+        QVERIFY2(succeeded[i], qPrintable(samples[i]));
+    }
+}
+
+
 QTEST_GUILESS_MAIN(ProjectTest)
@@ -24,6 +24,10 @@ private slots:
     /// Test the import binary function.
     void testLoadBinaryFile();
 
+    /// Test that files are loaded by the loader matching their signature
+    void testLoadBinaryFileFormat();
+    void testLoadBinaryFileFormat_data();
+
     // test loading/writing to/from a save file
     void testLoadSaveFile();
     void testWriteSaveFile();
@@ -33,5 +37,9 @@ private slots:
 
     void testDecodeBinaryFile();
     void testDecompileBinaryFile();
+    void testDecompileWithBudget();
     void testGenerateCode();
+
+    /// Decompile several binaries in separate projects concurrently
+    void testConcurrentDecompilation();
 };
@@ -309,8 +309,8 @@ void BasicBlockTest::testGetStmt()
 
     BasicBlock::RTLIterator rit;
     BasicBlock::RTLRIterator rrit;
-    StatementList::iterator sit;
-    StatementList::reverse_iterator srit;
+    RTL::iterator sit;
+    RTL::reverse_iterator srit;
 
     BasicBlock bb1(Address(0x1000), nullptr);
     QVERIFY(bb1.getFirstStmt() == nullptr);
@@ -13,19 +13,34 @@
 #include "boomerang/core/Settings.h"
 #include "boomerang/db/BasicBlock.h"
 #include "boomerang/db/DataFlow.h"
+#include "boomerang/db/DefCollector.h"
 #include "boomerang/db/module/Module.h"
+#include "boomerang/ssl/exp/Const.h"
 #include "boomerang/ssl/exp/Location.h"
+#include "boomerang/ssl/exp/RefExp.h"
 #include "boomerang/ssl/exp/Terminal.h"
 #include "boomerang/db/proc/UserProc.h"
 #include "boomerang/db/Prog.h"
 #include "boomerang/ssl/RTL.h"
+#include "boomerang/ssl/statements/Assign.h"
+#include "boomerang/ssl/statements/CallStatement.h"
+#include "boomerang/ssl/statements/PhiAssign.h"
+#include "boomerang/ssl/statements/ReturnStatement.h"
 #include "boomerang/frontend/pentium/PentiumFrontEnd.h"
+#include "boomerang/ssl/type/IntegerType.h"
 #include "boomerang/ssl/type/VoidType.h"
 #include "boomerang/util/log/Log.h"
 #include "boomerang/passes/PassManager.h"
 
 #include <QDebug>
 
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <map>
+#include <set>
+#include <tuple>
+
 
 #define FRONTIER_PENTIUM    (m_project.getSettings()->getDataDirectory().absoluteFilePath("samples/pentium/frontier"))
 #define SEMI_PENTIUM        (m_project.getSettings()->getDataDirectory().absoluteFilePath("samples/pentium/semi"))
@@ -115,6 +130,7 @@ void DataFlowTest::testCalculateDominators()
 
 void DataFlowTest::testPlacePhi()
 {
+    m_project.getSettings()->prunedSSA = false;
     QVERIFY(m_project.loadBinaryFile(FRONTIER_PENTIUM));
     QVERIFY(m_project.decodeBinaryFile());
 
@@ -151,6 +167,7 @@ void DataFlowTest::testPlacePhi()
 
 void DataFlowTest::testPlacePhi2()
 {
+    m_project.getSettings()->prunedSSA = false;
     QVERIFY(m_project.loadBinaryFile(IFTHEN_PENTIUM));
     QVERIFY(m_project.decodeBinaryFile());
 
@@ -181,6 +198,155 @@ void DataFlowTest::testPlacePhi2()
 }
 
 
+/// Pentium samples with loops, so that phi operands are renamed along back edges
+static const char *const LOOP_SAMPLES[] = { "frontier", "loop", "fibo_iter", "sumarray", "semi" };
+
+typedef std::function<void(UserProc *)> ProcFunc;
+
+
+/**
+ * Decode the pentium sample \p sample, place phi functions in all decoded procedures
+ * and rename their variables with \p rename.
+ * \param prepare if set, called for each procedure before the phi functions are placed
+ * \returns the renamed procedures, or an empty list if the sample could not be decoded
+ */
+static std::vector<UserProc *> decodeAndRename(Project &project, const QString &sample,
+                                               const ProcFunc &rename,
+                                               const ProcFunc &prepare = nullptr)
+{
+    std::vector<UserProc *> procs;
+
+    if (!project.loadBinaryFile(getFullSamplePath("pentium/" + sample)) ||
+        !project.decodeBinaryFile()) {
+        return procs;
+    }
+
+    Type::clearNamedTypes();
+
+    for (const auto &module : project.getProg()->getModuleList()) {
+        for (Function *func : *module) {
+            if (func->isLib() || !static_cast<UserProc *>(func)->isDecoded()) {
+                continue;
+            }
+
+            UserProc *proc = static_cast<UserProc *>(func);
+            DataFlow *df   = proc->getDataFlow();
+
+            if (prepare) {
+                prepare(proc);
+            }
+
+            df->calculateDominators();
+            df->placePhiFunctions();
+            proc->numberStatements(); // After placing phi functions!
+            rename(proc);
+            procs.push_back(proc);
+        }
+    }
+
+    return procs;
+}
+
+
+static void renameWithPass(UserProc *proc)
+{
+    PassManager::get()->executePass(PassID::BlockVarRename, proc);
+}
+
+
+/// A phi function, identified by its procedure, block and variable
+typedef std::tuple<QString, Address, QString> PhiKey;
+
+/**
+ * Decode \p sample, place phi functions in all procedures and rename the variables.
+ * \param placed receives all phi functions that were placed
+ * \param used receives the phi functions that are used by a statement other than a phi,
+ *             directly or via other used phi functions
+ */
+static void collectPhis(Project &project, const QString &sample, std::set<PhiKey> &placed,
+                        std::set<PhiKey> &used)
+{
+    const std::vector<UserProc *> procs = decodeAndRename(project, sample, renameWithPass);
+    QVERIFY2(!procs.empty(), qPrintable(sample));
+
+    for (UserProc *proc : procs) {
+        auto keyOf = [proc](const Statement *phi) {
+            return PhiKey(proc->getName(), phi->getBB()->getLowAddr(),
+                          static_cast<const PhiAssign *>(phi)->getLeft()->prints());
+        };
+
+        StatementList stmts;
+        proc->getStatements(stmts);
+        std::vector<const PhiAssign *> usedPhis;
+
+        for (const Statement *stmt : stmts) {
+            if (stmt->isPhi()) {
+                placed.insert(keyOf(stmt));
+                continue;
+            }
+
+            LocationSet locs;
+            stmt->addUsedLocs(locs);
+
+            for (const SharedExp &loc : locs) {
+                if (!loc->isSubscript()) {
+                    continue;
+                }
+
+                const Statement *def = std::static_pointer_cast<RefExp>(loc)->getDef();
+
+                if (def && def->isPhi() && used.insert(keyOf(def)).second) {
+                    usedPhis.push_back(static_cast<const PhiAssign *>(def));
+                }
+            }
+        }
+
+        // phi functions used by used phi functions are used, too
+        while (!usedPhis.empty()) {
+            const PhiAssign *phi = usedPhis.back();
+            usedPhis.pop_back();
+
+            for (const auto &operand : *phi) {
+                const Statement *def = operand.getDef();
+
+                if (def && def->isPhi() && used.insert(keyOf(def)).second) {
+                    usedPhis.push_back(static_cast<const PhiAssign *>(def));
+                }
+            }
+        }
+    }
+}
+
+
+void DataFlowTest::testPlacePhiPruned()
+{
+    for (const QString sample : LOOP_SAMPLES) {
+        std::set<PhiKey> unprunedPhis, unprunedUsed;
+        m_project.getSettings()->prunedSSA = false;
+        collectPhis(m_project, sample, unprunedPhis, unprunedUsed);
+        const Prog::PhiStats unprunedStats = m_project.getProg()->getPhiStats();
+        QCOMPARE(unprunedStats.numPruned, uint64(0));
+
+        std::set<PhiKey> prunedPhis, prunedUsed;
+        m_project.getSettings()->prunedSSA = true;
+        collectPhis(m_project, sample, prunedPhis, prunedUsed);
+        const Prog::PhiStats prunedStats = m_project.getProg()->getPhiStats();
+
+        // Every phi function is either placed or pruned
+        QCOMPARE(prunedStats.numPlaced + prunedStats.numPruned, unprunedStats.numPlaced);
+
+        // Pruning only removes phi functions that are not used
+        QVERIFY2(std::includes(unprunedPhis.begin(), unprunedPhis.end(), prunedPhis.begin(),
+                               prunedPhis.end()),
+                 qPrintable(sample));
+        QVERIFY2(std::includes(prunedPhis.begin(), prunedPhis.end(), unprunedUsed.begin(),
+                               unprunedUsed.end()),
+                 qPrintable(sample));
+        QVERIFY2(prunedUsed == unprunedUsed, qPrintable(sample));
+    }
+}
+
+
 void DataFlowTest::testRenameVars()
 {
     QVERIFY(m_project.loadBinaryFile(FRONTIER_PENTIUM));
@@ -206,4 +372,248 @@ void DataFlowTest::testRenameVars()
 }
 
 
+typedef std::map<SharedExp, std::deque<Statement *>, lessExpStar> DefStackMap;
+
+/**
+ * Reference implementation of BlockVarRenamePass: the original recursive renaming
+ * over the dominator tree with a map of definition stacks. Unlike the original, it restores
+ * the stacks after each dominator subtree, so definitions of bare locals do not leak
+ * into sibling subtrees.
+ */
+static void renameBlockVarsRecursive(UserProc *proc, int n, DefStackMap &stacks)
+{
+    static const SharedExp defineAll = Terminal::get(opDefineAll);
+
+    const bool assumeABI = proc->getProg()->getProject()->getSettings()->assumeABI;
+    BasicBlock *bb       = proc->getDataFlow()->nodeToBB(n);
+
+    auto getTop = [&stacks](const SharedExp &loc) -> Statement * {
+        auto it = stacks.find(loc);
+        return (it != stacks.end() && !it->second.empty()) ? it->second.back() : nullptr;
+    };
+
+    BasicBlock::RTLIterator rit;
+    RTL::iterator sit;
+
+    for (Statement *S = bb->getFirstStmt(rit, sit); S; S = bb->getNextStmt(rit, sit)) {
+        LocationSet locs;
+
+        if (S->isPhi()) {
+            PhiAssign *pa     = static_cast<PhiAssign *>(S);
+            SharedExp phiLeft = pa->getLeft();
+
+            if (phiLeft->isMemOf() || phiLeft->isRegOf()) {
+                phiLeft->getSubExp1()->addUsedLocs(locs);
+            }
+
+            for (auto &pp : *pa) {
+                if (pp.getDef() && pp.getDef()->isCall()) {
+                    static_cast<CallStatement *>(pp.getDef())->useBeforeDefine(phiLeft->clone());
+                }
+            }
+        }
+        else {
+            S->addUsedLocs(locs);
+        }
+
+        for (SharedExp location : locs) {
+            if (!proc->canRename(location)) {
+                continue;
+            }
+
+            if (location->isSubscript()) {
+                SharedExp base = location->getSubExp1();
+                Statement *def = std::static_pointer_cast<RefExp>(location)->getDef();
+
+                if (def && def->isCall()) {
+                    static_cast<CallStatement *>(def)->useBeforeDefine(base->clone());
+                }
+                else if (def == nullptr) {
+                    proc->markAsInitialParam(base->clone());
+                }
+
+                continue;
+            }
+
+            Statement *def = getTop(location);
+
+            if (!def) {
+                def = getTop(defineAll);
+            }
+
+            if (!def) {
+                proc->markAsInitialParam(location->clone());
+            }
+            else if (def->isCall()) {
+                static_cast<CallStatement *>(def)->useBeforeDefine(location->clone());
+            }
+
+            if (S->isPhi()) {
+                SharedExp phiLeft = static_cast<PhiAssign *>(S)->getLeft();
+                phiLeft->setSubExp1(phiLeft->getSubExp1()->expSubscriptVar(location, def));
+            }
+            else {
+                S->subscriptVar(location, def);
+            }
+        }
+
+        if (S->isCall() || S->isReturn()) {
+            std::vector<std::pair<SharedExp, Statement *>> reachingDefs;
+
+            for (auto &stack : stacks) {
+                if (!stack.second.empty()) {
+                    reachingDefs.push_back({ stack.first, stack.second.back() });
+                }
+            }
+
+            DefCollector *col = S->isCall() ? static_cast<CallStatement *>(S)->getDefCollector()
+                                            : static_cast<ReturnStatement *>(S)->getCollector();
+            col->updateDefs(reachingDefs, proc);
+        }
+
+        LocationSet defs;
+        S->getDefinitions(defs, assumeABI);
+
+        for (SharedExp a : defs) {
+            if (!proc->canRename(a)) {
+                continue;
+            }
+
+            stacks[a->clone()].push_back(S);
+
+            if (a->getOper() == opLocal) {
+                SharedConstExp a1 = proc->expFromSymbol(a->access<Const, 1>()->getStr());
+                stacks[a1->clone()].push_back(S);
+            }
+        }
+
+        if (S->isCall() && static_cast<CallStatement *>(S)->isChildless() && !assumeABI) {
+            stacks[defineAll];
+
+            for (auto &stack : stacks) {
+                stack.second.push_back(S);
+            }
+        }
+    }
+
+    for (BasicBlock *succ : bb->getSuccessors()) {
+        for (Statement *St = succ->getFirstStmt(rit, sit); St; St = succ->getNextStmt(rit, sit)) {
+            if (St->isPhi() && proc->canRename(static_cast<PhiAssign *>(St)->getLeft())) {
+                PhiAssign *pa = static_cast<PhiAssign *>(St);
+                pa->putAt(bb, getTop(pa->getLeft()), pa->getLeft());
+            }
+        }
+    }
+
+    // Remember the stack depths instead of popping the definitions statement by statement
+    std::map<SharedExp, std::size_t, lessExpStar> depths;
+    for (auto &stack : stacks) {
+        depths[stack.first] = stack.second.size();
+    }
+
+    for (int X = 0; X < proc->getCFG()->getNumBBs(); X++) {
+        if (X != n && proc->getDataFlow()->getIdom(X) == n) {
+            renameBlockVarsRecursive(proc, X, stacks);
+
+            for (auto &stack : stacks) {
+                auto it = depths.find(stack.first);
+                stack.second.resize(it != depths.end() ? it->second : 0);
+            }
+        }
+    }
+}
+
+
+static void renameWithReference(UserProc *proc)
+{
+    DefStackMap stacks;
+    renameBlockVarsRecursive(proc, 0, stacks);
+}
+
+
+/**
+ * Decode \p sample, rename the variables of all procedures with \p rename
+ * and return the printed statements of all procedures.
+ */
+static QStringList renameAndPrint(Project &project, const QString &sample, const ProcFunc &rename,
+                                  const ProcFunc &prepare = nullptr)
+{
+    QStringList result;
+
+    for (UserProc *proc : decodeAndRename(project, sample, rename, prepare)) {
+        StatementList stmts;
+        proc->getStatements(stmts);
+
+        for (const Statement *stmt : stmts) {
+            result.append(proc->getName() + ": " + stmt->prints());
+        }
+    }
+
+    return result;
+}
+
+
+/// Compare the statements renamed by BlockVarRenamePass with the reference renamer.
+static void compareWithReference(Project &project, const QString &sample,
+                                 const ProcFunc &prepare = nullptr)
+{
+    const QStringList expected = renameAndPrint(project, sample, renameWithReference, prepare);
+    const QStringList actual   = renameAndPrint(project, sample, renameWithPass, prepare);
+
+    QVERIFY2(!expected.empty(), qPrintable(sample));
+    QCOMPARE(actual.size(), expected.size());
+
+    for (int i = 0; i < actual.size(); i++) {
+        QCOMPARE(actual[i], expected[i]);
+    }
+}
+
+
+void DataFlowTest::testRenameVarsSubscriptsUses()
+{
+    for (const QString sample : LOOP_SAMPLES) {
+        compareWithReference(m_project, sample);
+        if (QTest::currentTestFailed()) {
+            return;
+        }
+    }
+}
+
+
+void DataFlowTest::testRenameVarsLocals()
+{
+    // None of the samples has locals before renaming, so map all definitions of eax to a local.
+    // Uses of eax are then defined by the assignments to the local.
+    int numLocalDefs = 0;
+
+    auto localiseEax = [&numLocalDefs](UserProc *proc) {
+        const SharedExp eax = Location::regOf(REG_PENT_EAX);
+        StatementList stmts;
+        proc->getStatements(stmts);
+
+        for (Statement *stmt : stmts) {
+            if (!stmt->isAssign() || !(*static_cast<Assign *>(stmt)->getLeft() == *eax)) {
+                continue;
+            }
+
+            if (!proc->expFromSymbol("local0")) {
+                proc->addLocal(IntegerType::get(32), "local0", eax->clone());
+            }
+
+            static_cast<Assign *>(stmt)->setLeft(Location::local("local0", proc));
+            numLocalDefs++;
+        }
+    };
+
+    for (const QString sample : LOOP_SAMPLES) {
+        compareWithReference(m_project, sample, localiseEax);
+        if (QTest::currentTestFailed()) {
+            return;
+        }
+    }
+
+    QVERIFY(numLocalDefs > 0);
+}
+
+
 QTEST_GUILESS_MAIN(DataFlowTest)
@@ -30,6 +30,15 @@ private slots:
     /// Test a case where a phi function is not needed
     void testPlacePhi2();
 
+    /// Test that pruned SSA places all used phi functions of unpruned SSA, and no others
+    void testPlacePhiPruned();
+
     /// Test the renaming of variables
     void testRenameVars();
+
+    /// Test that renaming gives the same statements as the recursive reference renamer
+    void testRenameVarsSubscriptsUses();
+
+    /// Test that definitions of locals also define the locations the locals are mapped to
+    void testRenameVarsLocals();
 };
@@ -0,0 +1,100 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "DefCollectorTest.h"
+
+
+#include "boomerang/db/DefCollector.h"
+#include "boomerang/ssl/exp/Const.h"
+#include "boomerang/ssl/exp/Location.h"
+#include "boomerang/ssl/exp/RefExp.h"
+#include "boomerang/ssl/exp/Terminal.h"
+#include "boomerang/ssl/exp/Ternary.h"
+#include "boomerang/ssl/statements/Assign.h"
+#include "boomerang/ssl/statements/ImplicitAssign.h"
+
+
+void DefCollectorTest::testInsert()
+{
+    DefCollector col;
+    QCOMPARE(col.size(), 0);
+
+    col.insert(new Assign(Location::regOf(REG_PENT_EAX), Const::get(1)));
+    col.insert(new Assign(Location::regOf(REG_PENT_ECX), Const::get(2)));
+    QCOMPARE(col.size(), 2);
+
+    // already defined
+    col.insert(new Assign(Location::regOf(REG_PENT_EAX), Const::get(3)));
+    QCOMPARE(col.size(), 2);
+    QCOMPARE(*col.findDefFor(Location::regOf(REG_PENT_EAX)), *Const::get(1));
+}
+
+
+void DefCollectorTest::testFindDefFor()
+{
+    DefCollector col;
+    QVERIFY(col.findDefFor(Location::regOf(REG_PENT_EAX)) == nullptr);
+
+    ImplicitAssign imp(Location::regOf(REG_PENT_ESP));
+    Assign def(Location::regOf(REG_PENT_EBX), Const::get(0));
+
+    // m[r28{-}] := 5, m[r27{def}] := 6, r24 := 7
+    col.insert(new Assign(Location::memOf(RefExp::get(Location::regOf(REG_PENT_ESP), nullptr)),
+                          Const::get(5)));
+    col.insert(new Assign(Location::memOf(RefExp::get(Location::regOf(REG_PENT_EBX), &def)),
+                          Const::get(6)));
+    col.insert(new Assign(Location::regOf(REG_PENT_EAX), Const::get(7)));
+
+    QCOMPARE(*col.findDefFor(Location::regOf(REG_PENT_EAX)), *Const::get(7));
+    QVERIFY(col.findDefFor(Location::regOf(REG_PENT_ECX)) == nullptr);
+
+    // a subscript of nullptr matches a subscript of an implicit assignment
+    QCOMPARE(*col.findDefFor(Location::memOf(RefExp::get(Location::regOf(REG_PENT_ESP), &imp))),
+             *Const::get(5));
+    QVERIFY(col.findDefFor(Location::memOf(RefExp::get(Location::regOf(REG_PENT_ESP), &def))) ==
+            nullptr);
+    QVERIFY(col.findDefFor(Location::memOf(RefExp::get(Location::regOf(REG_PENT_EBX), nullptr))) ==
+            nullptr);
+
+    // wildcards
+    SharedExp wildEbx = RefExp::get(Location::regOf(REG_PENT_EBX), STMT_WILD);
+    QCOMPARE(*col.findDefFor(Location::memOf(wildEbx)), *Const::get(6));
+    QCOMPARE(*col.findDefFor(Terminal::get(opWildRegOf)), *Const::get(7));
+}
+
+
+void DefCollectorTest::testExistsOnLeft()
+{
+    DefCollector col;
+    QVERIFY(!col.existsOnLeft(nullptr));
+    QVERIFY(!col.existsOnLeft(Location::regOf(REG_PENT_EAX)));
+
+    ImplicitAssign imp(Location::regOf(REG_PENT_ESP));
+
+    col.insert(new Assign(Location::memOf(RefExp::get(Location::regOf(REG_PENT_ESP), nullptr)),
+                          Const::get(5)));
+    col.insert(new Assign(Ternary::get(opAt, Location::regOf(REG_PENT_EAX), Const::get(0),
+                                       Const::get(7)),
+                          Const::get(1)));
+
+    QVERIFY(col.existsOnLeft(Location::memOf(RefExp::get(Location::regOf(REG_PENT_ESP), &imp))));
+    QVERIFY(col.existsOnLeft(Terminal::get(opWildMemOf)));
+
+    // foo@[x:y] defines foo
+    QVERIFY(col.existsOnLeft(Location::regOf(REG_PENT_EAX)));
+    QVERIFY(!col.existsOnLeft(Location::regOf(REG_PENT_ECX)));
+
+    // a location defined by a subscript of nullptr is not defined again
+    col.insert(new Assign(Location::memOf(RefExp::get(Location::regOf(REG_PENT_ESP), &imp)),
+                          Const::get(6)));
+    QCOMPARE(col.size(), 2);
+}
+
+
+QTEST_GUILESS_MAIN(DefCollectorTest)
@@ -135,6 +135,68 @@ void BinaryImageTest::testUpdateTextLimits()
 }
 
 
+void BinaryImageTest::testFindString()
+{
+    const char sectionData[16] = { 'a', 'b', '\0', '\x01', 'c', '\n', '\0', '\0',
+                                   '\x80', 'd', 'e', '\0', 'f', 'g', 'h', 'i' };
+
+    BinaryImage img(QByteArray{});
+    img.updateStringIndex();
+    QVERIFY(img.findString(Address(0x1000)) == nullptr);
+
+    BinarySection *sect1 = img.createSection("sect1", Address(0x1000), Address(0x1010));
+    sect1->setHostAddr(HostAddress(sectionData));
+    img.updateStringIndex();
+
+    QVERIFY(img.findString(Address(0x0FFF)) == nullptr);
+    QCOMPARE(img.findString(Address(0x1000)), "ab");
+    QCOMPARE(img.findString(Address(0x1001)), "b");
+    QVERIFY(img.findString(Address(0x1002)) == nullptr); // terminator
+    QCOMPARE(img.findString(Address(0x1003)), "\x01" "c\n"); // one control character is fine
+    QCOMPARE(img.findString(Address(0x1004)), "c\n");
+    QVERIFY(img.findString(Address(0x1007)) == nullptr);
+    QCOMPARE(img.findString(Address(0x1008)), "\x80" "de");
+    QCOMPARE(img.findString(Address(0x1009)), "de");
+    QVERIFY(img.findString(Address(0x100C)) == nullptr); // not terminated in the section
+
+    // UTF-8
+    const char utf8Data[] = "Hello w\xC3\xB6rld\0\xC3\xB6\xC3\xB6";
+
+    BinarySection *sect2 = img.createSection("sect2", Address(0x2000), Address(0x2012));
+    sect2->setHostAddr(HostAddress(utf8Data));
+    img.updateStringIndex();
+
+    QCOMPARE(img.findString(Address(0x1000)), "ab");
+    QCOMPARE(img.findString(Address(0x2000)), "Hello w\xC3\xB6rld");
+    QCOMPARE(img.findString(Address(0x2006)), "w\xC3\xB6rld");
+    QCOMPARE(img.findString(Address(0x2007)), "\xC3\xB6rld");
+    QVERIFY(img.findString(Address(0x200C)) == nullptr); // terminator
+    QVERIFY(img.findString(Address(0x200D)) == nullptr); // too many non-ASCII characters
+
+    // strings in code sections are not indexed, but still found
+    const char codeData[] = "\x55\x89\xE5\0xyz";
+
+    BinarySection *text = img.createSection("text", Address(0x3000), Address(0x3008));
+    text->setHostAddr(HostAddress(codeData));
+    text->setCode(true);
+    img.updateStringIndex();
+
+    QVERIFY(img.findString(Address(0x3000)) == nullptr); // too many non-ASCII characters
+    QVERIFY(img.findString(Address(0x3003)) == nullptr); // terminator
+    QCOMPARE(img.findString(Address(0x3004)), "xyz");
+
+    // no strings in BSS sections
+    BinarySection *bss = img.createSection("bss", Address(0x4000), Address(0x4004));
+    bss->setHostAddr(HostAddress("ab\0"));
+    bss->setBss(true);
+    img.updateStringIndex();
+    QVERIFY(img.findString(Address(0x4000)) == nullptr);
+
+    img.reset();
+    QVERIFY(img.findString(Address(0x1000)) == nullptr);
+}
+
+
 void BinaryImageTest::testRead()
 {
     char sectionData[8] = { 0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77 };
@@ -181,6 +243,43 @@ void BinaryImageTest::testRead()
 }
 
 
+void BinaryImageTest::testReadArray()
+{
+    Byte sectionData[12] = { 0x00, 0x11, 0x22, 0x33, 0x44, 0x55,
+                             0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB };
+    std::vector<DWord> values;
+
+    BinaryImage img(QByteArray{});
+    QCOMPARE(img.readNative4Array(Address(0x1000), 3, values), 0);
+    QVERIFY(values.empty());
+
+    BinarySection *sect1 = img.createSection("sect1", Address(0x1000), Address(0x100C));
+    sect1->setHostAddr(HostAddress(sectionData));
+    sect1->addDefinedArea(Address(0x1000), Address(0x1000) + sizeof(sectionData));
+
+    QCOMPARE(img.readNative4Array(Address(0x1000), 3, values), 3);
+    QCOMPARE(values, std::vector<DWord>({ 0x33221100, 0x77665544, 0xBBAA9988 }));
+
+    // table extends past the end of the section
+    QCOMPARE(img.readNative4Array(Address(0x1004), 3, values), 2);
+    QCOMPARE(values, std::vector<DWord>({ 0x77665544, 0xBBAA9988 }));
+
+    QCOMPARE(img.readNative4Array(Address(0x100A), 1, values), 0);
+    QVERIFY(values.empty());
+
+    // empty and negative counts
+    QCOMPARE(img.readNative4Array(Address(0x1000), 0, values), 0);
+    QVERIFY(values.empty());
+    QCOMPARE(img.readNative4Array(Address(0x1000), -1, values), 0);
+    QVERIFY(values.empty());
+
+    // big endian section
+    sect1->setEndian(Endian::Big);
+    QCOMPARE(img.readNative4Array(Address(0x1000), 2, values), 2);
+    QCOMPARE(values, std::vector<DWord>({ 0x00112233, 0x44556677 }));
+}
+
+
 void BinaryImageTest::testWrite()
 {
     char sectionData[8] = { 0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77 };
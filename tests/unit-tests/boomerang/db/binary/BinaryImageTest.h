@@ -26,8 +26,10 @@ private slots:
     void testGetSectionByAddr();
 
     void testUpdateTextLimits();
+    void testFindString();
 
     void testRead();
+    void testReadArray();
     void testWrite();
 
     void testIsReadOnly();
@@ -46,6 +46,26 @@ void BinarySymbolTableTest::testClear()
 }
 
 
+void BinarySymbolTableTest::testMove()
+{
+    BinarySymbolTable tbl;
+    BinarySymbol *sym = tbl.createSymbol(Address(0x1000), "testSym");
+
+    BinarySymbolTable moved(std::move(tbl));
+    QVERIFY(tbl.empty());
+    QVERIFY(tbl.findSymbolByAddress(Address(0x1000)) == nullptr);
+    QVERIFY(tbl.findSymbolByName("testSym") == nullptr);
+
+    QCOMPARE(moved.size(), 1);
+    QVERIFY(moved.findSymbolByAddress(Address(0x1000)) == sym);
+    QVERIFY(moved.findSymbolByName("testSym") == sym);
+
+    // the moved-from table can be reused
+    QVERIFY(tbl.createSymbol(Address(0x1000), "testSym") != nullptr);
+    QCOMPARE(tbl.size(), 1);
+}
+
+
 void BinarySymbolTableTest::testCreateSymbol()
 {
     BinarySymbolTable tbl;
@@ -66,6 +86,33 @@ void BinarySymbolTableTest::testCreateSymbol()
 }
 
 
+void BinarySymbolTableTest::testCreateSymbols()
+{
+    BinarySymbolTable tbl;
+    tbl.createSymbol(Address(0x3000), "existing");
+
+    const std::vector<BinarySymbol *> syms = tbl.createSymbols({
+        { Address(0x1000), "sym1", false },
+        { Address(0x2000), "local", true },
+        { Address(0x3000), "sym3", false },    // address clash
+        { Address(0x4000), "existing", false } // name clash
+    });
+
+    QCOMPARE(syms.size(), static_cast<std::size_t>(4));
+    QVERIFY(syms[0] != nullptr);
+    QCOMPARE(syms[0]->getName(), QString("sym1"));
+    QVERIFY(syms[1] != nullptr);
+    QVERIFY(syms[2] == nullptr);
+    QVERIFY(syms[3] == tbl.findSymbolByName("existing"));
+    QCOMPARE(tbl.size(), 3);
+
+    QVERIFY(tbl.findSymbolByAddress(Address(0x1000)) == syms[0]);
+    QVERIFY(tbl.findSymbolByAddress(Address(0x2000)) == syms[1]);
+    QVERIFY(tbl.findSymbolByName("local") == nullptr);
+    QVERIFY(tbl.findSymbolByAddress(Address(0x4000)) == syms[3]);
+}
+
+
 void BinarySymbolTableTest::testFindSymbolByAddress()
 {
     BinarySymbolTable tbl;
@@ -88,6 +135,54 @@ void BinarySymbolTableTest::testFindSymbolByName()
 }
 
 
+void BinarySymbolTableTest::testFindNearestSymbol()
+{
+    BinarySymbolTable tbl;
+    QVERIFY(tbl.findNearestSymbol(Address(0x1000)) == nullptr);
+
+    BinarySymbol *sym2 = tbl.createSymbol(Address(0x2000), "sym2");
+    QVERIFY(tbl.findNearestSymbol(Address(0x1FFF)) == nullptr);
+    QVERIFY(tbl.findNearestSymbol(Address(0x2000)) == sym2);
+    QVERIFY(tbl.findNearestSymbol(Address(0x2FFF)) == sym2);
+
+    // insert out of order after the first query
+    BinarySymbol *sym1 = tbl.createSymbol(Address(0x1000), "sym1");
+    BinarySymbol *sym3 = tbl.createSymbol(Address(0x3000), "sym3");
+    QVERIFY(tbl.findNearestSymbol(Address(0x0FFF)) == nullptr);
+    QVERIFY(tbl.findNearestSymbol(Address(0x1000)) == sym1);
+    QVERIFY(tbl.findNearestSymbol(Address(0x1FFF)) == sym1);
+    QVERIFY(tbl.findNearestSymbol(Address(0x2800)) == sym2);
+    QVERIFY(tbl.findNearestSymbol(Address(0xFFFF)) == sym3);
+
+    // bulk creation, sorted and unsorted
+    const std::vector<BinarySymbol *> sorted = tbl.createSymbols({
+        { Address(0x4000), "sym4", false },
+        { Address(0x5000), "sym5", false },
+    });
+    const std::vector<BinarySymbol *> unsorted = tbl.createSymbols({
+        { Address(0x7000), "sym7", false },
+        { Address(0x0800), "sym0", false },
+        { Address(0x6000), "sym6", false },
+    });
+
+    QVERIFY(tbl.findNearestSymbol(Address(0x07FF)) == nullptr);
+    QVERIFY(tbl.findNearestSymbol(Address(0x0800)) == unsorted[1]);
+    QVERIFY(tbl.findNearestSymbol(Address(0x1800)) == sym1);
+    QVERIFY(tbl.findNearestSymbol(Address(0x4800)) == sorted[0]);
+    QVERIFY(tbl.findNearestSymbol(Address(0x5800)) == sorted[1]);
+    QVERIFY(tbl.findNearestSymbol(Address(0x6800)) == unsorted[2]);
+    QVERIFY(tbl.findNearestSymbol(Address(0x8000)) == unsorted[0]);
+
+    // the sorted addresses move with the table
+    BinarySymbolTable moved(std::move(tbl));
+    QVERIFY(tbl.findNearestSymbol(Address(0x8000)) == nullptr);
+    QVERIFY(moved.findNearestSymbol(Address(0x8000)) == unsorted[0]);
+
+    moved.clear();
+    QVERIFY(moved.findNearestSymbol(Address(0x1000)) == nullptr);
+}
+
+
 void BinarySymbolTableTest::testRenameSymbol()
 {
     BinarySymbolTable tbl;
@@ -21,9 +21,12 @@ private slots:
     void testSize();
     void testEmpty();
     void testClear();
+    void testMove();
 
     void testCreateSymbol();
+    void testCreateSymbols();
     void testFindSymbolByAddress();
     void testFindSymbolByName();
+    void testFindNearestSymbol();
     void testRenameSymbol();
 };
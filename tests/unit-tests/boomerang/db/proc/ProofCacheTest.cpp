@@ -0,0 +1,131 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "ProofCacheTest.h"
+
+
+#include "boomerang/core/Settings.h"
+#include "boomerang/db/Prog.h"
+#include "boomerang/db/proc/ProofCache.h"
+#include "boomerang/db/proc/UserProc.h"
+#include "boomerang/ssl/exp/Binary.h"
+#include "boomerang/ssl/exp/Const.h"
+#include "boomerang/ssl/exp/Location.h"
+#include "boomerang/ssl/statements/ReturnStatement.h"
+
+
+#define SAMPLE(path)    (m_project.getSettings()->getDataDirectory().absoluteFilePath("samples/" path))
+
+
+void ProofCacheTest::testLookup()
+{
+    ProofCache cache;
+    UserProc proc(Address(0x1000), "test", nullptr);
+
+    SharedExp esp = Location::regOf(REG_PENT_ESP);
+    bool result   = false;
+
+    QVERIFY(!cache.lookup(&proc, esp, esp, result));
+
+    cache.store(&proc, esp, esp, true);
+    QVERIFY(cache.lookup(&proc, esp, esp, result));
+    QVERIFY(result);
+
+    // the right hand side of the query is simplified
+    QVERIFY(cache.lookup(&proc, esp, Binary::get(opPlus, esp, Const::get(0)), result));
+    QVERIFY(result);
+
+    cache.store(&proc, esp, Binary::get(opPlus, esp, Const::get(4)), false);
+    QVERIFY(cache.lookup(&proc, esp, Binary::get(opPlus, esp, Const::get(4)), result));
+    QVERIFY(!result);
+
+    UserProc other(Address(0x2000), "other", nullptr);
+    QVERIFY(!cache.lookup(&other, esp, esp, result));
+    QCOMPARE(cache.getStats().numHits, static_cast<uint64>(3));
+}
+
+
+void ProofCacheTest::testInvalidate()
+{
+    ProofCache cache;
+    UserProc proc1(Address(0x1000), "test1", nullptr);
+    UserProc proc2(Address(0x2000), "test2", nullptr);
+
+    SharedExp eax = Location::regOf(REG_PENT_EAX);
+    SharedExp esp = Location::regOf(REG_PENT_ESP);
+    bool result   = false;
+
+    cache.store(&proc1, esp, esp, true);
+    cache.store(&proc1, eax, eax, false);
+    cache.store(&proc2, esp, esp, true);
+
+    // Proving something new might make failed proofs succeed
+    cache.store(&proc2, eax, eax, true);
+    QVERIFY(!cache.lookup(&proc1, eax, eax, result));
+    QVERIFY(cache.lookup(&proc1, esp, esp, result));
+
+    cache.store(&proc1, eax, eax, false);
+    cache.invalidate(&proc2);
+    QVERIFY(!cache.lookup(&proc2, esp, esp, result));
+    QVERIFY(!cache.lookup(&proc1, eax, eax, result));
+    QVERIFY(cache.lookup(&proc1, esp, esp, result));
+    QVERIFY(result);
+
+    cache.clear();
+    QVERIFY(!cache.lookup(&proc1, esp, esp, result));
+}
+
+
+void ProofCacheTest::testPremises()
+{
+    ProofCache cache;
+    QVERIFY(!cache.hasPremises());
+
+    cache.addPremise();
+    cache.addPremise();
+    QVERIFY(cache.hasPremises());
+
+    cache.removePremise();
+    QVERIFY(cache.hasPremises());
+    cache.removePremise();
+    QVERIFY(!cache.hasPremises());
+}
+
+
+void ProofCacheTest::testProveEqual()
+{
+    QVERIFY(m_project.loadBinaryFile(SAMPLE("pentium/fib")));
+    QVERIFY(m_project.decodeBinaryFile());
+    QVERIFY(m_project.decompileBinaryFile());
+
+    UserProc *fib = static_cast<UserProc *>(m_project.getProg()->getFunctionByName("fib"));
+    QVERIFY(fib && !fib->isLib());
+
+    ProofCache *cache = m_project.getProg()->getProofCache();
+    QVERIFY(!cache->hasPremises());
+    QVERIFY(cache->getStats().numQueries > 0);
+    QVERIFY(cache->getNumProverCalls(fib) > 0);
+
+    // The second query must be answered by the cache.
+    const bool result    = fib->preservesExp(Location::regOf(REG_PENT_EAX));
+    const uint64 numHits = cache->getStats().numHits;
+    QCOMPARE(fib->preservesExp(Location::regOf(REG_PENT_EAX)), result);
+    QCOMPARE(cache->getStats().numHits, numHits + 1);
+
+    // Removing the return statement might change the result of the proof.
+    ReturnStatement *retStmt = fib->getRetStmt();
+    const Address retAddr    = fib->getRetAddr();
+    fib->removeRetStmt();
+    fib->setRetStmt(retStmt, retAddr);
+    QCOMPARE(fib->preservesExp(Location::regOf(REG_PENT_EAX)), result);
+    QCOMPARE(cache->getStats().numHits, numHits + 1);
+}
+
+
+QTEST_GUILESS_MAIN(ProofCacheTest)
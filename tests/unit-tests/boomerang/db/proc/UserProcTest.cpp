@@ -15,6 +15,7 @@
 
 
 #include "boomerang/core/Settings.h"
+#include "boomerang/db/BasicBlock.h"
 #include "boomerang/db/proc/ProcCFG.h"
 #include "boomerang/ssl/exp/Binary.h"
 #include "boomerang/ssl/exp/Const.h"
@@ -25,6 +26,7 @@
 #include "boomerang/ssl/RTL.h"
 #include "boomerang/db/signature/PentiumSignature.h"
 #include "boomerang/ssl/statements/Assign.h"
+#include "boomerang/ssl/statements/ImplicitAssign.h"
 #include "boomerang/ssl/statements/ReturnStatement.h"
 #include "boomerang/ssl/statements/CallStatement.h"
 #include "boomerang/ssl/statements/PhiAssign.h"
@@ -133,6 +135,61 @@ void UserProcTest::testInsertStatementAfter()
 }
 
 
+void UserProcTest::testGetStatements()
+{
+    UserProc proc(Address(0x1000), "test", nullptr);
+    QVERIFY(proc.getStatements().empty());
+
+    Assign *as1 = new Assign(VoidType::get(), Location::regOf(REG_PENT_EAX), Location::regOf(REG_PENT_ECX));
+    Assign *as2 = new Assign(VoidType::get(), Location::regOf(REG_PENT_EDX), Location::regOf(REG_PENT_EBX));
+
+    std::unique_ptr<RTLList> bbRTLs(new RTLList);
+    bbRTLs->push_back(std::unique_ptr<RTL>(new RTL(Address(0x1000), { as1 })));
+    proc.getCFG()->createBB(BBType::Fall, std::move(bbRTLs));
+    proc.setEntryBB();
+
+    QVERIFY(proc.getStatements() == std::vector<Statement *>({ as1 }));
+    QVERIFY(as1->getProc() == &proc);
+
+    // the cached list must be returned as long as nothing changed
+    const std::vector<Statement *> *cached = &proc.getStatements();
+    QVERIFY(&proc.getStatements() == cached);
+    QCOMPARE(proc.getStatements().size(), size_t(1));
+
+    proc.insertStatementAfter(as1, as2);
+    QVERIFY(proc.getStatements() == std::vector<Statement *>({ as1, as2 }));
+
+    proc.removeStatement(as1);
+    QVERIFY(proc.getStatements() == std::vector<Statement *>({ as2 }));
+    delete as1;
+
+    StatementList stmts;
+    proc.getStatements(stmts);
+    QCOMPARE(stmts.size(), size_t(1));
+    QVERIFY(*stmts.begin() == as2);
+
+    // changes to other procedures do not affect the list
+    UserProc other(Address(0x2000), "other", nullptr);
+    std::unique_ptr<RTLList> otherRTLs(new RTLList);
+    otherRTLs->push_back(std::unique_ptr<RTL>(new RTL(Address(0x2000), { new Assign(
+        VoidType::get(), Location::regOf(REG_PENT_EAX), Location::regOf(REG_PENT_EBX)) })));
+    other.getCFG()->createBB(BBType::Fall, std::move(otherRTLs));
+    other.setEntryBB();
+
+    QCOMPARE(other.getStatements().size(), size_t(1));
+    QVERIFY(proc.getStatements() == std::vector<Statement *>({ as2 }));
+
+    // statements added by the BB itself
+    BasicBlock *bb = proc.getCFG()->getEntryBB();
+    ImplicitAssign *imp = bb->addImplicitAssign(Location::regOf(REG_PENT_ESI));
+    QVERIFY(proc.getStatements() == std::vector<Statement *>({ imp, as2 }));
+
+    // removing the BB removes its statements
+    proc.getCFG()->removeBB(bb);
+    QVERIFY(proc.getStatements().empty());
+}
+
+
 void UserProcTest::testAddParameterToSignature()
 {
     UserProc proc(Address(0x1000), "test", nullptr);
@@ -0,0 +1,158 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "DecompilationBudgetTest.h"
+
+
+#include "boomerang/core/Settings.h"
+#include "boomerang/db/proc/UserProc.h"
+#include "boomerang/decomp/DecompilationBudget.h"
+
+#include <QThread>
+
+
+void DecompilationBudgetTest::testUnlimited()
+{
+    Settings settings;
+    DecompilationBudget budget(&settings);
+    UserProc proc(Address(0x1000), "test", nullptr);
+
+    budget.start();
+
+    for (int i = 0; i < 1000; ++i) {
+        QVERIFY(budget.chargePass(&proc));
+    }
+
+    QVERIFY(!budget.isExhausted(&proc));
+    QVERIFY(!budget.isDegraded(&proc));
+    QVERIFY(!budget.isDeadlineExceeded());
+}
+
+
+void DecompilationBudgetTest::testPassLimit()
+{
+    Settings settings;
+    settings.procPassLimit = 3;
+
+    DecompilationBudget budget(&settings);
+    UserProc proc1(Address(0x1000), "test1", nullptr);
+    UserProc proc2(Address(0x2000), "test2", nullptr);
+
+    budget.start();
+
+    QVERIFY(budget.chargePass(&proc1));
+    QVERIFY(budget.chargePass(&proc1));
+    QVERIFY(budget.chargePass(&proc1));
+    QVERIFY(!budget.isDegraded(&proc1));
+
+    QVERIFY(!budget.chargePass(&proc1));
+    QVERIFY(budget.isExhausted(&proc1));
+    QVERIFY(budget.isDegraded(&proc1));
+
+    // the budget is per procedure
+    QVERIFY(budget.chargePass(&proc2));
+    QVERIFY(!budget.isDegraded(&proc2));
+    QVERIFY(!budget.isDeadlineExceeded());
+}
+
+
+void DecompilationBudgetTest::testTimeLimit()
+{
+    Settings settings;
+    settings.procTimeLimit = 1;
+
+    DecompilationBudget budget(&settings);
+    UserProc proc(Address(0x1000), "test", nullptr);
+
+    budget.start();
+    QVERIFY(budget.chargePass(&proc));
+
+    // time outside of passes on the procedure is not charged
+    QThread::msleep(1100);
+    QVERIFY(budget.chargePass(&proc));
+
+    budget.beginPass(&proc);
+    QThread::msleep(600);
+    budget.endPass(&proc);
+    QVERIFY(budget.chargePass(&proc));
+
+    budget.beginPass(&proc);
+    QThread::msleep(600);
+    budget.endPass(&proc);
+    QVERIFY(!budget.chargePass(&proc));
+    QVERIFY(budget.isDegraded(&proc));
+}
+
+
+void DecompilationBudgetTest::testNestedPasses()
+{
+    Settings settings;
+    settings.procTimeLimit = 1;
+
+    DecompilationBudget budget(&settings);
+    UserProc caller(Address(0x1000), "caller", nullptr);
+    UserProc callee(Address(0x2000), "callee", nullptr);
+
+    budget.start();
+
+    // while a pass on the callee is executed inside a pass on the caller,
+    // only the callee is charged
+    budget.beginPass(&caller);
+    budget.beginPass(&callee);
+    QThread::msleep(1100);
+    budget.endPass(&callee);
+    budget.endPass(&caller);
+
+    QVERIFY(budget.isExhausted(&callee));
+    QVERIFY(!budget.isExhausted(&caller));
+}
+
+
+void DecompilationBudgetTest::testCancel()
+{
+    Settings settings;
+    DecompilationBudget budget(&settings);
+    UserProc proc(Address(0x1000), "test", nullptr);
+
+    budget.start();
+    QVERIFY(budget.chargePass(&proc));
+
+    budget.cancel();
+    QVERIFY(budget.isCancelled());
+    QVERIFY(budget.isDeadlineExceeded());
+    QVERIFY(!budget.chargePass(&proc));
+    QVERIFY(budget.isDegraded(&proc));
+
+    // restarting clears the cancellation request
+    budget.start();
+    QVERIFY(!budget.isCancelled());
+    QVERIFY(budget.chargePass(&proc));
+}
+
+
+void DecompilationBudgetTest::testReset()
+{
+    Settings settings;
+    settings.procPassLimit = 1;
+
+    DecompilationBudget budget(&settings);
+    UserProc proc(Address(0x1000), "test", nullptr);
+
+    budget.start();
+    QVERIFY(budget.chargePass(&proc));
+    QVERIFY(!budget.chargePass(&proc));
+    QVERIFY(budget.isDegraded(&proc));
+
+    budget.reset();
+    QVERIFY(!budget.isDegraded(&proc));
+    QVERIFY(budget.chargePass(&proc));
+}
+
+
+QTEST_GUILESS_MAIN(DecompilationBudgetTest)
@@ -0,0 +1,175 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "LinearSweepDecoderTest.h"
+
+
+#include "boomerang/db/binary/BinaryImage.h"
+#include "boomerang/db/binary/BinarySection.h"
+#include "boomerang/frontend/LinearSweepDecoder.h"
+#include "boomerang/ifc/IDecoder.h"
+#include "boomerang/ssl/RTL.h"
+
+#include <QByteArray>
+
+
+/**
+ * Decodes a toy instruction set: 0xFF is invalid,
+ * every other byte starts an instruction of ((byte % 4) + 1) bytes.
+ */
+class ToyDecoder : public IDecoder
+{
+public:
+    bool decodeInstruction(Address pc, ptrdiff_t delta, DecodeResult &result) override
+    {
+        result.reset();
+
+        const Byte opcode = *reinterpret_cast<const Byte *>(pc.value() + delta);
+        if (opcode == 0xFF) {
+            result.valid = false;
+            return false;
+        }
+
+        result.numBytes = (opcode % 4) + 1;
+        result.rtl.reset(new RTL(pc));
+        return true;
+    }
+
+    bool canDecodeConcurrently() const override { return true; }
+
+    QString getRegName(int) const override { return ""; }
+    int getRegIdx(const QString &) const override { return -1; }
+    int getRegSize(int) const override { return 32; }
+};
+
+
+static QByteArray makeCode(int size)
+{
+    QByteArray code(size, 0);
+    unsigned int state = 12345;
+
+    for (int i = 0; i < size; ++i) {
+        state   = state * 1103515245 + 12345;
+        code[i] = static_cast<char>((state >> 16) & 0xFF);
+    }
+
+    return code;
+}
+
+
+/// \returns the addresses of all instructions found by a linear sweep of \p code
+static std::vector<Address> sweepReference(const QByteArray &code, Address base)
+{
+    std::vector<Address> result;
+    int i = 0;
+
+    while (i < code.size()) {
+        const Byte opcode  = static_cast<Byte>(code[i]);
+        const int numBytes = (opcode % 4) + 1;
+
+        if (opcode == 0xFF || i + numBytes > code.size()) {
+            i++;
+            continue;
+        }
+
+        result.push_back(base + i);
+        i += numBytes;
+    }
+
+    return result;
+}
+
+
+void LinearSweepDecoderTest::testSweep()
+{
+    const QByteArray code = makeCode(5000);
+    const std::vector<Address> expected = sweepReference(code, Address(0x1000));
+
+    BinaryImage img(QByteArray{});
+    BinarySection *text = img.createSection(".text", Address(0x1000),
+                                            Address(0x1000) + code.size());
+    QVERIFY(text != nullptr);
+    text->setHostAddr(HostAddress(code.constData()));
+    text->setCode(true);
+
+    ToyDecoder decoder;
+
+    for (int numThreads : { 1, 4 }) {
+        for (int chunkSize : { 1, 7, 64, LinearSweepDecoder::DEFAULT_CHUNK_SIZE }) {
+            LinearSweepDecoder sweep(&decoder, &img);
+            sweep.sweep(numThreads, chunkSize);
+
+            QCOMPARE(sweep.getNumInstructions(), static_cast<int>(expected.size()));
+            QCOMPARE(sweep.getNumCodeBytes(), code.size());
+
+            for (Address addr : expected) {
+                DecodeResult result;
+                QVERIFY(sweep.take(addr, result));
+                QVERIFY(result.valid);
+                QVERIFY(result.rtl != nullptr);
+                QCOMPARE(result.rtl->getAddress(), addr);
+            }
+        }
+    }
+}
+
+
+void LinearSweepDecoderTest::testTake()
+{
+    // 0x1000: 3 bytes, 0x1003: invalid, 0x1004: 1 byte
+    const QByteArray code("\x02\x00\x00\xFF\x00", 5);
+
+    BinaryImage img(QByteArray{});
+    BinarySection *text = img.createSection(".text", Address(0x1000), Address(0x1005));
+    text->setHostAddr(HostAddress(code.constData()));
+    text->setCode(true);
+
+    ToyDecoder decoder;
+    LinearSweepDecoder sweep(&decoder, &img);
+    sweep.sweep(1);
+
+    QCOMPARE(sweep.getNumInstructions(), 2);
+    QCOMPARE(sweep.getNumDecodedBytes(), 4);
+
+    DecodeResult result;
+    QVERIFY(!sweep.take(Address(0x1001), result));
+    QVERIFY(!sweep.take(Address(0x1003), result));
+    QVERIFY(!sweep.take(Address(0x2000), result));
+
+    QVERIFY(sweep.take(Address(0x1000), result));
+    QCOMPARE(result.numBytes, 3);
+    QVERIFY(!sweep.take(Address(0x1000), result));
+
+    QVERIFY(sweep.take(Address(0x1004), result));
+    QCOMPARE(result.numBytes, 1);
+}
+
+
+void LinearSweepDecoderTest::testCodeSectionsOnly()
+{
+    const QByteArray code = makeCode(100);
+
+    BinaryImage img(QByteArray{});
+    BinarySection *data = img.createSection(".data", Address(0x1000), Address(0x1064));
+    data->setHostAddr(HostAddress(code.constData()));
+    data->setCode(false);
+
+    ToyDecoder decoder;
+    LinearSweepDecoder sweep(&decoder, &img);
+    sweep.sweep();
+
+    QCOMPARE(sweep.getNumInstructions(), 0);
+    QCOMPARE(sweep.getNumCodeBytes(), 0);
+
+    DecodeResult result;
+    QVERIFY(!sweep.take(Address(0x1000), result));
+}
+
+
+QTEST_GUILESS_MAIN(LinearSweepDecoderTest)
@@ -0,0 +1,29 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include "TestUtils.h"
+
+
+class LinearSweepDecoderTest : public BoomerangTest
+{
+    Q_OBJECT
+
+private slots:
+    /// Multi-threaded sweeps must find the same instructions as a single-threaded sweep
+    void testSweep();
+
+    /// Instructions can only be taken once, and only at instruction boundaries
+    void testTake();
+
+    /// Only code sections are swept
+    void testCodeSectionsOnly();
+};
@@ -10,21 +10,50 @@
 #include "PentiumFrontEndTest.h"
 
 
+#include "boomerang/core/Settings.h"
+#include "boomerang/core/Watcher.h"
 #include "boomerang/db/Prog.h"
+#include "boomerang/db/module/Module.h"
+#include "boomerang/db/proc/UserProc.h"
 #include "boomerang/frontend/pentium/PentiumFrontEnd.h"
 #include "boomerang/ifc/IDecoder.h"
 #include "boomerang/ssl/RTL.h"
+#include "boomerang/util/StatementList.h"
 #include "boomerang/util/Types.h"
 #include "boomerang/util/log/Log.h"
 
 #include <QDebug>
 
+#include <map>
+
 
 #define HELLO_PENT      getFullSamplePath("pentium/hello")
 #define BRANCH_PENT     getFullSamplePath("pentium/branch")
 #define FEDORA2_TRUE    getFullSamplePath("pentium/fedora2_true")
 #define FEDORA3_TRUE    getFullSamplePath("pentium/fedora3_true")
 #define SUSE_TRUE       getFullSamplePath("pentium/suse_true")
+#define PARAMCHAIN_PENT getFullSamplePath("pentium/paramchain")
+#define REGALIAS_PENT   getFullSamplePath("pentium/regalias")
+
+
+/// Counts how often each function is decoded.
+class DecodeCounter : public IWatcher
+{
+public:
+    void onFunctionDecoded(Function *function, Address, Address, int) override
+    {
+        m_numDecoded[function->getEntryAddress()]++;
+    }
+
+    int getNumDecoded(Address entryAddr) const
+    {
+        auto it = m_numDecoded.find(entryAddr);
+        return it != m_numDecoded.end() ? it->second : 0;
+    }
+
+private:
+    std::map<Address, int> m_numDecoded;
+};
 
 
 void FrontPentTest::test1()
@@ -216,4 +245,76 @@ void FrontPentTest::testFindMain()
 }
 
 
+void FrontPentTest::testDecodeUndecoded()
+{
+    QVERIFY(m_project.loadBinaryFile(PARAMCHAIN_PENT));
+
+    DecodeCounter counter;
+    m_project.addWatcher(&counter);
+    const bool decoded = m_project.decodeBinaryFile();
+    m_project.removeWatcher(&counter);
+    QVERIFY(decoded);
+
+    int numUserProcs = 0;
+
+    for (const auto &module : m_project.getProg()->getModuleList()) {
+        for (Function *function : *module) {
+            if (function->isLib()) {
+                continue;
+            }
+
+            QVERIFY(static_cast<UserProc *>(function)->isDecoded());
+            QCOMPARE(counter.getNumDecoded(function->getEntryAddress()), 1);
+            numUserProcs++;
+        }
+    }
+
+    // main calls passem, which calls addem
+    QVERIFY(numUserProcs >= 3);
+}
+
+
+void FrontPentTest::testProcessOverlapped()
+{
+    Prog::OverlapStats eager;
+    Prog::OverlapStats pruned;
+    int numStmtsEager  = 0;
+    int numStmtsPruned = 0;
+
+    for (bool prune : { false, true }) {
+        m_project.getSettings()->prunedOverlaps = prune;
+        QVERIFY(m_project.loadBinaryFile(REGALIAS_PENT));
+        QVERIFY(m_project.decodeBinaryFile());
+
+        int numStmts = 0;
+        for (const auto &module : m_project.getProg()->getModuleList()) {
+            for (Function *function : *module) {
+                if (!function->isLib()) {
+                    StatementList stmts;
+                    static_cast<UserProc *>(function)->getStatements(stmts);
+                    numStmts += stmts.size();
+                }
+            }
+        }
+
+        if (prune) {
+            pruned         = m_project.getProg()->getOverlapStats();
+            numStmtsPruned = numStmts;
+        }
+        else {
+            eager         = m_project.getProg()->getOverlapStats();
+            numStmtsEager = numStmts;
+        }
+    }
+
+    m_project.getSettings()->prunedOverlaps = true;
+
+    // Eager mode inserts every assignment; pruning only leaves out some of them
+    QVERIFY(eager.numInserted > 0);
+    QCOMPARE(eager.numPruned, uint64(0));
+    QCOMPARE(pruned.numInserted + pruned.numPruned, eager.numInserted);
+    QCOMPARE(numStmtsEager - numStmtsPruned, static_cast<int>(pruned.numPruned));
+}
+
+
 QTEST_GUILESS_MAIN(FrontPentTest)
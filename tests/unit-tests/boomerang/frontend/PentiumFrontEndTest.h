@@ -24,4 +24,10 @@ private slots:
     void testFindMain();
     void testBranch();
 
+    /// Test that all procedures are decoded exactly once by decodeUndecoded
+    void testDecodeUndecoded();
+
+    /// Test that only dead assignments to overlapping registers are pruned
+    void testProcessOverlapped();
+
 };
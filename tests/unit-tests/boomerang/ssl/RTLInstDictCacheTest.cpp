@@ -0,0 +1,130 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "RTLInstDictCacheTest.h"
+
+
+#include "boomerang/ssl/RTL.h"
+#include "boomerang/ssl/RTLInstDict.h"
+#include "boomerang/ssl/RTLInstDictCache.h"
+#include "boomerang/util/OStream.h"
+
+#include <QTemporaryDir>
+
+
+#define SSL_DIR BOOMERANG_TEST_BASE "share/boomerang/ssl/"
+
+
+void RTLInstDictCacheTest::testRoundTrip()
+{
+    QFETCH(QString, sslFile);
+
+    const QString sslPath    = SSL_DIR + sslFile;
+    const QByteArray sslHash = RTLInstDictCache::hashSSLFile(sslPath);
+    QVERIFY(!sslHash.isEmpty());
+
+    QTemporaryDir cacheDir;
+    QVERIFY(cacheDir.isValid());
+    const QString cacheFilePath = cacheDir.filePath(sslFile + "cache");
+
+    RTLInstDict parsed;
+    QVERIFY(parsed.readSSLFile(sslPath));
+    QVERIFY(RTLInstDictCache::writeCacheFile(parsed, cacheFilePath, sslHash));
+
+    RTLInstDict loaded;
+    QVERIFY(RTLInstDictCache::readCacheFile(loaded, cacheFilePath, sslHash));
+
+    QString expected, actual;
+    OStream expectedStream(&expected), actualStream(&actual);
+    parsed.print(expectedStream);
+    loaded.print(actualStream);
+
+    QVERIFY(!expected.isEmpty());
+    QCOMPARE(actual, expected);
+
+    for (int regID = 0; regID < 128; ++regID) {
+        QCOMPARE(loaded.getRegNameByID(regID), parsed.getRegNameByID(regID));
+        QCOMPARE(loaded.getRegSizeByID(regID), parsed.getRegSizeByID(regID));
+
+        int loadedOffset = -1, parsedOffset = -1;
+        QCOMPARE(loaded.getRegParentByID(regID, loadedOffset),
+                 parsed.getRegParentByID(regID, parsedOffset));
+        QCOMPARE(loadedOffset, parsedOffset);
+    }
+}
+
+
+void RTLInstDictCacheTest::testRoundTrip_data()
+{
+    QTest::addColumn<QString>("sslFile");
+
+    QTest::newRow("pentium") << "pentium.ssl";
+    QTest::newRow("sparc")   << "sparc.ssl";
+    QTest::newRow("ppc")     << "ppc.ssl";
+    QTest::newRow("mips")    << "mips.ssl";
+    QTest::newRow("st20")    << "st20.ssl";
+}
+
+
+void RTLInstDictCacheTest::testInvalidCacheFile()
+{
+    const QString sslPath    = SSL_DIR "sparc.ssl";
+    const QByteArray sslHash = RTLInstDictCache::hashSSLFile(sslPath);
+
+    QTemporaryDir cacheDir;
+    QVERIFY(cacheDir.isValid());
+    const QString cacheFilePath = cacheDir.filePath("sparc.sslcache");
+
+    RTLInstDict dict;
+    QVERIFY(!RTLInstDictCache::readCacheFile(dict, cacheFilePath, sslHash)); // does not exist
+
+    RTLInstDict parsed;
+    QVERIFY(parsed.readSSLFile(sslPath));
+    QVERIFY(RTLInstDictCache::writeCacheFile(parsed, cacheFilePath, sslHash));
+
+    // SSL file changed
+    QVERIFY(!RTLInstDictCache::readCacheFile(dict, cacheFilePath, QByteArray("other hash")));
+    QCOMPARE(dict.getSignature("ADD").second, -1);
+
+    // truncated cache file
+    QFile file(cacheFilePath);
+    QVERIFY(file.resize(file.size() / 2));
+    QVERIFY(!RTLInstDictCache::readCacheFile(dict, cacheFilePath, sslHash));
+    QCOMPARE(dict.getSignature("ADD").second, -1);
+}
+
+
+void RTLInstDictCacheTest::testGetDictionary()
+{
+    QTemporaryDir cacheDir;
+    QVERIFY(cacheDir.isValid());
+
+    std::shared_ptr<const RTLInstDict> dict1 = RTLInstDictCache::getDictionary(
+        SSL_DIR "mips.ssl", false, cacheDir.path());
+    std::shared_ptr<const RTLInstDict> dict2 = RTLInstDictCache::getDictionary(
+        SSL_DIR "mips.ssl", false, cacheDir.path());
+
+    QVERIFY(dict1 != nullptr);
+    QVERIFY(dict1 == dict2);
+    QVERIFY(!QDir(cacheDir.path()).entryList({ "mips-*.sslcache" }, QDir::Files).isEmpty());
+
+    // not shared any more: load from the cache file
+    dict1.reset();
+    dict2.reset();
+
+    std::shared_ptr<const RTLInstDict> dict3 = RTLInstDictCache::getDictionary(
+        SSL_DIR "mips.ssl", false, cacheDir.path());
+    QVERIFY(dict3 != nullptr);
+    QVERIFY(dict3->getSignature("JR").second != -1);
+
+    QVERIFY(RTLInstDictCache::getDictionary(SSL_DIR "nonexistent.ssl", false, "") == nullptr);
+}
+
+
+QTEST_GUILESS_MAIN(RTLInstDictCacheTest)
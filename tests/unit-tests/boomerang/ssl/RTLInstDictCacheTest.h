@@ -0,0 +1,33 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include "TestUtils.h"
+
+
+/**
+ * Tests reading and writing SSL cache files
+ */
+class RTLInstDictCacheTest : public BoomerangTest
+{
+    Q_OBJECT
+
+private slots:
+    /// Test that a dictionary read from a cache file is identical to the parsed dictionary
+    void testRoundTrip();
+    void testRoundTrip_data();
+
+    /// Test that stale or corrupt cache files are rejected
+    void testInvalidCacheFile();
+
+    /// Test that the same dictionary is shared within a process
+    void testGetDictionary();
+};
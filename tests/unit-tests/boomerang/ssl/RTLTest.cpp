@@ -47,6 +47,58 @@ void RTLTest::testAppend()
 }
 
 
+void RTLTest::testInsertErase()
+{
+    Assign *a1 = new Assign(Location::regOf(REG_PENT_EAX), Const::get(1));
+    Assign *a2 = new Assign(Location::regOf(REG_PENT_ECX), Const::get(2));
+    Assign *a3 = new Assign(Location::regOf(REG_PENT_EDX), Const::get(3));
+
+    RTL rtl(Address(0x1000), { a2 });
+
+    RTL::iterator it = rtl.insert(rtl.begin(), a1);
+    QVERIFY(*it == a1);
+    QVERIFY(*std::next(it) == a2);
+
+    rtl.append(a3);
+    QCOMPARE(rtl.size(), static_cast<RTL::size_type>(3));
+    QVERIFY(rtl.getStatements() == RTL::StmtList({ a1, a2, a3 }));
+
+    it = rtl.erase(std::next(rtl.begin()));
+    QVERIFY(*it == a3);
+    delete a2;
+
+    rtl.pop_front();
+    delete a1;
+    QVERIFY(rtl.getStatements() == RTL::StmtList({ a3 }));
+
+    Assign *a4 = new Assign(Location::regOf(REG_PENT_EBX), Const::get(4));
+    rtl.push_front(a4);
+    QVERIFY(rtl.front() == a4);
+    QVERIFY(rtl.back() == a3);
+}
+
+
+void RTLTest::testCopyMove()
+{
+    RTL rtl(Address(0x1000));
+    for (int i = 0; i < 8; i++) {
+        rtl.append(new Assign(Location::regOf(REG_PENT_EAX), Const::get(i)));
+    }
+
+    RTL copy(rtl);
+    QCOMPARE(copy.getAddress(), Address(0x1000));
+    QCOMPARE(copy.size(), rtl.size());
+    QCOMPARE(copy.prints(), rtl.prints());
+    QVERIFY(copy.front() != rtl.front()); // deep copy
+
+    const Statement *first = rtl.front();
+    RTL moved(std::move(rtl));
+    QVERIFY(rtl.empty());
+    QVERIFY(moved.front() == first);
+    QCOMPARE(moved.prints(), copy.prints());
+}
+
+
 class StmtVisitorStub : public StmtVisitor
 {
 public:
@@ -24,6 +24,12 @@ private slots:
     /// Test appendExp and printing of RTLs
     void testAppend();
 
+    /// Test insertion and removal of statements
+    void testInsertErase();
+
+    /// Test deep copies and moves of RTLs
+    void testCopyMove();
+
     /// Test the accept function for correct visiting behaviour.
     /// \note Stub class to test.
     void testVisitor();
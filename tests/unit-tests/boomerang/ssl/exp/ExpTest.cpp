@@ -25,6 +25,7 @@
 #include "boomerang/util/LocationSet.h"
 
 #include <map>
+#include <unordered_map>
 
 
 Q_DECLARE_METATYPE(LocationSet)
@@ -528,6 +529,47 @@ void ExpTest::testMapOfExp()
 }
 
 
+void ExpTest::testHash()
+{
+    hashExpStar hash;
+
+    SharedExp e = Location::memOf(Binary::get(opPlus,
+                                              RefExp::get(Location::regOf(REG_PENT_ESP), nullptr),
+                                              Const::get(4)));
+
+    // equal expressions have equal hashes
+    QCOMPARE(hash(e), hash(e->clone()));
+    QCOMPARE(hash(Const::get(2.0)), hash(Const::get(2.0)));
+    QCOMPARE(hash(Const::get("foo")), hash(Const::get(QString("foo"))));
+    QCOMPARE(hash(Terminal::get(opPC)), hash(Terminal::get(opPC)));
+
+    // the hash depends on the structure
+    QVERIFY(hash(Const::get(2)) != hash(Const::get(3)));
+    QVERIFY(hash(Location::regOf(REG_PENT_ESP)) != hash(Location::memOf(Const::get(REG_PENT_ESP))));
+    QVERIFY(hash(Binary::get(opMinus, Const::get(2), Const::get(3))) !=
+            hash(Binary::get(opMinus, Const::get(3), Const::get(2))));
+
+    std::unordered_map<SharedExp, int, hashExpStar, equalExpStar> m;
+    m[m_rof2] = 200;
+    m[m_99]   = 99;
+    m[e]      = -100;
+    SharedExp rof2 = Location::get(opRegOf, Const::get(REG_SPARC_G2), nullptr);
+    m[rof2] = 2; // Should overwrite
+
+    QCOMPARE(m.size(), static_cast<size_t>(3));
+    QCOMPARE(m[m_rof2], 2);
+    QCOMPARE(m[m_99],   99);
+    QCOMPARE(m[e->clone()], -100);
+
+    // subscripts with different definitions are different keys
+    std::shared_ptr<Assign> as(new Assign(Location::regOf(REG_PENT_ESP), Const::get(0)));
+    m[RefExp::get(Location::regOf(REG_PENT_ESP), as.get())] = 1;
+    QCOMPARE(m.size(), static_cast<size_t>(4));
+    QVERIFY(m.find(RefExp::get(Location::regOf(REG_PENT_ESP), nullptr)) == m.end());
+    QCOMPARE(m[RefExp::get(Location::regOf(REG_PENT_ESP), as.get())], 1);
+}
+
+
 void ExpTest::testList()
 {
     QCOMPARE(Binary::get(opList, Terminal::get(opNil), Terminal::get(opNil))->toString(), QString(""));
@@ -102,6 +102,9 @@ private slots:
     /// Test maps of Exp*s; exercises some comparison operators
     void testMapOfExp();
 
+    /// Test the structural hash and hash maps of Exp*s
+    void testHash();
+
     /// Test the opList creating and printing
     void testList();
 
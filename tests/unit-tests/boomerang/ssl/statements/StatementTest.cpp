@@ -1030,7 +1030,7 @@ void StatementTest::testAddUsedLocsBool()
     BoolAssign  bs(8);
 
     bs.setCondExpr(Binary::get(opEquals, Location::memOf(Location::regOf(REG_PENT_EAX)), Location::regOf(REG_PENT_ECX)));
-    std::list<Statement *> stmts;
+    RTL::StmtList stmts;
     stmts.push_back(new Assign(Location::memOf(Location::regOf(REG_PENT_EDX)), Terminal::get(opNil)));
 
     bs.setLeftFromList(stmts);
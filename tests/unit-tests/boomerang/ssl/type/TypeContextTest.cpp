@@ -0,0 +1,131 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "TypeContextTest.h"
+
+
+#include "boomerang/ssl/type/ArrayType.h"
+#include "boomerang/ssl/type/CharType.h"
+#include "boomerang/ssl/type/IntegerType.h"
+#include "boomerang/ssl/type/PointerType.h"
+#include "boomerang/ssl/type/TypeContext.h"
+#include "boomerang/ssl/type/UnionType.h"
+#include "boomerang/ssl/type/VoidType.h"
+
+
+void TypeContextTest::testIntern()
+{
+    TypeContext ctx;
+
+    SharedType ptr1 = PointerType::get(PointerType::get(CharType::get()));
+    SharedType ptr2 = PointerType::get(PointerType::get(CharType::get()));
+    QVERIFY(ptr1 != ptr2);
+
+    QVERIFY(ctx.intern(ptr1) == ptr1);
+    QVERIFY(ctx.intern(ptr2) == ptr1);
+    QVERIFY(ctx.intern(PointerType::get(CharType::get())) != ptr1);
+    QCOMPARE(ctx.getNumTypes(), size_t(2));
+
+    // signedness is part of the structure
+    SharedType int1 = ctx.intern(PointerType::get(IntegerType::get(32, Sign::Signed)));
+    SharedType int2 = ctx.intern(PointerType::get(IntegerType::get(32, Sign::Unsigned)));
+    QVERIFY(int1 != int2);
+
+    // mutable types are not interned
+    SharedType arr1 = ArrayType::get(CharType::get(), 4);
+    SharedType arr2 = ArrayType::get(CharType::get(), 4);
+    QVERIFY(ctx.intern(arr1) == arr1);
+    QVERIFY(ctx.intern(arr2) == arr2);
+
+    SharedType arrPtr = PointerType::get(arr1);
+    QVERIFY(ctx.intern(arrPtr) == arrPtr);
+    QCOMPARE(ctx.getNumTypes(), size_t(4));
+
+    ctx.clear();
+    QCOMPARE(ctx.getNumTypes(), size_t(0));
+}
+
+
+void TypeContextTest::testMeet()
+{
+    TypeContext ctx;
+    TypeContext::Scope scope(&ctx);
+
+    SharedType intTy   = IntegerType::get(32, Sign::Unknown);
+    SharedType ptrTy   = PointerType::get(VoidType::get());
+    SharedType charPtr = PointerType::get(CharType::get());
+
+    bool changed1   = false;
+    SharedType res1 = ptrTy->meetWith(charPtr, changed1);
+    QCOMPARE(ctx.getStats().numQueries, uint64(1));
+    QCOMPARE(ctx.getStats().numHits, uint64(0));
+
+    // same structure -> answered by the cache
+    bool changed2   = false;
+    SharedType res2 = PointerType::get(VoidType::get())->meetWith(
+        PointerType::get(CharType::get()), changed2);
+    QCOMPARE(ctx.getStats().numHits, uint64(1));
+
+    QVERIFY(res1 == res2);
+    QVERIFY(changed1);
+    QVERIFY(changed2);
+    QCOMPARE(res1->getCtype(), QString("char *"));
+
+    // the result is the canonical instance
+    QVERIFY(ctx.intern(PointerType::get(CharType::get())) == res1);
+
+    // unions are not memoized
+    bool changed3   = false;
+    SharedType res3 = intTy->meetWith(charPtr, changed3);
+    QVERIFY(res3->resolvesToUnion());
+    QVERIFY(changed3);
+
+    bool changed4   = false;
+    SharedType res4 = intTy->meetWith(charPtr, changed4);
+    QVERIFY(res4->resolvesToUnion());
+    QVERIFY(res4 != res3);
+    QCOMPARE(ctx.getStats().numHits, uint64(1));
+}
+
+
+void TypeContextTest::testScope()
+{
+    QVERIFY(TypeContext::getCurrent() == nullptr);
+
+    TypeContext outer;
+    TypeContext inner;
+
+    {
+        TypeContext::Scope outerScope(&outer);
+        QVERIFY(TypeContext::getCurrent() == &outer);
+
+        {
+            TypeContext::Scope innerScope(&inner);
+            QVERIFY(TypeContext::getCurrent() == &inner);
+
+            bool changed = false;
+            IntegerType::get(32, Sign::Unknown)->meetWith(IntegerType::get(32, Sign::Signed),
+                                                           changed);
+        }
+
+        QVERIFY(TypeContext::getCurrent() == &outer);
+    }
+
+    QVERIFY(TypeContext::getCurrent() == nullptr);
+
+    // meets outside of a scope are not memoized
+    bool changed = false;
+    IntegerType::get(32, Sign::Unknown)->meetWith(IntegerType::get(32, Sign::Signed), changed);
+
+    QCOMPARE(outer.getStats().numQueries, uint64(0));
+    QCOMPARE(inner.getStats().numQueries, uint64(1));
+}
+
+
+QTEST_GUILESS_MAIN(TypeContextTest)
@@ -0,0 +1,27 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include "TestUtils.h"
+
+
+/**
+ * Tests interning of types and memoization of meets
+ */
+class TypeContextTest : public BoomerangTest
+{
+    Q_OBJECT
+
+private slots:
+    void testIntern();
+    void testMeet();
+    void testScope();
+};
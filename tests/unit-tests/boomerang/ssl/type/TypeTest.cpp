@@ -20,6 +20,8 @@
 #include "boomerang/ssl/type/IntegerType.h"
 #include "boomerang/ssl/type/FloatType.h"
 #include "boomerang/ssl/type/PointerType.h"
+#include "boomerang/ssl/type/SizeType.h"
+#include "boomerang/ssl/type/VoidType.h"
 #include "boomerang/util/log/Log.h"
 
 #include <QDebug>
@@ -107,6 +109,34 @@ void TypeTest::testNotEqual()
 }
 
 
+void TypeTest::testInterned()
+{
+    QVERIFY(IntegerType::get(32, Sign::Signed) == IntegerType::get(32, Sign::Signed));
+    QVERIFY(IntegerType::get(256, Sign::Signed) == IntegerType::get(256, Sign::Signed));
+    QVERIFY(IntegerType::get(32, Sign::Signed) != IntegerType::get(32, Sign::SignedStrong));
+    QVERIFY(FloatType::get(64) == FloatType::get(64));
+    QVERIFY(SizeType::get(16) == SizeType::get(16));
+    QVERIFY(VoidType::get() == VoidType::get());
+
+    SharedType intTy = IntegerType::get(16, Sign::Unsigned);
+    QVERIFY(intTy->clone() == intTy);
+
+    // meets of interned types yield the canonical instance
+    bool changed1 = false;
+    bool changed2 = false;
+    SharedType res1 = intTy->meetWith(IntegerType::get(32, Sign::Unknown), changed1);
+    SharedType res2 = intTy->meetWith(IntegerType::get(32, Sign::Unknown), changed2);
+
+    QVERIFY(res1 == res2);
+    QVERIFY(changed1);
+    QVERIFY(changed2);
+    QCOMPARE(res1->getCtype(), QString("unsigned int"));
+
+    // the operands are not modified
+    QCOMPARE(intTy->getSize(), size_t(16));
+}
+
+
 void TypeTest::testCompound()
 {
     QVERIFY(m_project.loadBinaryFile(HELLO_WINDOWS));
@@ -148,6 +178,38 @@ void TypeTest::testCompound()
 }
 
 
+void TypeTest::testCompoundOffsets()
+{
+    std::shared_ptr<CompoundType> comp = CompoundType::get();
+    std::shared_ptr<ArrayType> arr     = ArrayType::get(IntegerType::get(8, Sign::Unsigned), 4);
+
+    comp->addMember(IntegerType::get(32, Sign::Signed), "a");
+    comp->addMember(arr, "b");
+    comp->addMember(FloatType::get(64), "c");
+
+    QCOMPARE(comp->getSize(), size_t(32 + 32 + 64));
+    QCOMPARE(comp->getMemberOffsetByIdx(2), 64U);
+    QCOMPARE(comp->getMemberOffsetByName("c"), 64U);
+    QCOMPARE(comp->getMemberNameByOffset(40), QString("b"));
+    QCOMPARE(comp->getOffsetRemainder(40), 8U);
+    QVERIFY(comp->getMemberTypeByOffset(128) == nullptr);
+
+    // the size of a member changes after it was added
+    arr->setLength(8);
+    QCOMPARE(comp->getSize(), size_t(32 + 64 + 64));
+    QCOMPARE(comp->getMemberOffsetByName("c"), 96U);
+    QCOMPARE(comp->getMemberNameByOffset(64), QString("b"));
+    QCOMPARE(comp->getMemberNameByOffset(96), QString("c"));
+
+    // a smaller member is padded
+    comp->setMemberTypeByOffset(0, IntegerType::get(16, Sign::Signed));
+    QCOMPARE(comp->getNumMembers(), 4);
+    QCOMPARE(comp->getMemberNameByOffset(16), QString("pad"));
+    QCOMPARE(comp->getMemberOffsetByName("b"), 32U);
+    QCOMPARE(comp->getSize(), size_t(32 + 64 + 64));
+}
+
+
 void TypeTest::testDataInterval()
 {
     Prog            *prog = new Prog("test", &m_project);
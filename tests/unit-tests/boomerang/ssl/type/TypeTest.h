@@ -20,7 +20,9 @@ class TypeTest : public BoomerangTestWithPlugins
 private slots:
     void testTypeLong();
     void testNotEqual();
+    void testInterned();
     void testCompound();
+    void testCompoundOffsets();
 
     // Test the DataIntervalMap class
     void testDataInterval();
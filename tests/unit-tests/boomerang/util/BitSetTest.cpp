@@ -0,0 +1,85 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "BitSetTest.h"
+
+
+#include "boomerang/util/BitSet.h"
+
+
+void BitSetTest::testSetReset()
+{
+    BitSet bits(130);
+    QCOMPARE(bits.size(), static_cast<size_t>(130));
+    QVERIFY(!bits.any());
+
+    bits.set(0);
+    bits.set(64);
+    bits.set(129);
+    QVERIFY(bits.any());
+    QVERIFY(bits.test(0));
+    QVERIFY(!bits.test(1));
+    QVERIFY(bits.test(64));
+    QVERIFY(!bits.test(65));
+    QVERIFY(bits.test(129));
+
+    bits.reset(64);
+    QVERIFY(!bits.test(64));
+    QVERIFY(bits.test(129));
+
+    bits.resetAll();
+    QVERIFY(!bits.any());
+}
+
+
+void BitSetTest::testSetAll()
+{
+    BitSet bits(70, true);
+    QVERIFY(bits.test(0));
+    QVERIFY(bits.test(69));
+
+    // bits past the end do not take part in comparisons
+    BitSet other(70);
+    other.setAll();
+    QVERIFY(bits == other);
+
+    other.reset(69);
+    QVERIFY(bits != other);
+
+    bits.assign(3, false);
+    QCOMPARE(bits.size(), static_cast<size_t>(3));
+    QVERIFY(!bits.any());
+}
+
+
+void BitSetTest::testSetOperations()
+{
+    BitSet a(100);
+    BitSet b(100);
+
+    a.set(1);
+    a.set(70);
+    b.set(70);
+    b.set(99);
+
+    BitSet unite = a;
+    unite |= b;
+    QVERIFY(unite.test(1) && unite.test(70) && unite.test(99));
+
+    BitSet intersect = a;
+    intersect &= b;
+    QVERIFY(!intersect.test(1) && intersect.test(70) && !intersect.test(99));
+
+    BitSet difference = a;
+    difference.subtract(b);
+    QVERIFY(difference.test(1) && !difference.test(70) && !difference.test(99));
+}
+
+
+QTEST_GUILESS_MAIN(BitSetTest)
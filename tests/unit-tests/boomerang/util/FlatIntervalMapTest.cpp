@@ -0,0 +1,194 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "FlatIntervalMapTest.h"
+
+
+#include "boomerang/util/FlatIntervalMap.h"
+
+
+void FlatIntervalMapTest::testIsEmpty()
+{
+    FlatIntervalMap<Address, int> map;
+    QVERIFY(map.isEmpty());
+    map.insert(Interval<Address>(Address::ZERO, Address(0x1000)), 10);
+    QVERIFY(!map.isEmpty());
+}
+
+
+void FlatIntervalMapTest::testClear()
+{
+    FlatIntervalMap<Address, int> map;
+    map.clear();
+    QVERIFY(map.isEmpty());
+
+    map.insert(Address(0x1000), Address(0x1010), 10);
+    map.clear();
+    QVERIFY(map.isEmpty());
+    QVERIFY(map.find(Address(0x1000)) == map.end());
+}
+
+
+void FlatIntervalMapTest::testInsert()
+{
+    FlatIntervalMap<Address, int> map;
+
+    QVERIFY(map.insert(Address(0x1000), Address(0x1000), 10) == map.end());
+    QVERIFY(map.isEmpty());
+
+    QVERIFY(map.insert(Address(0x1010), Address(0x2000), 20) != map.end());
+    QVERIFY(!map.isEmpty());
+
+    // insert before the existing interval
+    auto it = map.insert(Address(0x1000), Address(0x1010), 10);
+    QVERIFY(it == map.begin());
+    QCOMPARE(it->second, 10);
+    QVERIFY(std::distance(map.begin(), map.end()) == 2);
+
+    // insertion fails: interval already occupied
+    QVERIFY(map.insert(Address(0x1000), Address(0x2000), 30) == map.end());
+    QVERIFY(std::distance(map.begin(), map.end()) == 2);
+}
+
+
+void FlatIntervalMapTest::testErase()
+{
+    FlatIntervalMap<Address, int> map;
+
+    map.insert(Address(0x1000), Address(0x1010), 10);
+    auto it = map.erase(map.begin());
+    QVERIFY(it == map.end());
+
+    map.insert(Address(0x1000), Address(0x1010), 10);
+    map.insert(Address(0x2000), Address(0x2020), 20);
+    it = map.erase(map.begin());
+    QVERIFY(it == map.begin());
+    QCOMPARE(it->second, 20);
+    QVERIFY(map.find(Address(0x1000)) == map.end());
+}
+
+
+void FlatIntervalMapTest::testEraseAll()
+{
+    FlatIntervalMap<Address, int> map;
+
+    map.eraseAll(Address(0x1000));
+    QVERIFY(map.isEmpty());
+
+    map.insert(Address(0x1000), Address(0x1000), 10);
+    map.insert(Address(0x1000), Address(0x1010), 10);
+
+    map.eraseAll(Address(0x1010));
+    QVERIFY(!map.isEmpty());
+    map.eraseAll(Address(0x800));
+    QVERIFY(!map.isEmpty());
+
+    map.eraseAll(Address(0x1000));
+    QVERIFY(map.isEmpty());
+
+    map.insert(Address(0x1000), Address(0x1010), 10);
+    map.insert(Address(0x1008), Address(0x1010), 20);
+    map.eraseAll(Address(0x100C));
+    QVERIFY(map.isEmpty());
+
+    map.insert(Address(0x1000), Address(0x1010), 10);
+    map.insert(Address(0x1010), Address(0x1020), 20);
+    map.insert(Address(0x1020), Address(0x1030), 30);
+    map.eraseAll(Interval<Address>(Address(0x1008), Address(0x1018)));
+    QVERIFY(std::distance(map.begin(), map.end()) == 1);
+    QCOMPARE(map.begin()->second, 30);
+}
+
+
+void FlatIntervalMapTest::testFind()
+{
+    FlatIntervalMap<Address, int> map;
+    map.insert(Address(0x1000), Address(0x2000), 10);
+    map.insert(Address(0x2000), Address(0x3000), 20);
+
+    QVERIFY(map.find(Address::ZERO) == map.end());
+    QCOMPARE(map.find(Address(0x1000))->second, 10); // start of interval
+    QCOMPARE(map.find(Address(0x1800))->second, 10); // middle of interval
+    QCOMPARE(map.find(Address(0x2000))->second, 20); // beginning of interval with preceding interval
+    QVERIFY(map.find(Address(0x3000)) == map.end()); // end of interval
+}
+
+
+void FlatIntervalMapTest::testFindOverlapping()
+{
+    FlatIntervalMap<Address, int> map;
+    map.insert(Address(0x1000), Address(0x4000), 10);
+    map.insert(Address(0x2000), Address(0x2100), 20);
+    map.insert(Address(0x5000), Address(0x6000), 30);
+
+    // the interval with the lowest lower bound is found
+    QCOMPARE(map.find(Address(0x2080))->second, 10);
+    QCOMPARE(map.find(Address(0x3000))->second, 10);
+    QVERIFY(map.find(Address(0x4800)) == map.end());
+    QCOMPARE(map.find(Address(0x5000))->second, 30);
+
+    map.erase(map.begin());
+    QCOMPARE(map.find(Address(0x2080))->second, 20);
+    QVERIFY(map.find(Address(0x3000)) == map.end());
+}
+
+
+void FlatIntervalMapTest::testEqualRange()
+{
+    FlatIntervalMap<Address, int> map;
+
+    auto p = map.equalRange(Address(0x1000), Address(0x1010));
+    QVERIFY(p.first == map.end() && p.second == map.end());
+
+    map.insert(Address(0x1000), Address(0x1010), 10);
+    p = map.equalRange(Address(0x1000), Address(0x1010));
+    QVERIFY(p.first == map.begin());
+    QVERIFY(p.second == map.end());
+
+    p = map.equalRange(Address(0x800), Address(0x1000));
+    QVERIFY(p.first == map.end());
+    QVERIFY(p.second == map.end());
+
+    p = map.equalRange(Address(0x1008), Address(0x2000));
+    QVERIFY(p.first == map.begin());
+    QVERIFY(p.second == map.end());
+
+    p = map.equalRange(Address(0x1010), Address(0x2000));
+    QVERIFY(p.first == map.end());
+    QVERIFY(p.second == map.end());
+
+    map.insert(Address(0x2000), Address(0x2020), 20);
+    const auto itFirst  = map.begin();
+    const auto itSecond = std::next(map.begin());
+
+    p = map.equalRange(Address(0x1008), Address(0x1010));
+    QVERIFY(p.first == itFirst);
+    QVERIFY(p.second == itSecond);
+
+    p = map.equalRange(Address(0x1008), Address(0x2010));
+    QVERIFY(p.first == itFirst);
+    QVERIFY(p.second == map.end());
+
+    p = map.equalRange(Address(0x1080), Address(0x2010));
+    QVERIFY(p.first == itSecond);
+    QVERIFY(p.second == map.end());
+
+    p = map.equalRange(Address(0x2000), Address(0x2000));
+    QVERIFY(p.first == map.end());
+    QVERIFY(p.second == map.end());
+
+    // const and non-const versions agree
+    const FlatIntervalMap<Address, int> &constMap = map;
+    auto cp = constMap.equalRange(Address(0x1008), Address(0x1010));
+    QVERIFY(cp.first == constMap.begin());
+    QVERIFY(cp.second == std::next(constMap.begin()));
+}
+
+
+QTEST_GUILESS_MAIN(FlatIntervalMapTest)
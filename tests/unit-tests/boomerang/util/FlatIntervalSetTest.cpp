@@ -0,0 +1,157 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "FlatIntervalSetTest.h"
+
+
+#include "boomerang/util/Address.h"
+#include "boomerang/util/FlatIntervalSet.h"
+
+
+void FlatIntervalSetTest::testIsEmpty()
+{
+    FlatIntervalSet<Address> set;
+
+    QVERIFY(set.isEmpty());
+    set.insert(Address(0x1000), Address(0x1010));
+    QVERIFY(!set.isEmpty());
+}
+
+
+void FlatIntervalSetTest::testClear()
+{
+    FlatIntervalSet<Address> set;
+    set.clear();
+    QVERIFY(set.isEmpty());
+
+    set.insert(Address(0x1000), Address(0x1010));
+    set.insert(Address(0x2000), Address(0x2020));
+    set.clear();
+    QVERIFY(set.isEmpty());
+}
+
+
+void FlatIntervalSetTest::testInsert()
+{
+    FlatIntervalSet<Address> set;
+
+    set.insert(Address(0x1000), Address(0x1000));
+    QVERIFY(std::distance(set.begin(), set.end()) == 0);
+
+    set.insert(Address(0x1000), Address(0x1010));
+    QVERIFY(std::distance(set.begin(), set.end()) == 1);
+
+    // insert (non-blocking)
+    set.insert(Address(0x2000), Address(0x2020));
+    QVERIFY(std::distance(set.begin(), set.end()) == 2);
+
+    // Insert (adjacent)
+    set.insert(Address(0x1010), Address(0x2000));
+    QVERIFY(std::distance(set.begin(), set.end()) == 3);
+
+    // insert (blocking)
+    set.insert(Address(0x2000), Address(0x2020));
+    QVERIFY(std::distance(set.begin(), set.end()) == 3);
+}
+
+
+void FlatIntervalSetTest::testInsertMerge()
+{
+    FlatIntervalSet<Address> set;
+    set.insert(Address(0x1000), Address(0x1010));
+    set.insert(Address(0x1020), Address(0x1030));
+    set.insert(Address(0x1040), Address(0x1050));
+
+    // overlaps the first two intervals
+    auto it = set.insert(Address(0x1008), Address(0x1028));
+    QVERIFY(it == set.begin());
+    QCOMPARE(it->lower(), Address(0x1000));
+    QCOMPARE(it->upper(), Address(0x1030));
+    QVERIFY(std::distance(set.begin(), set.end()) == 2);
+
+    // contained in an existing interval
+    it = set.insert(Address(0x1044), Address(0x1048));
+    QCOMPARE(it->lower(), Address(0x1040));
+    QCOMPARE(it->upper(), Address(0x1050));
+    QVERIFY(std::distance(set.begin(), set.end()) == 2);
+
+    // covers everything
+    it = set.insert(Address(0x800), Address(0x2000));
+    QVERIFY(it == set.begin());
+    QCOMPARE(it->lower(), Address(0x800));
+    QCOMPARE(it->upper(), Address(0x2000));
+    QVERIFY(std::distance(set.begin(), set.end()) == 1);
+}
+
+
+void FlatIntervalSetTest::testEqualRange()
+{
+    FlatIntervalSet<Address> set;
+
+    auto p = set.equalRange(Address(0x1000), Address(0x1010));
+    QVERIFY(p.first == set.end() && p.second == set.end());
+
+    set.insert(Address(0x1000), Address(0x1010));
+    p = set.equalRange(Address(0x1000), Address(0x1010));
+    QVERIFY(p.first == set.begin());
+    QVERIFY(p.second == set.end());
+
+    p = set.equalRange(Address(0x800), Address(0x1000));
+    QVERIFY(p.first == set.end());
+    QVERIFY(p.second == set.end());
+
+    p = set.equalRange(Address(0x1008), Address(0x2000));
+    QVERIFY(p.first == set.begin());
+    QVERIFY(p.second == set.end());
+
+    p = set.equalRange(Address(0x1010), Address(0x2000));
+    QVERIFY(p.first == set.end());
+    QVERIFY(p.second == set.end());
+
+    set.insert(Address(0x2000), Address(0x2020));
+    const auto itFirst  = set.begin();
+    const auto itSecond = std::next(set.begin());
+
+    p = set.equalRange(Address(0x1008), Address(0x1010));
+    QVERIFY(p.first == itFirst);
+    QVERIFY(p.second == itSecond);
+
+    p = set.equalRange(Address(0x1008), Address(0x2010));
+    QVERIFY(p.first == itFirst);
+    QVERIFY(p.second == set.end());
+
+    p = set.equalRange(Address(0x1080), Address(0x2010));
+    QVERIFY(p.first == itSecond);
+    QVERIFY(p.second == set.end());
+
+    p = set.equalRange(Address(0x2000), Address(0x2000));
+    QVERIFY(p.first == set.end());
+    QVERIFY(p.second == set.end());
+}
+
+
+void FlatIntervalSetTest::testIsContained()
+{
+    FlatIntervalSet<Address> set;
+    QVERIFY(!set.isContained(Address(0x1000)));
+
+    set.insert(Address(0x1000), Address(0x1010));
+    QVERIFY(set.isContained(Address(0x1000)));
+    QVERIFY(set.isContained(Address(0x1008)));
+    QVERIFY(!set.isContained(Address(0x1010)));
+
+    set.insert(Address(0x2000), Address(0x2020));
+    QVERIFY(!set.isContained(Address(0x0800)));
+    QVERIFY(!set.isContained(Address(0x1080)));
+    QVERIFY(set.isContained(Address(0x201F)));
+    QVERIFY(!set.isContained(Address(0x2040)));
+}
+
+
+QTEST_GUILESS_MAIN(FlatIntervalSetTest)
@@ -0,0 +1,178 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "SmallVectorTest.h"
+
+
+#include "boomerang/ssl/exp/Const.h"
+#include "boomerang/ssl/exp/Location.h"
+#include "boomerang/util/FlatSet.h"
+#include "boomerang/util/SmallVector.h"
+
+#include <memory>
+
+
+void SmallVectorTest::testPushBack()
+{
+    SmallVector<int, 4> vec;
+    QVERIFY(vec.empty());
+    QVERIFY(vec.isInline());
+    QCOMPARE(vec.capacity(), static_cast<size_t>(4));
+
+    for (int i = 0; i < 4; i++) {
+        vec.push_back(i);
+    }
+
+    QVERIFY(vec.isInline());
+    QCOMPARE(vec.size(), static_cast<size_t>(4));
+
+    vec.push_back(4);
+    QVERIFY(!vec.isInline());
+    QCOMPARE(vec.size(), static_cast<size_t>(5));
+
+    for (int i = 0; i < 5; i++) {
+        QCOMPARE(vec[i], i);
+    }
+
+    vec.pop_back();
+    QCOMPARE(vec.back(), 3);
+
+    vec.clear();
+    QVERIFY(vec.empty());
+}
+
+
+void SmallVectorTest::testInsert()
+{
+    SmallVector<int, 2> vec = { 1, 3 };
+
+    // insert in the middle, exceeding the inline capacity
+    auto it = vec.insert(vec.begin() + 1, 2);
+    QCOMPARE(*it, 2);
+    QVERIFY(vec == (SmallVector<int, 2>{ 1, 2, 3 }));
+
+    vec.insert(vec.begin(), 0);
+    vec.insert(vec.end(), 4);
+    QVERIFY(vec == (SmallVector<int, 2>{ 0, 1, 2, 3, 4 }));
+
+    const int more[] = { 5, 6 };
+    vec.insert(vec.begin() + 1, std::begin(more), std::end(more));
+    QVERIFY(vec == (SmallVector<int, 2>{ 0, 5, 6, 1, 2, 3, 4 }));
+
+    // inserting an element of the vector itself
+    vec.insert(vec.begin(), vec.back());
+    QCOMPARE(vec.front(), 4);
+}
+
+
+void SmallVectorTest::testErase()
+{
+    SmallVector<std::shared_ptr<int>, 4> vec;
+    std::weak_ptr<int> erased;
+
+    for (int i = 0; i < 4; i++) {
+        vec.push_back(std::make_shared<int>(i));
+    }
+
+    erased = vec[1];
+    auto it = vec.erase(vec.begin() + 1);
+    QCOMPARE(**it, 2);
+    QCOMPARE(vec.size(), static_cast<size_t>(3));
+    QVERIFY(erased.expired());
+
+    it = vec.erase(vec.begin() + 1, vec.end());
+    QVERIFY(it == vec.end());
+    QCOMPARE(vec.size(), static_cast<size_t>(1));
+    QCOMPARE(*vec.front(), 0);
+}
+
+
+void SmallVectorTest::testCopyMove()
+{
+    SmallVector<std::shared_ptr<int>, 2> small;
+    small.push_back(std::make_shared<int>(1));
+
+    SmallVector<std::shared_ptr<int>, 2> large;
+    for (int i = 0; i < 5; i++) {
+        large.push_back(std::make_shared<int>(i));
+    }
+
+    SmallVector<std::shared_ptr<int>, 2> copy(large);
+    QCOMPARE(copy.size(), large.size());
+    QVERIFY(copy == large);
+
+    SmallVector<std::shared_ptr<int>, 2> moved(std::move(large));
+    QCOMPARE(moved.size(), static_cast<size_t>(5));
+    QVERIFY(large.empty());
+    QVERIFY(large.isInline());
+
+    moved = std::move(small);
+    QCOMPARE(moved.size(), static_cast<size_t>(1));
+    QVERIFY(moved.isInline());
+    QCOMPARE(*moved[0], 1);
+    QVERIFY(small.empty());
+
+    copy = moved;
+    QCOMPARE(copy.size(), static_cast<size_t>(1));
+    QCOMPARE(copy[0].use_count(), 2L);
+}
+
+
+void SmallVectorTest::testFlatSetInsert()
+{
+    FlatSet<SharedExp, lessExpStar, 2> set;
+
+    QVERIFY(set.insert(Location::regOf(REG_PENT_ECX)).second);
+    QVERIFY(set.insert(Location::regOf(REG_PENT_EAX)).second);
+    QVERIFY(set.insert(Location::regOf(REG_PENT_EDX)).second);
+    QVERIFY(!set.insert(Location::regOf(REG_PENT_EAX)).second);
+    QCOMPARE(set.size(), 3);
+
+    QVERIFY(std::is_sorted(set.begin(), set.end(), lessExpStar()));
+    QVERIFY(set.contains(Location::regOf(REG_PENT_EDX)));
+    QVERIFY(!set.contains(Location::regOf(REG_PENT_EBX)));
+}
+
+
+void SmallVectorTest::testFlatSetRemove()
+{
+    FlatSet<SharedExp, lessExpStar> set;
+    set.insert(Location::regOf(REG_PENT_EAX));
+    set.insert(Location::regOf(REG_PENT_ECX));
+
+    QVERIFY(!set.remove(Location::regOf(REG_PENT_EDX)));
+    QVERIFY(set.remove(Location::regOf(REG_PENT_EAX)));
+    QCOMPARE(set.size(), 1);
+
+    auto it = set.erase(set.begin());
+    QVERIFY(it == set.end());
+    QVERIFY(set.empty());
+}
+
+
+void SmallVectorTest::testFlatSetSort()
+{
+    FlatSet<SharedExp, lessExpStar> set;
+
+    SharedExp a = Location::memOf(Const::get(0x1000));
+    SharedExp b = Location::memOf(Const::get(0x2000));
+    set.insert(a);
+    set.insert(b);
+
+    // modify the elements in place, inverting their order
+    a->setSubExp1(Const::get(0x3000));
+    QVERIFY(!std::is_sorted(set.begin(), set.end(), lessExpStar()));
+
+    set.sort();
+    QVERIFY(std::is_sorted(set.begin(), set.end(), lessExpStar()));
+    QVERIFY(set.contains(Location::memOf(Const::get(0x3000))));
+}
+
+
+QTEST_GUILESS_MAIN(SmallVectorTest)
@@ -0,0 +1,30 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include "TestUtils.h"
+
+
+class SmallVectorTest : public BoomerangTest
+{
+public:
+    Q_OBJECT
+
+private slots:
+    void testPushBack();
+    void testInsert();
+    void testErase();
+    void testCopyMove();
+
+    void testFlatSetInsert();
+    void testFlatSetRemove();
+    void testFlatSetSort();
+};